@@ -2,6 +2,7 @@
 #include <utils.h>
 #include <spi.h>
 #include <string.h>
+#include <stdbool.h>
 #include <driver/gpio.h>
 #include <driver/spi_master.h>
 #include <esp_log.h>
@@ -18,6 +19,7 @@ typedef struct
     eink_color_t color;
     SemaphoreHandle_t hrdy_semaphore;
     uint8_t *spi_buffer; // 32-bit aligned DMA accessible buffer used for SPI transfer
+    bool is_running; // Not in standby or sleep
 } eink_ctx_t;
 
 static eink_ctx_t ctx;
@@ -28,6 +30,7 @@ static esp_err_t eink_spi_write16(uint16_t data);
 
 static esp_err_t eink_gpio_config(void);
 static esp_err_t eink_spi_config(void);
+static eink_err_t eink_power_down(uint16_t command);
 
 static void eink_hrdy_isr(void *arg);
 static eink_err_t eink_wait_hrdy(void);
@@ -45,7 +48,7 @@ static eink_err_t eink_set_target_memory_address(uint32_t address);
 static eink_err_t eink_set_area(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
 /* Public functions */
-eink_err_t eink_init(eink_rotation_t rotation, eink_color_t color)
+eink_err_t eink_init(eink_rotation_t rotation, eink_color_t color, bool clear)
 {
     ctx.rotation = rotation;
     ctx.color = color;
@@ -112,6 +115,11 @@ eink_err_t eink_init(eink_rotation_t rotation, eink_color_t color)
         return err;
     }
 
+    /* Image retained on the panel is kept, e.g. when waking from deep sleep */
+    if (!clear) {
+        return EINK_OK;
+    }
+
     /* Clear the display */
     err = eink_clear();
     if (err != EINK_OK) {
@@ -147,12 +155,19 @@ eink_err_t eink_deinit(void)
 
 eink_err_t eink_wakeup(void)
 {
-    return eink_write_command(IT8951_TCON_SYS_RUN);
+    const eink_err_t err = eink_write_command(IT8951_TCON_SYS_RUN);
+    ctx.is_running = (err == EINK_OK);
+    return err;
+}
+
+eink_err_t eink_standby(void)
+{
+    return eink_power_down(IT8951_TCON_STANDBY);
 }
 
 eink_err_t eink_sleep(void)
 {
-    return eink_write_command(IT8951_TCON_SLEEP);
+    return eink_power_down(IT8951_TCON_SLEEP);
 }
 
 void eink_set_rotation(eink_rotation_t rotation)
@@ -376,6 +391,28 @@ eink_err_t eink_refresh_full(eink_update_mode_t mode)
 
 
 /* Private functions */
+static eink_err_t eink_power_down(uint16_t command)
+{
+    /* Controller goes from standby to sleep through run mode */
+    if (!ctx.is_running) {
+        const eink_err_t err = eink_wakeup();
+        if (err != EINK_OK) {
+            return err;
+        }
+    }
+
+    /* Stopping the controller during refresh would leave the panel half updated */
+    eink_err_t err = eink_wait_afsr();
+    if (err != EINK_OK) {
+        return err;
+    }
+    err = eink_write_command(command);
+    if (err == EINK_OK) {
+        ctx.is_running = false;
+    }
+    return err;
+}
+
 static esp_err_t eink_spi_read16(uint16_t *data)
 {
     const esp_err_t err = spi_transfer(ctx.spi_dev, NULL, data, sizeof(*data));
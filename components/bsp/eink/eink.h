@@ -7,6 +7,7 @@ extern "C" {
 #include "IT8951.h"
 #include "spi.h"
 #include <esp_err.h>
+#include <stdbool.h>
 
 #define EINK_DISPLAY_WIDTH 960
 #define EINK_DISPLAY_HEIGHT 540
@@ -77,10 +78,15 @@ typedef enum
 } eink_err_t;
 
 
-eink_err_t eink_init(eink_rotation_t rotation, eink_color_t color);
+/* Without clearing, the panel keeps showing its image, but the controller doesn't know it. The first
+ * refresh then has to be a full GC16 one, so that it doesn't depend on the previous image. */
+eink_err_t eink_init(eink_rotation_t rotation, eink_color_t color, bool clear);
 eink_err_t eink_deinit(void);
 
+/* Standby stops the controller's clocks and wakes up faster than sleep, which also turns off its PLL.
+ * Both wait for the refresh in progress to finish, the image stays on the panel. */
 eink_err_t eink_wakeup(void);
+eink_err_t eink_standby(void);
 eink_err_t eink_sleep(void);
 
 void eink_set_rotation(eink_rotation_t rotation);
@@ -15,8 +15,10 @@
 #define BM8563_MINUTE_ALARM_REG     0x09
 #define BM8563_HOUR_ALARM_REG       0x0A
 #define BM8563_DAY_ALARM_REG        0x0B
-#define BM8563_TIMER_CONTROL_REG    0x0C
-#define BM8563_TIMER_REG            0x0D
+#define BM8563_WEEKDAY_ALARM_REG    0x0C
+#define BM8563_CLKOUT_CONTROL_REG   0x0D
+#define BM8563_TIMER_CONTROL_REG    0x0E
+#define BM8563_TIMER_REG            0x0F
 
 #define BM8563_VL_MASK          0b10000000
 #define BM8563_SECONDS_MASK     0b01111111
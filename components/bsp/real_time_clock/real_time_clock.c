@@ -2,6 +2,7 @@
 #include "BM8563.h"
 #include <i2c.h>
 #include <utils.h>
+#include <sys/time.h>
 
 real_time_clock_err_t real_time_clock_init(void)
 {
@@ -45,6 +46,11 @@ real_time_clock_err_t real_time_clock_set_time(const struct tm *time)
         return REAL_TIME_CLOCK_I2C_ERROR;
     }
 
+    /* Keep system time in step */
+    struct tm time_copy = *time;
+    const struct timeval system_time = {.tv_sec = mktime(&time_copy), .tv_usec = 0};
+    settimeofday(&system_time, NULL);
+
     return REAL_TIME_CLOCK_OK;
 }
 
@@ -85,12 +91,16 @@ real_time_clock_err_t real_time_clock_get_time(struct tm *time)
     return REAL_TIME_CLOCK_OK;
 }
 
-real_time_clock_err_t real_time_clock_set_alarm(const struct tm *alarm)
+real_time_clock_err_t real_time_clock_sync_system_time(void)
 {
-    return REAL_TIME_CLOCK_GENERAL_ERROR;
-}
+    struct tm time;
+    const real_time_clock_err_t err = real_time_clock_get_time(&time);
+    if ((err != REAL_TIME_CLOCK_OK) && (err != REAL_TIME_CLOCK_LOW_VOLTAGE)) {
+        return err;
+    }
 
-real_time_clock_err_t real_time_clock_get_alarm(struct tm *alarm)
-{
-    return REAL_TIME_CLOCK_GENERAL_ERROR;
+    const struct timeval system_time = {.tv_sec = mktime(&time), .tv_usec = 0};
+    settimeofday(&system_time, NULL);
+
+    return err;
 }
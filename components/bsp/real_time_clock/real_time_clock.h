@@ -24,8 +24,8 @@ real_time_clock_err_t real_time_clock_init(void);
 real_time_clock_err_t real_time_clock_set_time(const struct tm *time);
 real_time_clock_err_t real_time_clock_get_time(struct tm *time);
 
-real_time_clock_err_t real_time_clock_set_alarm(const struct tm *alarm);
-real_time_clock_err_t real_time_clock_get_alarm(struct tm *alarm);
+/* Sets system time from the RTC, so that it can be read without I2C transfers. It keeps counting in light sleep. */
+real_time_clock_err_t real_time_clock_sync_system_time(void);
 
 #ifdef __cplusplus
 }
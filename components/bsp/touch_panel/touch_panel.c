@@ -3,6 +3,9 @@
 #include <utils.h>
 #include <driver/gpio.h>
 #include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
 
 #define TAG __FILENAME__
 
@@ -12,15 +15,32 @@ typedef struct
     uint16_t last_y;
     touch_panel_rotation_t rotation;
     uint8_t i2c_address;
+    TaskHandle_t task;
+    QueueHandle_t event_queue;
+    touch_panel_state_t last_queued_state; // Owned by the driver task
+    touch_panel_coords_t last_event;       // Owned by the input device
+    touch_panel_stats_t stats;
+    portMUX_TYPE lock;
 } touch_panel_ctx_t;
 
-static touch_panel_ctx_t ctx;
+static touch_panel_ctx_t ctx = {
+    .lock = portMUX_INITIALIZER_UNLOCKED
+};
 
+static touch_panel_err_t touch_panel_read(touch_panel_coords_t *coords, bool *is_valid);
+static void touch_panel_queue_event(const touch_panel_coords_t *coords);
+static void touch_panel_count(uint32_t *counter, uint32_t value);
+static void touch_panel_irq_isr(void *arg);
+static void touch_panel_task(void *arg);
+
+/* Public functions */
 touch_panel_err_t touch_panel_init(touch_panel_rotation_t rotation)
 {
     ctx.last_x = 0;
     ctx.last_y = 0;
     ctx.rotation = rotation;
+    ctx.last_queued_state = TOUCH_PANEL_RELEASED;
+    ctx.last_event = (touch_panel_coords_t){0, 0, TOUCH_PANEL_RELEASED};
 
     const gpio_config_t gpio_cfg = {
         .intr_type = GPIO_INTR_DISABLE,
@@ -46,7 +66,8 @@ touch_panel_err_t touch_panel_init(touch_panel_rotation_t rotation)
      * address is configured. That's why both have to be 
      * checked here. */
     const uint8_t i2c_addresses[] = {GT911_I2C_ADDRESS_1, GT911_I2C_ADDRESS_2};
-    for (size_t i = 0; i < ARRAY_SIZE(i2c_addresses); ++i) {
+    size_t i;
+    for (i = 0; i < ARRAY_SIZE(i2c_addresses); ++i) {
         ESP_LOGI(TAG, "Trying I2C address 0x%X", i2c_addresses[i]);
         if (i2c_check_presence(i2c_addresses[i]) != ESP_OK) {
             ESP_LOGI(TAG, "Address not found...");
@@ -54,22 +75,74 @@ touch_panel_err_t touch_panel_init(touch_panel_rotation_t rotation)
         else {
             ESP_LOGI(TAG, "Address OK");
             ctx.i2c_address = i2c_addresses[i];
-            return TOUCH_PANEL_OK;
+            break;
         }
     }
-    ESP_LOGE(TAG, "Touch panel controller not found!");
-    return TOUCH_PANEL_I2C_ERROR;
+    if (i == ARRAY_SIZE(i2c_addresses)) {
+        ESP_LOGE(TAG, "Touch panel controller not found!");
+        return TOUCH_PANEL_I2C_ERROR;
+    }
+
+    /* Start the task reading the controller */
+    ctx.event_queue = xQueueCreate(TOUCH_PANEL_EVENT_QUEUE_LENGTH, sizeof(touch_panel_coords_t));
+    if (ctx.event_queue == NULL) {
+        return TOUCH_PANEL_NO_MEMORY;
+    }
+    const BaseType_t ret = xTaskCreatePinnedToCore(touch_panel_task, TOUCH_PANEL_TASK_NAME, TOUCH_PANEL_TASK_STACK_SIZE / sizeof(StackType_t),
+                                                   NULL, TOUCH_PANEL_TASK_PRIORITY, &ctx.task, TOUCH_PANEL_TASK_CORE_AFFINITY);
+    if (ret != pdPASS) {
+        vQueueDelete(ctx.event_queue);
+        return TOUCH_PANEL_NO_MEMORY;
+    }
+
+    /* INT goes low when GT911 has new data. Level, not edge, is used, as the same type is required
+     * by the light sleep GPIO wakeup of this pin. Service may be already installed by other drivers. */
+    esp_err_t err = gpio_install_isr_service(0);
+    if ((err != ESP_OK) && (err != ESP_ERR_INVALID_STATE)) {
+        return TOUCH_PANEL_GPIO_ERROR;
+    }
+    err = gpio_set_intr_type(TOUCH_PANEL_IRQ_PIN, GPIO_INTR_LOW_LEVEL);
+    if (err != ESP_OK) {
+        return TOUCH_PANEL_GPIO_ERROR;
+    }
+    err = gpio_isr_handler_add(TOUCH_PANEL_IRQ_PIN, touch_panel_irq_isr, NULL);
+    if (err != ESP_OK) {
+        return TOUCH_PANEL_GPIO_ERROR;
+    }
+    err = gpio_intr_enable(TOUCH_PANEL_IRQ_PIN);
+    if (err != ESP_OK) {
+        return TOUCH_PANEL_GPIO_ERROR;
+    }
+
+    return TOUCH_PANEL_OK;
 }
 
-touch_panel_err_t touch_get_coords(touch_panel_coords_t *coords) // TODO add multiple touches handling
+bool touch_panel_get_event(touch_panel_coords_t *coords)
 {
-    /* Sanity check */
-    if (coords == NULL) {
-        return TOUCH_PANEL_INVALID_ARG;
+    touch_panel_count(&ctx.stats.input_reads, 1);
+
+    touch_panel_coords_t event;
+    if (xQueueReceive(ctx.event_queue, &event, 0) == pdTRUE) {
+        ctx.last_event = event;
     }
+    *coords = ctx.last_event;
 
+    return uxQueueMessagesWaiting(ctx.event_queue) > 0;
+}
+
+void touch_panel_get_stats(touch_panel_stats_t *stats)
+{
+    taskENTER_CRITICAL(&ctx.lock);
+    *stats = ctx.stats;
+    taskEXIT_CRITICAL(&ctx.lock);
+}
+
+/* Private functions */
+static touch_panel_err_t touch_panel_read(touch_panel_coords_t *coords, bool *is_valid) // TODO add multiple touches handling
+{
     /* Read status register */
     uint8_t status_reg;
+    touch_panel_count(&ctx.stats.i2c_transactions, 1);
     esp_err_t err = i2c_read(ctx.i2c_address, GT911_TOUCH_STATUS_REG, GT911_REG_ADDR_SIZE_BYTES, &status_reg, sizeof(status_reg));
     if (err != ESP_OK) {
         return TOUCH_PANEL_I2C_ERROR;
@@ -78,21 +151,20 @@ touch_panel_err_t touch_get_coords(touch_panel_coords_t *coords) // TODO add mul
     /* If data valid and screen touched - read new touch coordinates */
     const bool data_valid = status_reg & GT911_TOUCH_DATA_VALID_MASK;
     const uint8_t touch_count = status_reg & GT911_TOUCH_POINTS_COUNT_MASK;
+    *is_valid = data_valid;
     if (!data_valid) {
-        coords->x = ctx.last_x;
-        coords->y = ctx.last_y;
-        coords->state = TOUCH_PANEL_RELEASED;
         return TOUCH_PANEL_OK;
     }
 
     if (touch_count > 0) {
         /* Read touch data */
         uint8_t touch_data[GT911_TOUCH_COORDS_SIZE];
+        touch_panel_count(&ctx.stats.i2c_transactions, 1);
         err = i2c_read(ctx.i2c_address, GT911_POINT_1_X_COORD_LSB_REG, GT911_REG_ADDR_SIZE_BYTES, &touch_data, sizeof(touch_data));
         if (err != ESP_OK) {
             return TOUCH_PANEL_I2C_ERROR;
         }
-        
+
         /* Transform coordinates */
         const uint16_t touch_x = MAKE_WORD(touch_data[1], touch_data[0]);
         const uint16_t touch_y = MAKE_WORD(touch_data[3], touch_data[2]);
@@ -119,18 +191,77 @@ touch_panel_err_t touch_get_coords(touch_panel_coords_t *coords) // TODO add mul
         coords->state = TOUCH_PANEL_PRESSED;
         ctx.last_x = coords->x;
         ctx.last_y = coords->y;
-    } 
+    }
     else {
         coords->x = ctx.last_x;
         coords->y = ctx.last_y;
         coords->state = TOUCH_PANEL_RELEASED;
     }
 
-    /* Clear status register */
+    /* Clear status register, GT911 releases INT and reports again */
     status_reg = 0;
+    touch_panel_count(&ctx.stats.i2c_transactions, 1);
     err = i2c_write(ctx.i2c_address, GT911_TOUCH_STATUS_REG, GT911_REG_ADDR_SIZE_BYTES, &status_reg, sizeof(status_reg));
     if (err != ESP_OK) {
         return TOUCH_PANEL_I2C_ERROR;
     }
     return TOUCH_PANEL_OK;
 }
+
+static void touch_panel_queue_event(const touch_panel_coords_t *coords)
+{
+    /* Moves in between may be lost, the newest event, releases included, never is */
+    if (xQueueSend(ctx.event_queue, coords, 0) != pdTRUE) {
+        touch_panel_coords_t oldest;
+        xQueueReceive(ctx.event_queue, &oldest, 0);
+        xQueueSend(ctx.event_queue, coords, 0);
+        touch_panel_count(&ctx.stats.events_dropped, 1);
+    }
+    ctx.last_queued_state = coords->state;
+}
+
+static void touch_panel_count(uint32_t *counter, uint32_t value)
+{
+    taskENTER_CRITICAL(&ctx.lock);
+    *counter += value;
+    taskEXIT_CRITICAL(&ctx.lock);
+}
+
+static void touch_panel_irq_isr(void *arg)
+{
+    /* Level interrupt would fire until the status is cleared over I2C, the task enables it again.
+     * ISR service is not in IRAM, so the driver function can be called from flash. */
+    gpio_intr_disable(TOUCH_PANEL_IRQ_PIN);
+
+    BaseType_t should_yield = pdFALSE;
+    vTaskNotifyGiveFromISR(ctx.task, &should_yield);
+    portYIELD_FROM_ISR(should_yield);
+}
+
+static void touch_panel_task(void *arg)
+{
+    while (1) {
+        /* Release is reported with one more interrupt, the timeout only covers a missed one */
+        const TickType_t timeout = (ctx.last_queued_state == TOUCH_PANEL_PRESSED) ? pdMS_TO_TICKS(TOUCH_PANEL_RELEASE_TIMEOUT_MS) : portMAX_DELAY;
+        const bool is_interrupt = (ulTaskNotifyTake(pdTRUE, timeout) != 0);
+        touch_panel_count(is_interrupt ? &ctx.stats.interrupts : &ctx.stats.timeouts, 1);
+
+        touch_panel_coords_t coords;
+        bool is_valid;
+        const touch_panel_err_t err = touch_panel_read(&coords, &is_valid);
+        if (err != TOUCH_PANEL_OK) {
+            ESP_LOGE(TAG, "Failed to read touch panel, error: %d", err);
+        }
+        else if (is_valid) {
+            touch_panel_queue_event(&coords);
+        }
+        else if (!is_interrupt) {
+            coords = (touch_panel_coords_t){ctx.last_x, ctx.last_y, TOUCH_PANEL_RELEASED};
+            touch_panel_queue_event(&coords);
+        }
+
+        if (is_interrupt) {
+            gpio_intr_enable(TOUCH_PANEL_IRQ_PIN);
+        }
+    }
+}
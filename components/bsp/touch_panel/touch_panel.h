@@ -6,6 +6,7 @@ extern "C" {
 
 #include "i2c.h"
 #include <stdint.h>
+#include <stdbool.h>
 #include <esp_err.h>
 
 #define TOUCH_PANEL_WIDTH 540
@@ -16,6 +17,14 @@ extern "C" {
 
 #define TOUCH_PANEL_MAX_CONCURRENT_POINTS 2 // GT911 should allow for 5, but predefined M5Paper config enables only 2
 
+#define TOUCH_PANEL_TASK_STACK_SIZE (1024 * 3) // bytes
+#define TOUCH_PANEL_TASK_CORE_AFFINITY 0
+#define TOUCH_PANEL_TASK_PRIORITY 1 // Above LVGL task, so that events are queued while it draws
+#define TOUCH_PANEL_TASK_NAME "touch_panel"
+
+#define TOUCH_PANEL_EVENT_QUEUE_LENGTH 8
+#define TOUCH_PANEL_RELEASE_TIMEOUT_MS 100 // GT911 reports each 10ms while touched, no report for that long means release
+
 typedef enum 
 {
     TOUCH_PANEL_ROTATION_0, 
@@ -47,8 +56,23 @@ typedef struct
     touch_panel_state_t state;
 } touch_panel_coords_t;
 
+typedef struct
+{
+    uint32_t interrupts;       // Reads triggered by the INT line
+    uint32_t timeouts;         // Reads after no report came while touched
+    uint32_t i2c_transactions; // All done by the driver
+    uint32_t input_reads;      // Events taken by the input device, each cost at least one transaction when polled
+    uint32_t events_dropped;   // Oldest events dropped when the queue was full
+} touch_panel_stats_t;
+
 touch_panel_err_t touch_panel_init(touch_panel_rotation_t rotation);
-touch_panel_err_t touch_get_coords(touch_panel_coords_t *coords);
+
+/* Takes the oldest touch event from the queue, if it's empty - repeats the last one. Doesn't access
+ * the bus, reads are done by the driver task when GT911 signals new data. Returns whether more events
+ * are queued. */
+bool touch_panel_get_event(touch_panel_coords_t *coords);
+
+void touch_panel_get_stats(touch_panel_stats_t *stats);
 
 #ifdef __cplusplus
 }
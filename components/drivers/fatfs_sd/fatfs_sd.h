@@ -10,7 +10,10 @@ extern "C" {
 #define FATFS_SD_SPI_CLOCK_SPEED_KHZ 1000 // 1MHz
 
 #define FATFS_SD_ROOT_PATH "/sdcard"
-#define FATFS_SD_MAX_FILES_NUM 2
+/* Worst case of files open at once: the book read by the UI, its search index and the font files handle;
+ * one file the UI task is writing (open state, settings, image cache or glyph atlas); the book and a cache
+ * file of the indexer; the book and the thumbnail file of the thumbnail cache. Fonts don't keep their files open. */
+#define FATFS_SD_MAX_FILES_NUM 8
 #define FATFS_SD_ALLOCATION_UNIT_SIZE 0 // Use sector size
 
 esp_err_t fatfs_sd_init(void);
@@ -0,0 +1,248 @@
+#include "power_manager.h"
+#include <touch_panel.h>
+#include <utils.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <esp_system.h>
+#include <esp_log.h>
+#include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+
+#define TAG __FILENAME__
+
+typedef struct
+{
+    esp_pm_lock_handle_t cpu_lock;
+    power_manager_state_t state;
+    int64_t state_start_us;
+    power_manager_stats_t stats;
+    uint64_t residency_at_wakeup_us[POWER_MANAGER_STATES_COUNT]; // To report the time spent since the previous wakeup
+    portMUX_TYPE lock;
+} power_manager_ctx_t;
+
+static power_manager_ctx_t ctx = {
+    .lock = portMUX_INITIALIZER_UNLOCKED
+};
+
+static const gpio_num_t button_pins[] = {
+    POWER_MANAGER_BUTTON_LEFT_PIN, 
+    POWER_MANAGER_BUTTON_PUSH_PIN, 
+    POWER_MANAGER_BUTTON_RIGHT_PIN
+};
+
+static const char *const wakeup_names[POWER_MANAGER_WAKEUPS_COUNT] = {"timer", "touch", "button", "other"};
+
+static esp_err_t power_manager_wakeup_init(void);
+static void power_manager_enter_state(power_manager_state_t state);
+static power_manager_wakeup_t power_manager_get_wakeup_cause(void);
+static void power_manager_log_wakeup(power_manager_wakeup_t wakeup);
+
+/* Public functions */
+esp_err_t power_manager_init(void)
+{
+    /* Frequency is scaled only between the locks, light sleep is entered explicitly by the UI task */
+    const esp_pm_config_t pm_config = {
+        .max_freq_mhz = POWER_MANAGER_CPU_FREQ_MAX_MHZ,
+        .min_freq_mhz = POWER_MANAGER_CPU_FREQ_MIN_MHZ,
+        .light_sleep_enable = false
+    };
+    esp_err_t err = esp_pm_configure(&pm_config);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    err = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "ui", &ctx.cpu_lock);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    /* PSRAM holds the draw buffers, fonts and caches, its supply must stay on in light sleep */
+    err = esp_sleep_pd_config(ESP_PD_DOMAIN_VDDSDIO, ESP_PD_OPTION_ON);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    err = power_manager_wakeup_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    /* Starts as active, the UI is about to be drawn */
+    ctx.state = POWER_MANAGER_STATE_BACKGROUND;
+    ctx.state_start_us = esp_timer_get_time();
+    power_manager_enter_state(POWER_MANAGER_STATE_ACTIVE);
+    return ESP_OK;
+}
+
+void power_manager_set_active(bool active)
+{
+    power_manager_enter_state(active ? POWER_MANAGER_STATE_ACTIVE : POWER_MANAGER_STATE_BACKGROUND);
+}
+
+power_manager_wakeup_t power_manager_sleep(uint64_t timeout_us)
+{
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+    if (timeout_us > 0) {
+        const esp_err_t err = esp_sleep_enable_timer_wakeup(timeout_us);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to set sleep timer, error %d", err);
+        }
+    }
+
+    power_manager_enter_state(POWER_MANAGER_STATE_LIGHT_SLEEP);
+    const esp_err_t err = esp_light_sleep_start();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to enter light sleep, error %d", err);
+    }
+    power_manager_enter_state(POWER_MANAGER_STATE_ACTIVE);
+
+    const power_manager_wakeup_t wakeup = (err == ESP_OK) ? power_manager_get_wakeup_cause() : POWER_MANAGER_WAKEUP_OTHER;
+    power_manager_log_wakeup(wakeup);
+    return wakeup;
+}
+
+void power_manager_hibernate(void)
+{
+    /* Light sleep wake sources don't work in deep sleep, RTC ones have to be used. Ext1 on ESP32 can only
+     * wake when all its pins are low, so it's given just the push button. */
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+    esp_err_t err = esp_sleep_enable_ext0_wakeup(TOUCH_PANEL_IRQ_PIN, 0);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to enable touch wakeup, error %d", err);
+    }
+    err = esp_sleep_enable_ext1_wakeup(1ULL << POWER_MANAGER_BUTTON_PUSH_PIN, ESP_EXT1_WAKEUP_ALL_LOW);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to enable button wakeup, error %d", err);
+    }
+
+    power_manager_stats_t stats;
+    power_manager_get_stats(&stats);
+    ESP_LOGI(TAG, "Hibernating after %llus, active %llums", 
+             (stats.residency_us[POWER_MANAGER_STATE_ACTIVE] + stats.residency_us[POWER_MANAGER_STATE_BACKGROUND] + 
+              stats.residency_us[POWER_MANAGER_STATE_LIGHT_SLEEP]) / (1000 * 1000), stats.residency_us[POWER_MANAGER_STATE_ACTIVE] / 1000);
+
+    esp_deep_sleep_start();
+}
+
+bool power_manager_is_resumed(void)
+{
+    return esp_reset_reason() == ESP_RST_DEEPSLEEP;
+}
+
+void power_manager_get_stats(power_manager_stats_t *stats)
+{
+    taskENTER_CRITICAL(&ctx.lock);
+    *stats = ctx.stats;
+    stats->residency_us[ctx.state] += esp_timer_get_time() - ctx.state_start_us;
+    taskEXIT_CRITICAL(&ctx.lock);
+}
+
+/* Private functions */
+static esp_err_t power_manager_wakeup_init(void)
+{
+    esp_err_t err = gpio_wakeup_enable(TOUCH_PANEL_IRQ_PIN, GPIO_INTR_LOW_LEVEL);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    /* Buttons are input only pins without internal pulls */
+    uint64_t pin_mask = 0;
+    for (size_t i = 0; i < ARRAY_SIZE(button_pins); ++i) {
+        pin_mask |= (1ULL << button_pins[i]);
+    }
+    const gpio_config_t gpio_cfg = {
+        .pin_bit_mask = pin_mask,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE
+    };
+    err = gpio_config(&gpio_cfg);
+    if (err != ESP_OK) {
+        return err;
+    }
+    for (size_t i = 0; i < ARRAY_SIZE(button_pins); ++i) {
+        err = gpio_wakeup_enable(button_pins[i], GPIO_INTR_LOW_LEVEL);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    return esp_sleep_enable_gpio_wakeup();
+}
+
+static void power_manager_enter_state(power_manager_state_t state)
+{
+    if (state == ctx.state) {
+        return;
+    }
+
+    /* Lock is held only in active state, DFS lowers the frequency otherwise */
+    if (state == POWER_MANAGER_STATE_ACTIVE) {
+        esp_pm_lock_acquire(ctx.cpu_lock);
+    }
+    else if (ctx.state == POWER_MANAGER_STATE_ACTIVE) {
+        esp_pm_lock_release(ctx.cpu_lock);
+    }
+
+    const int64_t now_us = esp_timer_get_time();
+    taskENTER_CRITICAL(&ctx.lock);
+    ctx.stats.residency_us[ctx.state] += now_us - ctx.state_start_us;
+    ctx.state = state;
+    ctx.state_start_us = now_us;
+    taskEXIT_CRITICAL(&ctx.lock);
+}
+
+static power_manager_wakeup_t power_manager_get_wakeup_cause(void)
+{
+    switch (esp_sleep_get_wakeup_cause()) {
+        case ESP_SLEEP_WAKEUP_TIMER:
+            return POWER_MANAGER_WAKEUP_TIMER;
+
+        case ESP_SLEEP_WAKEUP_GPIO:
+            /* Source is not latched, the level still held is checked instead */
+            if (gpio_get_level(TOUCH_PANEL_IRQ_PIN) == 0) {
+                return POWER_MANAGER_WAKEUP_TOUCH;
+            }
+            for (size_t i = 0; i < ARRAY_SIZE(button_pins); ++i) {
+                if (gpio_get_level(button_pins[i]) == 0) {
+                    return POWER_MANAGER_WAKEUP_BUTTON;
+                }
+            }
+            return POWER_MANAGER_WAKEUP_OTHER;
+
+        default:
+            return POWER_MANAGER_WAKEUP_OTHER;
+    }
+}
+
+static void power_manager_log_wakeup(power_manager_wakeup_t wakeup)
+{
+    taskENTER_CRITICAL(&ctx.lock);
+    ctx.stats.wakeups[wakeup]++;
+    taskEXIT_CRITICAL(&ctx.lock);
+
+    power_manager_stats_t stats;
+    power_manager_get_stats(&stats);
+
+    /* Time since the previous wakeup is what one page turn costs, the totals give the average */
+    uint64_t since_us[POWER_MANAGER_STATES_COUNT];
+    uint64_t total_us = 0;
+    for (size_t i = 0; i < POWER_MANAGER_STATES_COUNT; ++i) {
+        since_us[i] = stats.residency_us[i] - ctx.residency_at_wakeup_us[i];
+        ctx.residency_at_wakeup_us[i] = stats.residency_us[i];
+        total_us += stats.residency_us[i];
+    }
+    if (total_us == 0) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "Woken by %s, since previous wakeup: active %llums, background %llums, sleep %llums", 
+             wakeup_names[wakeup], since_us[POWER_MANAGER_STATE_ACTIVE] / 1000, since_us[POWER_MANAGER_STATE_BACKGROUND] / 1000, 
+             since_us[POWER_MANAGER_STATE_LIGHT_SLEEP] / 1000);
+    ESP_LOGI(TAG, "Residency: active %llu%%, background %llu%%, sleep %llu%%; wakeups: timer %lu, touch %lu, button %lu, other %lu",
+             (stats.residency_us[POWER_MANAGER_STATE_ACTIVE] * 100) / total_us, (stats.residency_us[POWER_MANAGER_STATE_BACKGROUND] * 100) / total_us,
+             (stats.residency_us[POWER_MANAGER_STATE_LIGHT_SLEEP] * 100) / total_us, stats.wakeups[POWER_MANAGER_WAKEUP_TIMER],
+             stats.wakeups[POWER_MANAGER_WAKEUP_TOUCH], stats.wakeups[POWER_MANAGER_WAKEUP_BUTTON], stats.wakeups[POWER_MANAGER_WAKEUP_OTHER]);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <esp_err.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CPU runs at the lower frequency whenever the UI doesn't hold it at the higher one. APB clock is 80MHz
+ * at both, so SPI and I2C transfers are not affected. */
+#define POWER_MANAGER_CPU_FREQ_MAX_MHZ 240
+#define POWER_MANAGER_CPU_FREQ_MIN_MHZ 80
+
+/* M5Paper side buttons, active low with external pull-ups */
+#define POWER_MANAGER_BUTTON_LEFT_PIN 37
+#define POWER_MANAGER_BUTTON_PUSH_PIN 38
+#define POWER_MANAGER_BUTTON_RIGHT_PIN 39
+
+typedef enum
+{
+    POWER_MANAGER_STATE_ACTIVE,     // UI handles input or draws, CPU at max. frequency
+    POWER_MANAGER_STATE_BACKGROUND, // Only background tasks work, CPU at min. frequency
+    POWER_MANAGER_STATE_LIGHT_SLEEP,
+    POWER_MANAGER_STATES_COUNT
+} power_manager_state_t;
+
+typedef enum
+{
+    POWER_MANAGER_WAKEUP_TIMER,
+    POWER_MANAGER_WAKEUP_TOUCH,
+    POWER_MANAGER_WAKEUP_BUTTON,
+    POWER_MANAGER_WAKEUP_OTHER,
+    POWER_MANAGER_WAKEUPS_COUNT
+} power_manager_wakeup_t;
+
+typedef struct
+{
+    uint64_t residency_us[POWER_MANAGER_STATES_COUNT];
+    uint32_t wakeups[POWER_MANAGER_WAKEUPS_COUNT];
+} power_manager_stats_t;
+
+esp_err_t power_manager_init(void);
+
+/* Switches between active and background state */
+void power_manager_set_active(bool active);
+
+/* Light sleep until any of the wake sources or the timeout, 0 for none. Memory, PSRAM included, and
+ * peripherals keep their state. Returns in active state. */
+power_manager_wakeup_t power_manager_sleep(uint64_t timeout_us);
+
+/* Deep sleep until the touch panel or the push button is pressed, the timer is not used. Only RTC memory
+ * keeps its contents, the device boots again from the start. Never returns. */
+void power_manager_hibernate(void);
+
+/* Boot is a wakeup from hibernation */
+bool power_manager_is_resumed(void);
+
+void power_manager_get_stats(power_manager_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
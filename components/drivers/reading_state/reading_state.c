@@ -0,0 +1,112 @@
+#include "reading_state.h"
+#include <nvs_flash.h>
+#include <nvs.h>
+#include <string.h>
+#include <esp_log.h>
+#include <esp_attr.h>
+
+#define TAG __FILENAME__
+
+#define READING_STATE_RTC_MAGIC 0x54535452 // "RTST"
+
+typedef struct
+{
+    uint32_t magic;
+    reading_state_t state;
+} reading_state_rtc_t;
+
+static nvs_handle_t handle;
+static reading_state_t last_saved_state;
+
+/* Copy in RTC memory survives deep sleep, not power loss, so it's initialized again on cold boot.
+ * Waking from hibernation gets the state from it without reading NVS. */
+static RTC_DATA_ATTR reading_state_rtc_t rtc_state;
+
+esp_err_t reading_state_init(void)
+{
+    esp_err_t err = nvs_flash_init();
+    if ((err == ESP_ERR_NVS_NO_FREE_PAGES) || (err == ESP_ERR_NVS_NEW_VERSION_FOUND)) {
+        ESP_LOGW(TAG, "NVS partition needs to be erased, error: %s", esp_err_to_name(err));
+        err = nvs_flash_erase();
+        if (err != ESP_OK) {
+            return err;
+        }
+        err = nvs_flash_init();
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    return nvs_open(READING_STATE_NVS_NAMESPACE, NVS_READWRITE, &handle);
+}
+
+esp_err_t reading_state_save(const reading_state_t *state)
+{
+    if (state == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* Page turns back and forth often land on an already saved position, don't wear the flash then */
+    if (memcmp(state, &last_saved_state, sizeof(*state)) == 0) {
+        return ESP_OK;
+    }
+
+    rtc_state.state = *state;
+    rtc_state.magic = READING_STATE_RTC_MAGIC;
+
+    /* Whole state is a single blob - NVS keeps the old value valid until the new one is fully written,
+     * so power loss in the middle of the write can't mix position of one book with path of another */
+    esp_err_t err = nvs_set_blob(handle, READING_STATE_NVS_KEY, state, sizeof(*state));
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    err = nvs_commit(handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    memcpy(&last_saved_state, state, sizeof(last_saved_state));
+    return ESP_OK;
+}
+
+esp_err_t reading_state_load(reading_state_t *state)
+{
+    if (state == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (rtc_state.magic == READING_STATE_RTC_MAGIC) {
+        memcpy(state, &rtc_state.state, sizeof(*state));
+        memcpy(&last_saved_state, state, sizeof(last_saved_state));
+        return ESP_OK;
+    }
+
+    size_t size = sizeof(*state);
+    const esp_err_t err = nvs_get_blob(handle, READING_STATE_NVS_KEY, state, &size);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    /* Blob written by different firmware version */
+    if (size != sizeof(*state)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    state->book_path[READING_STATE_BOOK_PATH_MAX_LENGTH - 1] = '\0';
+
+    memcpy(&last_saved_state, state, sizeof(last_saved_state));
+    return ESP_OK;
+}
+
+esp_err_t reading_state_clear(void)
+{
+    memset(&last_saved_state, 0, sizeof(last_saved_state));
+    rtc_state.magic = 0;
+
+    const esp_err_t err = nvs_erase_key(handle, READING_STATE_NVS_KEY);
+    if ((err != ESP_OK) && (err != ESP_ERR_NVS_NOT_FOUND)) {
+        return err;
+    }
+
+    return nvs_commit(handle);
+}
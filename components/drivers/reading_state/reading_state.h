@@ -0,0 +1,30 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <esp_err.h>
+#include <stdint.h>
+
+#define READING_STATE_NVS_NAMESPACE "reader"
+#define READING_STATE_NVS_KEY "state"
+
+#define READING_STATE_BOOK_PATH_MAX_LENGTH 256 // Including null terminator
+
+typedef struct
+{
+    char book_path[READING_STATE_BOOK_PATH_MAX_LENGTH];
+    uint32_t spine_index;
+    uint32_t block_index;
+    uint32_t byte_offset;
+} reading_state_t;
+
+esp_err_t reading_state_init(void);
+esp_err_t reading_state_save(const reading_state_t *state);
+esp_err_t reading_state_load(reading_state_t *state);
+esp_err_t reading_state_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
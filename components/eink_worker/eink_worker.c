@@ -2,6 +2,7 @@
 #include <esp_log.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
+#include <string.h>
 
 #define TAG __FILENAME__
 
@@ -20,6 +21,7 @@ typedef struct
     size_t y;
     size_t w;
     size_t h;
+    bool grayscale;
 } eink_op_t;
 
 typedef struct
@@ -28,17 +30,30 @@ typedef struct
     QueueHandle_t operation_queue;
     uint8_t fast_refresh_count;
     bool is_busy;
+    bool is_standby;
+    bool grayscale;
+    bool gray_pixels_written;
+    bool is_dirty;
+    size_t dirty_x1; // Bounding box of the writes since the last refresh
+    size_t dirty_y1;
+    size_t dirty_x2;
+    size_t dirty_y2;
+    uint8_t color_levels[1 << LV_COLOR_DEPTH];
+    lv_color_t level_colors[EINK_WORKER_GRAY_LEVELS];
 } eink_worker_ctx;
 
 static eink_worker_ctx ctx;
 
+static void eink_worker_init_gray_levels(void);
+static void eink_worker_add_dirty_area(size_t x, size_t y, size_t w, size_t h);
 static void eink_worker_refresh_screen(void);
-static void eink_worker_transform_pixel_map(lv_color_t *px_map, size_t size);
+static void eink_worker_transform_pixel_map(lv_color_t *px_map, size_t size, bool grayscale);
 static void eink_worker(void *arg);
 
 eink_err_t eink_worker_start(void (*on_ready)(void))
 {
     ctx.on_ready = on_ready;
+    eink_worker_init_gray_levels();
 
     ctx.operation_queue = xQueueCreate(EINK_WORKER_OPERATION_QUEUE_LENGTH, sizeof(eink_op_t));
     if (ctx.operation_queue == NULL) {
@@ -57,7 +72,8 @@ void eink_worker_write(size_t x, size_t y, size_t w, size_t h, lv_color_t *px_ma
         .y = y,
         .w = w,
         .h = h,
-        .px_map = px_map
+        .px_map = px_map,
+        .grayscale = ctx.grayscale // Mode at the time of drawing, it may change before the write is processed
     };
    
     if (xQueueSend(ctx.operation_queue, &operation, portMAX_DELAY) == pdFALSE) { // TODO timeout handling
@@ -81,27 +97,109 @@ bool eink_worker_idle(void)
     return !ctx.is_busy;
 }
 
+void eink_worker_set_grayscale(bool enabled)
+{
+    ctx.grayscale = enabled;
+}
+
+lv_color_t eink_worker_gray_color(uint8_t level)
+{
+    return ctx.level_colors[(level < EINK_WORKER_GRAY_LEVELS) ? level : (EINK_WORKER_GRAY_LEVELS - 1)];
+}
+
 /* Private functions */
+static void eink_worker_init_gray_levels(void)
+{
+    /* Gray level of each RGB332 color from its luma, the color representing a level is the least saturated one */
+    uint8_t level_chroma[EINK_WORKER_GRAY_LEVELS];
+    memset(level_chroma, UINT8_MAX, sizeof(level_chroma));
+
+    for (uint32_t i = 0; i < sizeof(ctx.color_levels); ++i) {
+        const lv_color_t color = {.full = i};
+        const uint8_t red = (LV_COLOR_GET_R(color) * 255) / 7;
+        const uint8_t green = (LV_COLOR_GET_G(color) * 255) / 7;
+        const uint8_t blue = (LV_COLOR_GET_B(color) * 255) / 3;
+        const uint8_t luma = ((red * 77) + (green * 150) + (blue * 29)) >> 8;
+        const uint8_t level = ((luma * (EINK_WORKER_GRAY_LEVELS - 1)) + 127) / 255;
+        const uint8_t chroma = LV_MAX(red, LV_MAX(green, blue)) - LV_MIN(red, LV_MIN(green, blue));
+
+        ctx.color_levels[i] = level;
+        if (chroma < level_chroma[level]) {
+            level_chroma[level] = chroma;
+            ctx.level_colors[level] = color;
+        }
+    }
+}
+
+static void eink_worker_add_dirty_area(size_t x, size_t y, size_t w, size_t h)
+{
+    if (!ctx.is_dirty) {
+        ctx.dirty_x1 = x;
+        ctx.dirty_y1 = y;
+        ctx.dirty_x2 = x + w;
+        ctx.dirty_y2 = y + h;
+        ctx.is_dirty = true;
+        return;
+    }
+
+    ctx.dirty_x1 = LV_MIN(ctx.dirty_x1, x);
+    ctx.dirty_y1 = LV_MIN(ctx.dirty_y1, y);
+    ctx.dirty_x2 = LV_MAX(ctx.dirty_x2, x + w);
+    ctx.dirty_y2 = LV_MAX(ctx.dirty_y2, y + h);
+}
+
 static void eink_worker_refresh_screen(void)
 {
-    if (ctx.fast_refresh_count >= EINK_WORKER_FAST_PER_DEEP_REFRESHES) {
+    /* Nothing written, nothing to show */
+    if (!ctx.is_dirty) {
+        return;
+    }
+
+    /* Only the written area is refreshed, x and width stay aligned as the writes are */
+    const size_t x = ctx.dirty_x1;
+    const size_t y = ctx.dirty_y1;
+    const size_t w = ctx.dirty_x2 - ctx.dirty_x1;
+    const size_t h = ctx.dirty_y2 - ctx.dirty_y1;
+    const bool is_small = (w * h) <= EINK_WORKER_SMALL_REFRESH_MAX_AREA;
+    ctx.is_dirty = false;
+
+    if (ctx.gray_pixels_written) {
+        ESP_LOGI(TAG, "Refreshing with GC16 to show gray levels");
+        eink_refresh(x, y, w, h, EINK_UPDATE_MODE_GC16);
+        ctx.gray_pixels_written = false;
+        if (!is_small) {
+            ctx.fast_refresh_count = 0;
+        }
+    }
+    else if (is_small) {
+        /* Small areas like the status bar ghost only locally, they don't bring the deep refresh closer */
+        ESP_LOGI(TAG, "Refreshing %zux%zu area with DU", w, h);
+        eink_refresh(x, y, w, h, EINK_UPDATE_MODE_DU);
+    }
+    else if (ctx.fast_refresh_count >= EINK_WORKER_FAST_PER_DEEP_REFRESHES) {
         ESP_LOGI(TAG, "Refreshing with GC16");
         eink_refresh_full(EINK_UPDATE_MODE_GC16);
         ctx.fast_refresh_count = 0;
     }
     else {
         ESP_LOGI(TAG, "Refreshing with DU");
-        eink_refresh_full(EINK_UPDATE_MODE_DU);
+        eink_refresh(x, y, w, h, EINK_UPDATE_MODE_DU);
         ctx.fast_refresh_count++;
     }
 }
 
-static void eink_worker_transform_pixel_map(lv_color_t *px_map, size_t size)
+static void eink_worker_transform_pixel_map(lv_color_t *px_map, size_t size, bool grayscale)
 {
     for (size_t i = 0; i < size; ++i) {
         const size_t byte_index = i / EINK_PIXELS_PER_BYTE;
         const uint8_t px_index = i % EINK_PIXELS_PER_BYTE;
-        const uint8_t px_brightness = (px_map[i].full > 0) ? EINK_PIXEL_WHITE : EINK_PIXEL_BLACK; // Only monochrome supported
+        uint8_t px_brightness;
+        if (grayscale) {
+            px_brightness = ctx.color_levels[px_map[i].full];
+        }
+        else {
+            px_brightness = (px_map[i].full > 0) ? EINK_PIXEL_WHITE : EINK_PIXEL_BLACK;
+        }
         
         if (px_index) {
             px_map[byte_index].full &= ~EINK_PIXEL_WHITE;
@@ -118,9 +216,11 @@ static void eink_worker(void *arg)
 {
     ESP_LOGI(TAG, "eink_worker started!");
 
-    /* Set initial state */
-    ctx.fast_refresh_count = 0;
+    /* Set initial state, first refresh is a deep one, the controller may not know what the panel shows */
+    ctx.fast_refresh_count = EINK_WORKER_FAST_PER_DEEP_REFRESHES;
     ctx.is_busy = false;
+    ctx.is_standby = false;
+    ctx.is_dirty = false;
 
     /* Main loop */
     while (1) {
@@ -132,9 +232,16 @@ static void eink_worker(void *arg)
 
         ctx.is_busy = true;
 
+        if (ctx.is_standby) {
+            eink_wakeup();
+            ctx.is_standby = false;
+        }
+
         switch (operation.type) {
             case EINK_TASK_WRITE:
-                eink_worker_transform_pixel_map(operation.px_map, operation.w * operation.h);
+                eink_worker_transform_pixel_map(operation.px_map, operation.w * operation.h, operation.grayscale);
+                ctx.gray_pixels_written |= operation.grayscale;
+                eink_worker_add_dirty_area(operation.x, operation.y, operation.w, operation.h);
                 eink_write(operation.x, operation.y, operation.w, operation.h, (const uint8_t *)operation.px_map);
                 break;
             
@@ -149,6 +256,11 @@ static void eink_worker(void *arg)
 
         if ((uxQueueMessagesWaiting(ctx.operation_queue) == 0) && (ctx.on_ready != NULL)) {
             ctx.on_ready();
+
+            /* Controller idles in standby until the next page, still busy meanwhile, so that nothing else talks to it */
+            if ((operation.type == EINK_TASK_REFRESH) && (uxQueueMessagesWaiting(ctx.operation_queue) == 0)) {
+                ctx.is_standby = (eink_standby() == EINK_OK);
+            }
             ctx.is_busy = false;
         }
     }
@@ -13,6 +13,8 @@ extern "C" {
 
 #define EINK_WORKER_OPERATION_QUEUE_LENGTH 2 // Max. two operations can be simultaneously queued - write and refresh
 #define EINK_WORKER_FAST_PER_DEEP_REFRESHES 12 // Number of fast refreshes between two deep refreshes
+#define EINK_WORKER_SMALL_REFRESH_MAX_AREA ((EINK_DISPLAY_WIDTH * EINK_DISPLAY_HEIGHT) / 8) // Small refreshes don't count as fast ones
+#define EINK_WORKER_GRAY_LEVELS 16
 
 eink_err_t eink_worker_start(void (*on_ready)(void));
 // void eink_worker_stop(); // TODO
@@ -22,6 +24,11 @@ void eink_worker_refresh(void);
 
 bool eink_worker_idle(void);
 
+/* In grayscale mode pixels written from now on keep their luminance instead of being
+ * thresholded to black and white, and the refresh showing them is always GC16 */
+void eink_worker_set_grayscale(bool enabled);
+lv_color_t eink_worker_gray_color(uint8_t level); // Color drawn as given gray level in grayscale mode
+
 #ifdef __cplusplus
 }
 #endif
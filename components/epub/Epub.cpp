@@ -3,14 +3,143 @@
 #include <UniqueMptr.hpp>
 #include <pugixml/pugixml.hpp>
 #include <esp_log.h>
+#include <sys/stat.h>
 #include <map>
+#include <mutex>
+#include <cstdio>
 #include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
 
 #define TAG __FILENAME__
 
 using namespace constants::epub;
 
-Epub::Epub(const std::filesystem::path &path)
+namespace
+{
+    /* Checks if space-separated attribute value (e.g. OPF properties) contains given token */
+    auto hasToken(std::string_view tokens, std::string_view token) -> bool
+    {
+        std::size_t start = 0;
+        while (start < tokens.size()) {
+            auto end = tokens.find(' ', start);
+            if (end == std::string_view::npos) {
+                end = tokens.size();
+            }
+            if (tokens.substr(start, end - start) == token) {
+                return true;
+            }
+            start = end + 1;
+        }
+        return false;
+    }
+
+    auto resolveHref(const std::filesystem::path &basePath, std::string_view href) -> std::filesystem::path
+    {
+        const auto hrefNoAnchor = href.substr(0, href.find('#')); // TODO anchor-based navigation is not supported yet
+        if (hrefNoAnchor.empty()) {
+            return {};
+        }
+        return (basePath / hrefNoAnchor).lexically_normal();
+    }
+
+    auto appendNodeText(const pugi::xml_node &node, std::string &text) -> void
+    {
+        for (const auto &child : node.children()) {
+            if (child.type() != pugi::xml_node_type::node_pcdata) {
+                appendNodeText(child, text);
+                continue;
+            }
+
+            /* Collapse whitespace runs to single space */
+            for (const auto c : std::string_view{child.value()}) {
+                if (!std::isspace(static_cast<unsigned char>(c))) {
+                    text += c;
+                }
+                else if (!text.empty() && (text.back() != ' ')) {
+                    text += ' ';
+                }
+            }
+        }
+    }
+
+    /* TOC is parsed recursively on small task stacks, entries at this depth are taken as leaves */
+    constexpr auto maxTocDepth = std::uint16_t{32};
+
+    /* Open state file layout: header, cover path, language, spine paths, TOC entries, TOC string pool.
+     * Strings are stored with their 16-bit length. */
+    constexpr auto openStateExtension = ".open";
+    constexpr auto openStateMagic = std::uint32_t{0x4E504F45}; // "EOPN"
+    constexpr auto openStateVersion = std::uint32_t{2};
+
+    struct OpenStateHeader
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t bookSize;
+        std::uint32_t bookTime; // Modification time
+        std::uint32_t spineCount;
+        std::uint32_t tocCount;
+        std::uint32_t tocStringPoolSize;
+    };
+
+    std::mutex openStateMutex; // Book is often opened by UI and indexer at once, only one of them writes the file
+
+    auto getOpenStatePath(const std::filesystem::path &bookPath) -> std::filesystem::path
+    {
+        /* Hidden file next to the book, files list does not show it */
+        return bookPath.parent_path() / ("." + bookPath.filename().string() + openStateExtension);
+    }
+
+    auto getFileSize(const std::filesystem::path &path) -> std::uint32_t
+    {
+        struct stat fileStat;
+        if (stat(path.c_str(), &fileStat) != 0) {
+            return 0;
+        }
+        return fileStat.st_size;
+    }
+
+    auto getFileTime(const std::filesystem::path &path) -> std::uint32_t
+    {
+        struct stat fileStat;
+        if (stat(path.c_str(), &fileStat) != 0) {
+            return 0;
+        }
+        return static_cast<std::uint32_t>(fileStat.st_mtime);
+    }
+
+    auto writeString(std::FILE *file, std::string_view string) -> bool
+    {
+        const auto length = static_cast<std::uint16_t>(string.size());
+        return (string.size() <= UINT16_MAX) && (std::fwrite(&length, sizeof(length), 1, file) == 1) && 
+               (std::fwrite(string.data(), 1, length, file) == length);
+    }
+
+    auto readString(std::FILE *file, std::string &string) -> bool
+    {
+        std::uint16_t length;
+        if (std::fread(&length, sizeof(length), 1, file) != 1) {
+            return false;
+        }
+        string.resize(length);
+        return std::fread(string.data(), 1, length, file) == length;
+    }
+
+    /* Concatenates all text inside the node, e.g. nav label with nested span */
+    auto getNodeText(const pugi::xml_node &node) -> std::string
+    {
+        std::string text;
+        appendNodeText(node, text);
+        if (!text.empty() && (text.back() == ' ')) {
+            text.pop_back();
+        }
+        return text;
+    }
+}
+
+Epub::Epub(const std::filesystem::path &path) : path{path}
 {
     /* Open file */
     mz_zip_zero_struct(&zip);
@@ -18,23 +147,16 @@ Epub::Epub(const std::filesystem::path &path)
         throw std::runtime_error{std::string{"failed to open file "} + path.c_str()};
     }
 
-    /* Get OPF file path */
-    const auto &contentOpfPath = getContentOpfPath();
-    if (contentOpfPath.empty()) {
-        throw std::runtime_error{"failed to get OPF file path"};
+    /* Parsing OPF and TOC takes most of the time, their results are kept from the previous opening */
+    const auto bookSize = getFileSize(path);
+    const auto bookTime = getFileTime(path);
+    if (loadOpenState(bookSize, bookTime)) {
+        return;
     }
 
-    /* Parse OPF file */
-    const auto &rootPath = getRootDirectoryPath(contentOpfPath);
-    const auto &ncxPath = parseContentOpf(contentOpfPath, rootPath);
-    if (ncxPath.empty()) {
-        throw std::runtime_error{"failed to get NCX file path"};
-    }
-
-    /* Parse NCX file */
-    const auto ncxStatus = parseTocNcx(ncxPath, rootPath);
-    if (!ncxStatus) {
-        throw std::runtime_error{std::string{"failed to parse NCX file "} + ncxPath.c_str()};
+    parse();
+    if (!saveOpenState(bookSize, bookTime)) {
+        ESP_LOGW(TAG, "Failed to save open state of '%s'", path.c_str());
     }
 }
 
@@ -43,11 +165,52 @@ Epub::~Epub() noexcept
     mz_zip_reader_end(&zip);
 }
 
+auto Epub::getPath() const -> const std::filesystem::path &
+{
+    return path;
+}
+
 auto Epub::getTableOfContent() const -> const std::vector<TocEntry> &
 {
     return toc;
 }
 
+auto Epub::getTocTitle(const TocEntry &entry) const -> std::string_view
+{
+    return &tocStringPool[entry.titleOffset];
+}
+
+auto Epub::getTocHref(const TocEntry &entry) const -> std::string_view
+{
+    return &tocStringPool[entry.hrefOffset];
+}
+
+auto Epub::hasTocChildren(std::size_t tocIndex) const -> bool
+{
+    const auto childIndex = tocIndex + 1;
+    return (childIndex < toc.size()) && (toc[childIndex].parentIndex == tocIndex);
+}
+
+auto Epub::getTocSubtreeEnd(std::size_t tocIndex) const -> std::size_t
+{
+    /* Descendants directly follow the entry and are the only entries that are deeper */
+    auto endIndex = tocIndex + 1;
+    while ((endIndex < toc.size()) && (toc[endIndex].depth > toc[tocIndex].depth)) {
+        ++endIndex;
+    }
+    return endIndex;
+}
+
+auto Epub::getCoverPath() const -> const std::filesystem::path &
+{
+    return coverPath;
+}
+
+auto Epub::getLanguage() const -> const std::string &
+{
+    return language;
+}
+
 auto Epub::getSpineEntryIndex(const std::filesystem::path &spineHref) const -> std::size_t
 {
     const auto it = std::find_if(spine.begin(), spine.end(), [&](const auto &val) {
@@ -81,7 +244,162 @@ auto Epub::getSection(const std::filesystem::path &spineHref) const -> EpubSecti
         return {};
     }
 
-    return EpubSection{std::string{sectionContents.get(), sectionSize}};
+    return EpubSection{std::string{sectionContents.get(), sectionSize}, spineHref.parent_path(), [this](const std::filesystem::path &href) {
+        return getStyleSheet(href);
+    }};
+}
+
+auto Epub::openSectionStream(std::size_t spineEntryIndex) const -> std::unique_ptr<EpubEntryStream>
+{
+    if (spineEntryIndex >= spine.size()) {
+        return nullptr;
+    }
+
+    return openEntryStream(spine[spineEntryIndex]);
+}
+
+auto Epub::openEntryStream(const std::filesystem::path &href) const -> std::unique_ptr<EpubEntryStream>
+{
+    try {
+        return std::make_unique<EpubEntryStream>(&zip, href);
+    } catch (std::exception &e) {
+        ESP_LOGE(TAG, "Exception: '%s'", e.what());
+        return nullptr;
+    }
+}
+
+auto Epub::parse() -> void
+{
+    /* Get OPF file path */
+    const auto &contentOpfPath = getContentOpfPath();
+    if (contentOpfPath.empty()) {
+        throw std::runtime_error{"failed to get OPF file path"};
+    }
+
+    /* Parse OPF file */
+    const auto &rootPath = getRootDirectoryPath(contentOpfPath);
+    const auto &tocDocuments = parseContentOpf(contentOpfPath, rootPath);
+    if (tocDocuments.ncxPath.empty() && tocDocuments.navPath.empty()) {
+        throw std::runtime_error{"failed to get TOC file path"};
+    }
+
+    /* Parse TOC, prefer NCX and fall back to EPUB3 nav document */
+    if (!tocDocuments.ncxPath.empty() && parseTocNcx(tocDocuments.ncxPath)) {
+        return;
+    }
+    if (!tocDocuments.navPath.empty() && parseTocNav(tocDocuments.navPath)) {
+        return;
+    }
+    throw std::runtime_error{"failed to parse TOC"};
+}
+
+auto Epub::loadOpenState(std::uint32_t bookSize, std::uint32_t bookTime) -> bool
+{
+    const auto statePath = getOpenStatePath(path);
+    auto file = std::fopen(statePath.c_str(), "rb");
+    if (file == nullptr) {
+        if (errno != ENOENT) {
+            ESP_LOGE(TAG, "Failed to open '%s': %s", statePath.c_str(), std::strerror(errno));
+        }
+        return false;
+    }
+
+    /* Book replaced by another one with the same name differs in size or modification time. Counts are
+     * limited by the file size before anything is allocated, strings take at least their length each. */
+    OpenStateHeader header;
+    const auto fileSize = static_cast<std::uint64_t>(getFileSize(statePath));
+    auto isValid = (std::fread(&header, sizeof(header), 1, file) == 1) && (header.magic == openStateMagic) && 
+                   (header.version == openStateVersion) && (header.bookSize == bookSize) && (header.bookTime == bookTime) && 
+                   (header.tocCount > 0) && (header.tocStringPoolSize > 0) &&
+                   ((sizeof(header) + (header.spineCount * std::uint64_t{sizeof(std::uint16_t)}) + 
+                     (header.tocCount * std::uint64_t{sizeof(TocEntry)}) + header.tocStringPoolSize) <= fileSize);
+
+    std::string string;
+    if (isValid) {
+        isValid = readString(file, string);
+        coverPath = string;
+    }
+    if (isValid) {
+        isValid = readString(file, language);
+    }
+    spine.reserve(isValid ? header.spineCount : 0);
+    for (std::uint32_t i = 0; isValid && (i < header.spineCount); ++i) {
+        isValid = readString(file, string);
+        spine.emplace_back(string);
+    }
+    if (isValid) {
+        toc.resize(header.tocCount);
+        tocStringPool.resize(header.tocStringPoolSize);
+        isValid = (std::fread(toc.data(), sizeof(TocEntry), toc.size(), file) == toc.size()) && 
+                  (std::fread(tocStringPool.data(), 1, tocStringPool.size(), file) == tocStringPool.size()) && isTocValid();
+    }
+    std::fclose(file);
+
+    if (!isValid) {
+        ESP_LOGI(TAG, "Open state '%s' outdated or damaged", statePath.c_str());
+        coverPath.clear();
+        language.clear();
+        spine.clear();
+        toc.clear();
+        tocStringPool.clear();
+    }
+    return isValid;
+}
+
+auto Epub::saveOpenState(std::uint32_t bookSize, std::uint32_t bookTime) const -> bool
+{
+    std::lock_guard lock{openStateMutex};
+
+    /* Write to temporary file first, so that power loss never leaves half-written state */
+    const auto statePath = getOpenStatePath(path);
+    auto tempPath = statePath;
+    tempPath += ".tmp";
+    auto file = std::fopen(tempPath.c_str(), "wb");
+    if (file == nullptr) {
+        ESP_LOGE(TAG, "Failed to create '%s': %s", tempPath.c_str(), std::strerror(errno));
+        return false;
+    }
+
+    const auto header = OpenStateHeader{
+        .magic = openStateMagic,
+        .version = openStateVersion,
+        .bookSize = bookSize,
+        .bookTime = bookTime,
+        .spineCount = static_cast<std::uint32_t>(spine.size()),
+        .tocCount = static_cast<std::uint32_t>(toc.size()),
+        .tocStringPoolSize = static_cast<std::uint32_t>(tocStringPool.size())
+    };
+    auto written = (std::fwrite(&header, sizeof(header), 1, file) == 1) && writeString(file, coverPath.native()) && writeString(file, language);
+    for (const auto &spinePath : spine) {
+        written = written && writeString(file, spinePath.native());
+    }
+    written = written && (std::fwrite(toc.data(), sizeof(TocEntry), toc.size(), file) == toc.size()) && 
+              (std::fwrite(tocStringPool.data(), 1, tocStringPool.size(), file) == tocStringPool.size());
+    std::fclose(file);
+    if (!written) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    /* FAT can't rename over existing file */
+    std::remove(statePath.c_str());
+    return std::rename(tempPath.c_str(), statePath.c_str()) == 0;
+}
+
+auto Epub::isTocValid() const -> bool
+{
+    /* Strings are read up to their terminator, parents precede their children */
+    if (tocStringPool.empty() || (tocStringPool.back() != '\0')) {
+        return false;
+    }
+    for (std::size_t index = 0; index < toc.size(); ++index) {
+        const auto &entry = toc[index];
+        if ((entry.titleOffset >= tocStringPool.size()) || (entry.hrefOffset >= tocStringPool.size()) ||
+            ((entry.parentIndex != noParentTocIndex) && (entry.parentIndex >= index))) {
+            return false;
+        }
+    }
+    return true;
 }
 
 auto Epub::getContentOpfPath() const -> std::filesystem::path
@@ -118,12 +436,35 @@ auto Epub::getContentOpfPath() const -> std::filesystem::path
     return contentOpfNode.attribute(container::fullPathAttr).as_string();
 }
 
+auto Epub::getStyleSheet(const std::filesystem::path &href) const -> std::shared_ptr<const StyleSheet>
+{
+    const auto it = styleSheets.find(href);
+    if (it != styleSheets.end()) {
+        return it->second;
+    }
+
+    /* Missing stylesheet is cached too, so that it's not looked up for every section */
+    std::shared_ptr<const StyleSheet> styleSheet;
+    std::size_t styleSheetSize;
+    auto styleSheetRaw = mz_zip_reader_extract_file_to_heap(&zip, href.c_str(), &styleSheetSize, 0);
+    auto styleSheetContents = unique_mptr<char[]>(static_cast<char *>(styleSheetRaw));
+    if (styleSheetContents != nullptr) {
+        styleSheet = std::make_shared<const StyleSheet>(std::string_view{styleSheetContents.get(), styleSheetSize});
+    }
+    else {
+        ESP_LOGW(TAG, "Failed to extract stylesheet '%s' from archive", href.c_str());
+    }
+
+    styleSheets.emplace(href, styleSheet);
+    return styleSheet;
+}
+
 auto Epub::getRootDirectoryPath(const std::filesystem::path &contentOpfPath) const -> std::filesystem::path
 {
     return contentOpfPath.parent_path();
 }
 
-auto Epub::parseContentOpf(const std::filesystem::path &contentOpfPath, const std::filesystem::path &rootPath) -> std::filesystem::path
+auto Epub::parseContentOpf(const std::filesystem::path &contentOpfPath, const std::filesystem::path &rootPath) -> TocDocuments
 {
     /* Read OPF file and parse it */
     std::size_t opfSize;
@@ -153,21 +494,46 @@ auto Epub::parseContentOpf(const std::filesystem::path &contentOpfPath, const st
     
     /* Create manifest map */
     std::map<std::string, std::string> manifestMap;
-    std::filesystem::path ncxPath;
+    TocDocuments tocDocuments;
     for (const auto &itemNode : manifestNode) {
         const auto id = itemNode.attribute(opf::itemId).as_string();
         const auto href = itemNode.attribute(opf::itemHref).as_string();
+        const auto mediaType = itemNode.attribute(opf::itemMediaType).as_string();
+        const auto properties = std::string_view{itemNode.attribute(opf::itemProperties).as_string()};
         manifestMap.insert({id, href});
 
-        if (strcmp(id, opf::ncxAttrValue) == 0) {
-            ncxPath = rootPath / href;
+        if ((strcmp(id, opf::ncxAttrValue) == 0) || (strcmp(mediaType, opf::ncxMediaType) == 0)) {
+            tocDocuments.ncxPath = rootPath / href;
+        }
+        if (hasToken(properties, opf::navProperty)) {
+            tocDocuments.navPath = rootPath / href;
+        }
+        if (hasToken(properties, opf::coverImageProperty)) {
+            coverPath = resolveHref(rootPath, href);
         }
     }
-    if (ncxPath.empty()) {
-        ESP_LOGE(TAG, "Failed to find NCX path in '%s'", contentOpfPath.c_str());
+    if (tocDocuments.ncxPath.empty() && tocDocuments.navPath.empty()) {
+        ESP_LOGE(TAG, "Failed to find NCX or nav path in '%s'", contentOpfPath.c_str());
         return {};
     }
 
+    /* EPUB2 refers to the cover picture by manifest id in metadata, EPUB3 marks it in the manifest */
+    if (coverPath.empty()) {
+        const auto &coverMetaNode = doc.find_node([](const pugi::xml_node &node) {
+            return (strcmp(node.name(), opf::metaNode) == 0) && (strcmp(node.attribute(opf::metaNameAttr).as_string(), opf::coverMetaValue) == 0);
+        });
+        const auto it = manifestMap.find(coverMetaNode.attribute(opf::metaContentAttr).as_string());
+        if (it != manifestMap.end()) {
+            coverPath = resolveHref(rootPath, it->second);
+        }
+    }
+
+    /* Language decides on hyphenation patterns, only the first one is used if there are more */
+    const auto &languageNode = doc.find_node([](const pugi::xml_node &node) {
+        return (strcmp(node.name(), opf::languageNode) == 0);
+    });
+    language = getNodeText(languageNode);
+
     /* Parse spine */
     const auto &spineNode = doc.find_node([](const pugi::xml_node &node) {
         return (strcmp(node.name(), opf::spineNode) == 0);
@@ -185,10 +551,10 @@ auto Epub::parseContentOpf(const std::filesystem::path &contentOpfPath, const st
         spine.emplace_back(rootPath / manifestPath);
     }
 
-    return ncxPath;
+    return tocDocuments;
 }
 
-auto Epub::parseTocNcx(const std::filesystem::path &ncxPath, const std::filesystem::path &rootPath) -> bool
+auto Epub::parseTocNcx(const std::filesystem::path &ncxPath) -> bool
 {
     /* Read NCX file and parse it */
     std::size_t ncxSize;
@@ -198,10 +564,9 @@ auto Epub::parseTocNcx(const std::filesystem::path &ncxPath, const std::filesyst
         ESP_LOGE(TAG, "Failed to extract '%s' from archive", ncxPath.c_str());
         return false;
     }
-    const auto &ncxContentsString = std::string{ncxContents.get(), ncxSize};
 
     pugi::xml_document doc;
-    const auto &result = doc.load_string(ncxContents.get());
+    const auto &result = doc.load_buffer(ncxContents.get(), ncxSize);
     if (!result) {
         ESP_LOGE(TAG, "Failed to parse '%s', error: %s", ncxPath.c_str(), result.description());
         return false;
@@ -212,18 +577,104 @@ auto Epub::parseTocNcx(const std::filesystem::path &ncxPath, const std::filesyst
         return (strcmp(node.name(), ncx::navMapNode) == 0);
     });
     if (navMapNode.empty()) {
-        ESP_LOGE(TAG, "Failed to find manifest node in '%s'", ncxPath.c_str());
+        ESP_LOGE(TAG, "Failed to find navMap node in '%s'", ncxPath.c_str());
         return false;
     }
 
-    /* Iterate through every item in navMap and add to TOC vector */
-    for (const auto &navPointNode : navMapNode) {
-        const auto &contentPath = std::string{navPointNode.child(ncx::contentNode).attribute(ncx::srcAttr).as_string()};
-        auto contentPathNoAnchor = contentPath.substr(0, contentPath.find('#')); // TODO anchor-based navigation is not supported yet
-        auto title = std::string{navPointNode.child(ncx::navLabelNode).child(ncx::textNode).child_value()};
+    /* Walk navPoint tree and flatten it into TOC vector, hrefs are relative to NCX file */
+    toc.clear();
+    tocStringPool.assign(1, '\0'); // Offset 0 is always an empty string
+    parseNavPoints(navMapNode, ncxPath.parent_path(), noParentTocIndex, 0);
 
-        toc.emplace_back(title, rootPath / contentPathNoAnchor);
+    return !toc.empty();
+}
+
+auto Epub::parseNavPoints(const pugi::xml_node &parentNode, const std::filesystem::path &basePath, std::uint32_t parentIndex, std::uint16_t depth) -> void
+{
+    for (const auto &navPointNode : parentNode.children(ncx::navPointNode)) {
+        const auto contentPath = navPointNode.child(ncx::contentNode).attribute(ncx::srcAttr).as_string();
+        const auto title = navPointNode.child(ncx::navLabelNode).child(ncx::textNode).child_value();
+
+        const auto entryIndex = addTocEntry(title, resolveHref(basePath, contentPath), parentIndex, depth);
+        if (depth + 1 < maxTocDepth) {
+            parseNavPoints(navPointNode, basePath, entryIndex, depth + 1);
+        }
     }
+}
 
-    return true;
+auto Epub::parseTocNav(const std::filesystem::path &navPath) -> bool
+{
+    /* Read nav document and parse it */
+    std::size_t navSize;
+    auto navRaw = mz_zip_reader_extract_file_to_heap(&zip, navPath.c_str(), &navSize, 0);
+    auto navContents = unique_mptr<char[]>(static_cast<char *>(navRaw));
+    if (navContents == nullptr) {
+        ESP_LOGE(TAG, "Failed to extract '%s' from archive", navPath.c_str());
+        return false;
+    }
+
+    pugi::xml_document doc;
+    const auto &result = doc.load_buffer(navContents.get(), navSize);
+    if (!result) {
+        ESP_LOGE(TAG, "Failed to parse '%s', error: %s", navPath.c_str(), result.description());
+        return false;
+    }
+
+    /* Find nav node of toc type, there might also be e.g. landmarks or page-list navs */
+    const auto &navNode = doc.find_node([](const pugi::xml_node &node) {
+        const auto type = std::string_view{node.attribute(nav::typeAttr).as_string()};
+        return (strcmp(node.name(), nav::navNode) == 0) && hasToken(type, nav::tocTypeValue);
+    });
+    if (navNode.empty()) {
+        ESP_LOGE(TAG, "Failed to find toc nav node in '%s'", navPath.c_str());
+        return false;
+    }
+
+    /* Walk nested lists and flatten them into TOC vector, hrefs are relative to nav document */
+    toc.clear();
+    tocStringPool.assign(1, '\0'); // Offset 0 is always an empty string
+    parseNavList(navNode.child(nav::listNode), navPath.parent_path(), noParentTocIndex, 0);
+
+    return !toc.empty();
+}
+
+auto Epub::parseNavList(const pugi::xml_node &listNode, const std::filesystem::path &basePath, std::uint32_t parentIndex, std::uint16_t depth) -> void
+{
+    for (const auto &listItemNode : listNode.children(nav::listItemNode)) {
+        /* Entry is either a link or a span heading without target */
+        auto labelNode = listItemNode.child(nav::anchorNode);
+        if (labelNode.empty()) {
+            labelNode = listItemNode.child(nav::spanNode);
+        }
+        const auto href = labelNode.attribute(nav::hrefAttr).as_string();
+        const auto &title = getNodeText(labelNode);
+
+        const auto entryIndex = addTocEntry(title, resolveHref(basePath, href), parentIndex, depth);
+        if (depth + 1 < maxTocDepth) {
+            parseNavList(listItemNode.child(nav::listNode), basePath, entryIndex, depth + 1);
+        }
+    }
+}
+
+auto Epub::addTocEntry(std::string_view title, const std::filesystem::path &href, std::uint32_t parentIndex, std::uint16_t depth) -> std::uint32_t
+{
+    const auto entryIndex = static_cast<std::uint32_t>(toc.size());
+    const auto titleOffset = addTocString(title);
+    const auto hrefOffset = addTocString(href.native());
+    toc.push_back({parentIndex, hrefOffset, titleOffset, depth});
+
+    return entryIndex;
+}
+
+auto Epub::addTocString(std::string_view string) -> std::uint32_t
+{
+    if (string.empty()) {
+        return 0;
+    }
+
+    const auto offset = static_cast<std::uint32_t>(tocStringPool.size());
+    tocStringPool.append(string);
+    tocStringPool.push_back('\0');
+
+    return offset;
 }
@@ -1,37 +1,78 @@
 #pragma once
 
 #include "EpubSection.hpp"
+#include "EpubEntryStream.hpp"
 #include <miniz/miniz.h>
+#include <pugixml/pugixml.hpp>
 #include <vector>
+#include <map>
+#include <memory>
 #include <filesystem>
+#include <string_view>
+#include <cstdint>
 
 class Epub
 {
     public:
+        /* TOC is stored as a flat tree in document (pre-)order - descendants of an entry
+         * directly follow it, the title and href strings live in a single string pool */
         struct TocEntry
         {
-            std::string title;
-            std::filesystem::path contentPath;
+            std::uint32_t parentIndex;
+            std::uint32_t hrefOffset;
+            std::uint32_t titleOffset;
+            std::uint16_t depth;
         };
 
         static constexpr auto invalidSpineEntryIndex = std::numeric_limits<std::size_t>::max();
+        static constexpr auto noParentTocIndex = std::numeric_limits<std::uint32_t>::max();
 
         Epub(const std::filesystem::path &path);
         ~Epub() noexcept;
 
+        [[nodiscard]] auto getPath() const -> const std::filesystem::path &;
         [[nodiscard]] auto getTableOfContent() const -> const std::vector<TocEntry> &;
+        [[nodiscard]] auto getTocTitle(const TocEntry &entry) const -> std::string_view;
+        [[nodiscard]] auto getTocHref(const TocEntry &entry) const -> std::string_view;
+        [[nodiscard]] auto hasTocChildren(std::size_t tocIndex) const -> bool;
+        [[nodiscard]] auto getTocSubtreeEnd(std::size_t tocIndex) const -> std::size_t;
+        [[nodiscard]] auto getCoverPath() const -> const std::filesystem::path &;
+        [[nodiscard]] auto getLanguage() const -> const std::string &; // Language tag like "en-GB", empty if not given
         [[nodiscard]] auto getSpineEntryIndex(const std::filesystem::path &spineHref) const -> std::size_t;
         [[nodiscard]] auto getSpineItemsCount() const -> std::size_t;
         [[nodiscard]] auto getSection(std::size_t spineEntryIndex) const -> EpubSection;
         [[nodiscard]] auto getSection(const std::filesystem::path &spineHref) const -> EpubSection;
+        [[nodiscard]] auto openSectionStream(std::size_t spineEntryIndex) const -> std::unique_ptr<EpubEntryStream>;
+        [[nodiscard]] auto openEntryStream(const std::filesystem::path &href) const -> std::unique_ptr<EpubEntryStream>;
 
     private:
+        struct TocDocuments
+        {
+            std::filesystem::path ncxPath;
+            std::filesystem::path navPath;
+        };
+
+        std::filesystem::path path;
         mutable mz_zip_archive zip;
         std::vector<std::filesystem::path> spine;
+        std::filesystem::path coverPath;
+        std::string language;
         std::vector<TocEntry> toc;
+        std::string tocStringPool;
+        mutable std::map<std::filesystem::path, std::shared_ptr<const StyleSheet>> styleSheets; // Sections of a book usually share stylesheets
 
+        auto parse() -> void;
+        auto loadOpenState(std::uint32_t bookSize, std::uint32_t bookTime) -> bool;
+        auto saveOpenState(std::uint32_t bookSize, std::uint32_t bookTime) const -> bool;
+        [[nodiscard]] auto isTocValid() const -> bool;
         [[nodiscard]] auto getContentOpfPath() const -> std::filesystem::path;
+        [[nodiscard]] auto getStyleSheet(const std::filesystem::path &href) const -> std::shared_ptr<const StyleSheet>;
         [[nodiscard]] auto getRootDirectoryPath(const std::filesystem::path &contentOpfPath) const -> std::filesystem::path;
-        auto parseContentOpf(const std::filesystem::path &contentOpfPath, const std::filesystem::path &rootPath) -> std::filesystem::path;
-        auto parseTocNcx(const std::filesystem::path &ncxPath, const std::filesystem::path &rootPath) -> bool;
+        auto parseContentOpf(const std::filesystem::path &contentOpfPath, const std::filesystem::path &rootPath) -> TocDocuments;
+        auto parseTocNcx(const std::filesystem::path &ncxPath) -> bool;
+        auto parseNavPoints(const pugi::xml_node &parentNode, const std::filesystem::path &basePath, std::uint32_t parentIndex, std::uint16_t depth) -> void;
+        auto parseTocNav(const std::filesystem::path &navPath) -> bool;
+        auto parseNavList(const pugi::xml_node &listNode, const std::filesystem::path &basePath, std::uint32_t parentIndex, std::uint16_t depth) -> void;
+        auto addTocEntry(std::string_view title, const std::filesystem::path &href, std::uint32_t parentIndex, std::uint16_t depth) -> std::uint32_t;
+        auto addTocString(std::string_view string) -> std::uint32_t;
 };
@@ -16,7 +16,17 @@ namespace constants::epub
         inline constexpr auto manifestNode = "manifest";
         inline constexpr auto itemId = "id";
         inline constexpr auto itemHref = "href";
+        inline constexpr auto itemMediaType = "media-type";
+        inline constexpr auto itemProperties = "properties";
         inline constexpr auto ncxAttrValue = "ncx";
+        inline constexpr auto ncxMediaType = "application/x-dtbncx+xml";
+        inline constexpr auto navProperty = "nav";
+        inline constexpr auto coverImageProperty = "cover-image";
+        inline constexpr auto metaNode = "meta";
+        inline constexpr auto metaNameAttr = "name";
+        inline constexpr auto metaContentAttr = "content";
+        inline constexpr auto coverMetaValue = "cover";
+        inline constexpr auto languageNode = "dc:language";
         inline constexpr auto spineNode = "spine";
         inline constexpr auto idrefAttr = "idref";
     }
@@ -24,9 +34,22 @@ namespace constants::epub
     namespace ncx
     {
         inline constexpr auto navMapNode = "navMap";
+        inline constexpr auto navPointNode = "navPoint";
         inline constexpr auto contentNode = "content";
         inline constexpr auto srcAttr = "src";
         inline constexpr auto navLabelNode = "navLabel";
         inline constexpr auto textNode = "text";
     }
+
+    namespace nav
+    {
+        inline constexpr auto navNode = "nav";
+        inline constexpr auto typeAttr = "epub:type";
+        inline constexpr auto tocTypeValue = "toc";
+        inline constexpr auto listNode = "ol";
+        inline constexpr auto listItemNode = "li";
+        inline constexpr auto anchorNode = "a";
+        inline constexpr auto spanNode = "span";
+        inline constexpr auto hrefAttr = "href";
+    }
 }
@@ -0,0 +1,32 @@
+#include "EpubEntryStream.hpp"
+#include <stdexcept>
+
+EpubEntryStream::EpubEntryStream(mz_zip_archive *zip, const std::filesystem::path &href) : position{0}
+{
+    state = mz_zip_reader_extract_file_iter_new(zip, href.c_str(), 0);
+    if (state == nullptr) {
+        throw std::runtime_error{"failed to open entry stream for '" + href.string() + "'"};
+    }
+}
+
+EpubEntryStream::~EpubEntryStream() noexcept
+{
+    mz_zip_reader_extract_iter_free(state);
+}
+
+auto EpubEntryStream::read(char *buffer, std::size_t size) -> std::size_t
+{
+    const auto bytesRead = mz_zip_reader_extract_iter_read(state, buffer, size);
+    position += bytesRead;
+    return bytesRead;
+}
+
+auto EpubEntryStream::getSize() const -> std::size_t
+{
+    return static_cast<std::size_t>(state->file_stat.m_uncomp_size);
+}
+
+auto EpubEntryStream::getPosition() const -> std::size_t
+{
+    return position;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <miniz/miniz.h>
+#include <filesystem>
+#include <cstddef>
+
+/* Sequential reader of an archive entry (section, image) inflated on the fly -
+ * memory usage depends only on miniz buffers, not on the size of the entry */
+class EpubEntryStream
+{
+    public:
+        EpubEntryStream(mz_zip_archive *zip, const std::filesystem::path &href);
+        ~EpubEntryStream() noexcept;
+
+        EpubEntryStream(const EpubEntryStream &) = delete;
+        auto operator=(const EpubEntryStream &) -> EpubEntryStream & = delete;
+
+        /* Returns number of bytes read, 0 at the end of the entry or on error */
+        [[nodiscard]] auto read(char *buffer, std::size_t size) -> std::size_t;
+        [[nodiscard]] auto getSize() const -> std::size_t;
+        [[nodiscard]] auto getPosition() const -> std::size_t;
+
+    private:
+        mz_zip_reader_extract_iter_state *state;
+        std::size_t position;
+};
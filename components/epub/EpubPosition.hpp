@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <compare>
+
+/* Position of a character in the book, independent of fonts and page layout. The offset
+ * is in bytes of the UTF-8 text of the block, so it always points at a character boundary */
+struct EpubPosition
+{
+    std::size_t spineIndex;
+    std::size_t blockIndex;
+    std::size_t blockOffsetBytes;
+
+    auto operator<=>(const EpubPosition &other) const = default;
+};
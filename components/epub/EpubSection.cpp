@@ -2,24 +2,74 @@
 #include <esp_log.h>
 #include <algorithm>
 #include <stdexcept>
+#include <limits>
+#include <cctype>
 
 #define TAG __FILENAME__
 
+namespace
+{
+    constexpr std::string_view linkNode = "link";
+    constexpr std::string_view styleNode = "style";
+    constexpr std::string_view cssMediaType = "text/css";
+
+    /* Defaults for the tags the stylesheets of books usually don't restyle, margins of html and body are not
+     * block margins of the reader. Headings are laid out in bold face, so they don't need font-weight.
+     * Text is justified unless the book says otherwise. */
+    constexpr auto defaultCss =
+        "i, em, cite, var, dfn { font-style: italic }"
+        "b, strong { font-weight: bold }"
+        "p, div, h1, h2, h3, h4, h5, h6, blockquote, section, article, header, footer, aside, nav, figure, figcaption,"
+        "address, center, pre, hr, ul, ol, li, dl, dt, dd, table, tr { display: block }"
+        "blockquote { margin-left: 2em; margin-right: 2em }"
+        "center { text-align: center }"
+        "head, script, style { display: none }"
+        "body { text-align: justify }";
+
+    auto getDefaultStyleSheet() -> std::shared_ptr<const StyleSheet>
+    {
+        static const auto defaultStyleSheet = std::make_shared<const StyleSheet>(defaultCss);
+        return defaultStyleSheet;
+    }
+
+    auto addLengths(std::int32_t a, std::int32_t b, std::int32_t c = 0) -> std::int16_t
+    {
+        const auto sum = a + b + c;
+        return static_cast<std::int16_t>(std::clamp<std::int32_t>(sum, std::numeric_limits<std::int16_t>::min(), std::numeric_limits<std::int16_t>::max()));
+    }
+
+    auto setStyleFlag(TextStyle style, TextStyle flag, const std::optional<bool> &isSet) -> TextStyle
+    {
+        if (!isSet.has_value()) {
+            return style;
+        }
+        const auto bits = static_cast<std::uint8_t>(style);
+        const auto flagBits = static_cast<std::uint8_t>(flag);
+        return static_cast<TextStyle>(*isSet ? (bits | flagBits) : (bits & ~flagBits));
+    }
+}
+
+EpubSectionWalker::EpubSectionWalker(const std::filesystem::path &basePath, StyleSheetLoader styleSheetLoader)
+    : basePath{basePath}, styleSheetLoader{std::move(styleSheetLoader)}, styleSheets{getDefaultStyleSheet()} {}
+
 auto EpubSectionWalker::for_each(pugi::xml_node &node) -> bool
 {
     switch (node.type()) {
         case pugi::xml_node_type::node_element:
-            if (isHeading(node)) {
-                fontStack.push_back(Font::Bold);
+            enterElement(node);
+            if (isImage(node)) {
+                appendImage(node);
             }
-            else if (isBlock(node)) {
-                fontStack.push_back(Font::Normal);
+            else if (isHeading(node) || isBlock(node)) {
+                const auto &state = elementStack.back();
+                const auto font = isHeading(node) ? Font::Bold : Font::Normal;
+                fontStack.push_back({font, {0, 0, state.marginLeft, state.marginRight, state.textIndent, state.textAlign, state.isHidden}});
             }
             break;
 
         case pugi::xml_node_type::node_pcdata:
             if (!fontStack.empty()) {
-                currentBlockText += node.value();
+                appendText(node.value());
             }
             break;
 
@@ -34,23 +84,224 @@ auto EpubSectionWalker::on_leave(pugi::xml_node &node) -> bool
     if (node.type() != pugi::xml_node_type::node_element) {
         return true;
     }
-    if (currentBlockText.empty()) {
-        return true;
+
+    if ((!currentBlockText.empty() || hasHiddenText) && (isHeading(node) || isBlock(node))) {
+        const auto &openBlock = fontStack.back();
+        pushBlock({std::move(currentBlockText), openBlock.font, std::move(currentBlockRuns)}, openBlock.style);
+        fontStack.pop_back();
     }
+    leaveElement();
+    return true;
+}
 
-    if (isHeading(node) || isBlock(node)) {
-        /* Remove newlines */
-        std::replace(currentBlockText.begin(), currentBlockText.end(), '\n', ' ');
+auto EpubSectionWalker::end(pugi::xml_node &node) -> bool
+{
+    /* Sections usually use just a few distinct styles, blocks refer to them by index */
+    styles.clear();
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        auto it = std::find(styles.begin(), styles.end(), blockStyles[i]);
+        if (it == styles.end()) {
+            if (styles.size() >= std::numeric_limits<std::uint16_t>::max()) {
+                ESP_LOGW(TAG, "Too many block styles, using the first one");
+                it = styles.begin();
+            }
+            else {
+                it = styles.insert(styles.end(), blockStyles[i]);
+            }
+        }
+        blocks[i].style = static_cast<std::uint16_t>(std::distance(styles.begin(), it));
+    }
 
-        /* Substitute HTML entities */
-        currentBlockText = htmlEntities.substitute(currentBlockText);
+    /* Loader refers to the book, which may be closed before the section is dropped */
+    blockStyles = {};
+    matches = {};
+    styleSheets.clear();
+    styleSheetLoader = nullptr;
+    return true;
+}
 
-        /* Push new block */
-        blocks.emplace_back(currentBlockText, fontStack.back());
-        currentBlockText.clear();
-        fontStack.pop_back();
+auto EpubSectionWalker::enterElement(const pugi::xml_node &node) -> void
+{
+    const auto name = std::string_view{node.name()};
+    if ((name == linkNode) || (name == styleNode)) {
+        addStyleSheet(node);
     }
-    return true;
+
+    /* Cascade - rules of all stylesheets by specificity and order, then the style attribute */
+    elementPath.push_back({name, node.attribute("id").as_string(), node.attribute("class").as_string()});
+    matches.clear();
+    for (std::size_t i = 0; i < styleSheets.size(); ++i) {
+        styleSheets[i]->collectMatches(elementPath, static_cast<std::uint16_t>(i), matches);
+    }
+    auto declarations = StyleSheet::cascade(matches);
+    const auto styleAttribute = node.attribute("style").as_string();
+    if (*styleAttribute != '\0') {
+        declarations.merge(StyleSheet::parseDeclarations(styleAttribute));
+    }
+
+    const auto parent = elementStack.empty() ? ElementState{TextStyle::Regular, TextAlign::Left, 0, 0, 0, 0, false, false, 0} : elementStack.back();
+    auto state = parent;
+    state.textStyle = setStyleFlag(state.textStyle, TextStyle::Italic, declarations.isItalic);
+    state.textStyle = setStyleFlag(state.textStyle, TextStyle::Bold, declarations.isBold);
+    state.textAlign = declarations.textAlign.value_or(parent.textAlign);
+    state.textIndent = declarations.textIndent.value_or(parent.textIndent);
+    state.marginBottom = 0;
+    state.isBlock = (declarations.display == StyleSheet::Display::Block);
+    state.isHidden = parent.isHidden || (declarations.display == StyleSheet::Display::None);
+    state.blocksCount = blocks.size();
+
+    /* Paddings are added to margins, as there are no borders or backgrounds. Vertical margins of adjacent elements collapse. */
+    if (state.isBlock && !state.isHidden) {
+        const auto marginTop = addLengths(declarations.marginTop.value_or(0), declarations.paddingTop.value_or(0));
+        pendingMarginTop = std::max(pendingMarginTop, marginTop);
+        state.marginLeft = addLengths(parent.marginLeft, declarations.marginLeft.value_or(0), declarations.paddingLeft.value_or(0));
+        state.marginRight = addLengths(parent.marginRight, declarations.marginRight.value_or(0), declarations.paddingRight.value_or(0));
+        state.marginBottom = addLengths(declarations.marginBottom.value_or(0), declarations.paddingBottom.value_or(0));
+    }
+    elementStack.push_back(state);
+}
+
+auto EpubSectionWalker::leaveElement() -> void
+{
+    const auto state = elementStack.back();
+    elementStack.pop_back();
+    elementPath.pop_back();
+    if (!state.isBlock || state.isHidden) {
+        return;
+    }
+
+    /* Bottom margin goes to the last block inside the element, element without blocks passes it to the next one */
+    if (blocks.size() > state.blocksCount) {
+        auto &lastStyle = blockStyles.back();
+        lastStyle.marginBottom = std::max(lastStyle.marginBottom, state.marginBottom);
+    }
+    else {
+        pendingMarginTop = std::max(pendingMarginTop, state.marginBottom);
+    }
+}
+
+auto EpubSectionWalker::addStyleSheet(const pugi::xml_node &node) -> void
+{
+    if (node.name() == styleNode) {
+        const auto type = std::string_view{node.attribute("type").as_string()};
+        if (type.empty() || (type == cssMediaType)) {
+            styleSheets.push_back(std::make_shared<const StyleSheet>(node.child_value()));
+        }
+        return;
+    }
+
+    const auto rel = std::string_view{node.attribute("rel").as_string()};
+    if (!styleSheetLoader || (rel.find("stylesheet") == std::string_view::npos) || (rel.find("alternate") != std::string_view::npos)) {
+        return;
+    }
+
+    auto href = std::string_view{node.attribute("href").as_string()};
+    href = href.substr(0, href.find('#'));
+    if (href.empty() || (href.find(':') != std::string_view::npos)) { // External stylesheets are not available
+        return;
+    }
+
+    auto styleSheet = styleSheetLoader((basePath / href).lexically_normal());
+    if (styleSheet != nullptr) {
+        styleSheets.push_back(std::move(styleSheet));
+    }
+}
+
+auto EpubSectionWalker::pushBlock(TextBlock &&block, BlockStyle style) -> void
+{
+    /* Hidden block takes no space, its margins are kept for the next block */
+    if (!style.isHidden) {
+        style.marginTop = pendingMarginTop;
+        pendingMarginTop = 0;
+    }
+
+    blocks.push_back(std::move(block));
+    blockStyles.push_back(style);
+    currentBlockText.clear();
+    currentBlockRuns.clear();
+    hasHiddenText = false;
+}
+
+auto EpubSectionWalker::appendText(std::string_view text) -> void
+{
+    /* Whitespace-only text matters only between inline elements, e.g. "<i>a</i> <b>b</b>" */
+    const auto isWhitespace = std::all_of(text.begin(), text.end(), [](char c) {
+        return std::isspace(static_cast<unsigned char>(c));
+    });
+    if (isWhitespace && currentBlockText.empty()) {
+        return;
+    }
+
+    /* Hidden inline text is dropped, text of a hidden block is kept along with the block */
+    const auto &state = elementStack.back();
+    if (state.isHidden && !fontStack.back().style.isHidden) {
+        hasHiddenText = hasHiddenText || !isWhitespace;
+        return;
+    }
+
+    /* Entities are substituted and newlines removed per text node, so that offsets of runs stay valid */
+    auto blockText = htmlEntities.substitute(std::string{text});
+    std::replace(blockText.begin(), blockText.end(), '\n', ' ');
+
+    const auto style = state.textStyle;
+    auto offset = currentBlockText.size();
+    auto length = blockText.size();
+    currentBlockText += blockText;
+    if (style == TextStyle::Regular) {
+        return;
+    }
+
+    /* Extend previous run if it's adjacent and of the same style, split runs too long for 16-bit length */
+    if (!currentBlockRuns.empty()) {
+        auto &lastRun = currentBlockRuns.back();
+        const auto lastRunEnd = lastRun.offset + lastRun.length;
+        if ((lastRunEnd == offset) && (lastRun.style == style)) {
+            const auto extension = std::min<std::size_t>(length, std::numeric_limits<std::uint16_t>::max() - lastRun.length);
+            lastRun.length += extension;
+            offset += extension;
+            length -= extension;
+        }
+    }
+    while (length > 0) {
+        const auto runLength = std::min<std::size_t>(length, std::numeric_limits<std::uint16_t>::max());
+        currentBlockRuns.push_back({static_cast<std::uint32_t>(offset), static_cast<std::uint16_t>(runLength), style});
+        offset += runLength;
+        length -= runLength;
+    }
+}
+
+auto EpubSectionWalker::appendImage(const pugi::xml_node &node) -> void
+{
+    /* Image is a block of its own, text preceding it in the enclosing block is split off */
+    if (!currentBlockText.empty() || hasHiddenText) {
+        auto &openBlock = fontStack.back();
+        pushBlock({std::move(currentBlockText), openBlock.font, std::move(currentBlockRuns)}, openBlock.style);
+        openBlock.style.textIndent = 0; // Rest of the paragraph continues after the picture
+    }
+
+    /* Block is created even if the path is missing, so that block indices don't depend on attributes */
+    auto href = std::string_view{};
+    for (const auto &attribute : imageHrefAttributes) {
+        href = node.attribute(attribute.c_str()).as_string();
+        if (!href.empty()) {
+            break;
+        }
+    }
+    href = href.substr(0, href.find('#'));
+
+    auto imagePath = std::string{};
+    if (!href.empty() && (href.find(':') == std::string_view::npos)) { // Skip data URIs and external links
+        imagePath = (basePath / href).lexically_normal().string();
+    }
+    const auto &state = elementStack.back();
+    pushBlock({{}, Font::Normal, {}, std::move(imagePath)}, {0, 0, state.marginLeft, state.marginRight, 0, TextAlign::Center, state.isHidden});
+}
+
+auto EpubSectionWalker::isImage(const pugi::xml_node &node) const -> bool
+{
+    return std::any_of(imageNodes.begin(), imageNodes.end(), [&](const auto &imageNode) {
+        return node.name() == imageNode;
+    });
 }
 
 auto EpubSectionWalker::getTextBlocks() const -> const TextBlocks &
@@ -58,6 +309,11 @@ auto EpubSectionWalker::getTextBlocks() const -> const TextBlocks &
     return blocks;
 }
 
+auto EpubSectionWalker::getBlockStyles() const -> const BlockStyles &
+{
+    return styles;
+}
+
 auto EpubSectionWalker::isHeading(const pugi::xml_node &node) const -> bool 
 {
     return std::any_of(hNodes.begin(), hNodes.end(), [&](const auto &hNode) {
@@ -73,14 +329,15 @@ auto EpubSectionWalker::isBlock(const pugi::xml_node &node) const -> bool
 }
 
 
-EpubSection::EpubSection(const std::string &rawContent) : rawContent{rawContent}
+EpubSection::EpubSection(const std::string &rawContent, const std::filesystem::path &basePath, StyleSheetLoader styleSheetLoader)
+    : rawContent{rawContent}, walker{basePath, std::move(styleSheetLoader)}
 {
     if (rawContent.empty()) {
         return;
     }
 
     pugi::xml_document doc;
-    const auto &result = doc.load_string(this->rawContent.c_str());
+    const auto &result = doc.load_string(this->rawContent.c_str(), pugi::parse_default | pugi::parse_ws_pcdata);
     if (!result) {
         throw std::runtime_error{std::string{"failed to parse section: "} + result.description()};
     }
@@ -97,3 +354,16 @@ auto EpubSection::getBlocks() const -> const TextBlocks &
 {
     return walker.getTextBlocks();
 }
+
+auto EpubSection::getStyles() const -> const BlockStyles &
+{
+    return walker.getBlockStyles();
+}
+
+auto EpubSection::getBlockStyle(const TextBlock &block) const -> const BlockStyle &
+{
+    static constexpr BlockStyle defaultStyle{0, 0, 0, 0, 0, TextAlign::Left, false};
+
+    const auto &styles = walker.getBlockStyles();
+    return (block.style < styles.size()) ? styles[block.style] : defaultStyle;
+}
@@ -2,42 +2,97 @@
 
 #include "TextBlock.hpp"
 #include "HtmlEntities.hpp"
+#include "StyleSheet.hpp"
 #include <pugixml/pugixml.hpp>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <array>
+#include <memory>
+#include <functional>
+#include <filesystem>
 
 using TextBlocks = std::vector<TextBlock>;
 
+/* Returns parsed stylesheet at given archive path, nullptr if it can't be read */
+using StyleSheetLoader = std::function<std::shared_ptr<const StyleSheet>(const std::filesystem::path &path)>;
+
 class EpubSectionWalker : public pugi::xml_tree_walker
 {
     public:
+        explicit EpubSectionWalker(const std::filesystem::path &basePath = {}, StyleSheetLoader styleSheetLoader = {});
+
         auto for_each(pugi::xml_node &node) -> bool override final;
         auto on_leave(pugi::xml_node &node) -> bool override final;
+        auto end(pugi::xml_node &node) -> bool override final;
 
         [[nodiscard]] auto getTextBlocks() const -> const TextBlocks &;
+        [[nodiscard]] auto getBlockStyles() const -> const BlockStyles &;
 
     private:
+        /* Computed style of an open element, inherited properties are copied from the parent */
+        struct ElementState
+        {
+            TextStyle textStyle;
+            TextAlign textAlign;
+            std::int16_t textIndent;
+            std::int16_t marginLeft; // Sum over the enclosing block elements
+            std::int16_t marginRight;
+            std::int16_t marginBottom; // Own margin of a block element, applied when it's left
+            bool isBlock;
+            bool isHidden;
+            std::size_t blocksCount; // Blocks created before the element was entered
+        };
+
+        /* Heading or paragraph element collecting text of a block */
+        struct OpenBlock
+        {
+            Font font;
+            BlockStyle style;
+        };
+
         static constexpr std::array<std::string, 6> hNodes = {"h1", "h2", "h3", "h4", "h5", "h6"};
         static constexpr std::array<std::string, 2> blockNodes = {"p", "div"};
+        static constexpr std::array<std::string, 2> imageNodes = {"img", "image"};
+        static constexpr std::array<std::string, 3> imageHrefAttributes = {"src", "xlink:href", "href"};
 
+        std::filesystem::path basePath; // Directory of the section, image paths are relative to it
         TextBlocks blocks;
         std::string currentBlockText;
-        std::vector<Font> fontStack;
+        std::vector<StyleRun> currentBlockRuns;
+        bool hasHiddenText = false; // Block with only hidden text is still created, so that block indices don't depend on stylesheets
+        std::vector<OpenBlock> fontStack;
+        std::vector<ElementState> elementStack;
+        std::vector<StyleSheet::Element> elementPath;
+        StyleSheetLoader styleSheetLoader;
+        std::vector<std::shared_ptr<const StyleSheet>> styleSheets; // In document order, the built-in one goes first
+        std::vector<StyleSheet::Match> matches;
+        std::vector<BlockStyle> blockStyles; // Style of each block, interned into the style table when the walk ends
+        BlockStyles styles;
+        std::int16_t pendingMarginTop = 0; // Collapsed margins of the elements preceding the next block
         HtmlEntities htmlEntities;
 
         [[nodiscard]] auto isHeading(const pugi::xml_node &node) const -> bool;
         [[nodiscard]] auto isBlock(const pugi::xml_node &node) const -> bool;
+        [[nodiscard]] auto isImage(const pugi::xml_node &node) const -> bool;
+        auto enterElement(const pugi::xml_node &node) -> void;
+        auto leaveElement() -> void;
+        auto addStyleSheet(const pugi::xml_node &node) -> void;
+        auto pushBlock(TextBlock &&block, BlockStyle style) -> void;
+        auto appendText(std::string_view text) -> void;
+        auto appendImage(const pugi::xml_node &node) -> void;
 };
 
 class EpubSection
 {
     public:
-        EpubSection(const std::string &rawContent = {});
+        EpubSection(const std::string &rawContent = {}, const std::filesystem::path &basePath = {}, StyleSheetLoader styleSheetLoader = {});
         ~EpubSection() = default;
 
         [[nodiscard]] auto getRaw() const -> const std::string &;
         [[nodiscard]] auto getBlocks() const -> const TextBlocks &;
+        [[nodiscard]] auto getStyles() const -> const BlockStyles &;
+        [[nodiscard]] auto getBlockStyle(const TextBlock &block) const -> const BlockStyle &;
 
     private:
         std::string rawContent;
@@ -0,0 +1,300 @@
+#include "SearchIndex.hpp"
+#include <esp_log.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <cstdio>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+
+#define TAG __FILENAME__
+
+namespace
+{
+    auto appendVarint(std::vector<std::uint8_t> &buffer, std::uint32_t value) -> void
+    {
+        while (value >= 0x80) {
+            buffer.push_back((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        buffer.push_back(value);
+    }
+
+    auto readVarint(const std::uint8_t *&data, const std::uint8_t *end) -> std::uint32_t
+    {
+        std::uint32_t value = 0;
+        for (std::uint32_t shift = 0; (data < end) && (shift < 32); shift += 7) {
+            const auto byte = *data++;
+            value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                break;
+            }
+        }
+        return value;
+    }
+
+    auto isWordByte(char c) -> bool
+    {
+        /* Bytes of multibyte UTF-8 characters are treated as letters, there's no Unicode database to do better */
+        const auto byte = static_cast<unsigned char>(c);
+        return (byte >= 0x80) || std::isalnum(byte);
+    }
+
+    auto intersect(const std::vector<SearchHit> &lhs, const std::vector<SearchHit> &rhs) -> std::vector<SearchHit>
+    {
+        std::vector<SearchHit> result;
+        std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(result));
+        return result;
+    }
+}
+
+SearchIndex::SearchIndex(const std::filesystem::path &path, std::uint32_t bookSize)
+{
+    file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        if (errno != ENOENT) {
+            ESP_LOGE(TAG, "Failed to open search index '%s': %s", path.c_str(), std::strerror(errno));
+        }
+        throw std::runtime_error{std::string{"failed to open file "} + path.c_str()};
+    }
+
+    if ((std::fread(&header, sizeof(header), 1, file) != 1) || (header.magic != fileMagic) || 
+        (header.version != fileVersion) || (header.bookSize != bookSize)) {
+        std::fclose(file);
+        throw std::runtime_error{"index outdated or damaged"};
+    }
+
+    /* Sections have to follow each other within the file, each sparse entry takes at least two bytes */
+    const auto fileEnd = [this]() {
+        std::fseek(file, 0, SEEK_END);
+        return static_cast<std::uint32_t>(std::ftell(file));
+    }();
+    if ((header.dictionaryOffset < sizeof(header)) || (header.dictionaryOffset > header.postingsOffset) ||
+        (header.postingsOffset > header.sparseIndexOffset) || (header.sparseIndexOffset > fileEnd) ||
+        (header.sparseIndexCount > (fileEnd - header.sparseIndexOffset) / 2)) {
+        std::fclose(file);
+        throw std::runtime_error{"index outdated or damaged"};
+    }
+
+    /* Load sparse index, it's just a fraction of the terms */
+    const auto data = readBytes(header.sparseIndexOffset, fileEnd - header.sparseIndexOffset);
+    auto it = data.data();
+    const auto end = data.data() + data.size();
+    const auto dictionarySize = header.postingsOffset - header.dictionaryOffset;
+    sparseIndex.reserve(header.sparseIndexCount);
+    for (std::uint32_t entry = 0; (entry < header.sparseIndexCount) && (it < end); ++entry) {
+        const auto dictionaryOffset = readVarint(it, end);
+        const auto termLength = std::min<std::size_t>(readVarint(it, end), end - it);
+        /* Offsets are used to compute the lengths of dictionary parts, so they can't go back or past the dictionary */
+        if ((dictionaryOffset > dictionarySize) || (!sparseIndex.empty() && (dictionaryOffset < sparseIndex.back().dictionaryOffset))) {
+            std::fclose(file);
+            throw std::runtime_error{"index outdated or damaged"};
+        }
+        sparseIndex.push_back({std::string{reinterpret_cast<const char *>(it), termLength}, dictionaryOffset});
+        it += termLength;
+    }
+}
+
+SearchIndex::~SearchIndex() noexcept
+{
+    std::fclose(file);
+}
+
+auto SearchIndex::find(std::string_view query) const -> std::vector<SearchHit>
+{
+    std::vector<SearchHit> hits;
+    bool isFirstTerm = true;
+
+    tokenize(query, [&](std::string_view term) {
+        if (!isFirstTerm && hits.empty()) {
+            return;
+        }
+        auto termHits = findTerm(term);
+        hits = isFirstTerm ? std::move(termHits) : intersect(hits, termHits);
+        isFirstTerm = false;
+    });
+
+    return hits;
+}
+
+auto SearchIndex::isValid(const std::filesystem::path &path, std::uint32_t bookSize) -> bool
+{
+    try {
+        SearchIndex index{path, bookSize};
+        return true;
+    }
+    catch (const std::runtime_error &e) {
+        return false;
+    }
+}
+
+auto SearchIndex::tokenize(std::string_view text, const std::function<void(std::string_view term)> &callback) -> void
+{
+    std::string term;
+    for (std::size_t i = 0; i <= text.size(); ++i) {
+        if ((i < text.size()) && isWordByte(text[i])) {
+            if (term.size() < maxTermLength) {
+                term += static_cast<char>(std::tolower(static_cast<unsigned char>(text[i])));
+            }
+        }
+        else if (!term.empty()) {
+            callback(term);
+            term.clear();
+        }
+    }
+}
+
+auto SearchIndex::findTerm(std::string_view term) const -> std::vector<SearchHit>
+{
+    /* Find the part of the dictionary which could contain the term */
+    const auto sparseEntry = std::upper_bound(sparseIndex.begin(), sparseIndex.end(), term, [](std::string_view term, const SparseEntry &entry) {
+        return term < entry.term;
+    });
+    if (sparseEntry == sparseIndex.begin()) {
+        return {};
+    }
+
+    const auto partStart = std::prev(sparseEntry)->dictionaryOffset;
+    const auto partEnd = (sparseEntry != sparseIndex.end()) ? sparseEntry->dictionaryOffset : (header.postingsOffset - header.dictionaryOffset);
+    const auto part = readBytes(header.dictionaryOffset + partStart, partEnd - partStart);
+
+    /* Scan it sequentially */
+    auto it = part.data();
+    const auto end = part.data() + part.size();
+    while (it < end) {
+        const std::size_t termLength = *it++;
+        if (termLength > static_cast<std::size_t>(end - it)) {
+            break;
+        }
+        const auto entryTerm = std::string_view{reinterpret_cast<const char *>(it), termLength};
+        it += termLength;
+        const auto postingsOffset = readVarint(it, end);
+        const auto postingsLength = readVarint(it, end);
+
+        if (entryTerm < term) {
+            continue;
+        }
+        if (entryTerm > term) {
+            break;
+        }
+
+        /* Decode postings, they can't reach past their section */
+        const auto postingsSize = header.sparseIndexOffset - header.postingsOffset;
+        if ((postingsOffset > postingsSize) || (postingsLength > postingsSize - postingsOffset)) {
+            ESP_LOGE(TAG, "Postings of '%.*s' out of bounds", static_cast<int>(term.size()), term.data());
+            return {};
+        }
+        const auto postings = readBytes(header.postingsOffset + postingsOffset, postingsLength);
+        std::vector<SearchHit> hits;
+        auto posting = postings.data();
+        const auto postingsEnd = postings.data() + postings.size();
+        SearchHit hit{0, 0};
+        while (posting < postingsEnd) {
+            const auto spineDelta = readVarint(posting, postingsEnd);
+            const auto blockValue = readVarint(posting, postingsEnd);
+            hit.spineIndex += spineDelta;
+            hit.blockIndex = (spineDelta > 0) ? blockValue : (hit.blockIndex + blockValue);
+            hits.push_back(hit);
+        }
+        return hits;
+    }
+
+    return {};
+}
+
+auto SearchIndex::readBytes(std::uint32_t offset, std::uint32_t length) const -> std::vector<std::uint8_t>
+{
+    std::vector<std::uint8_t> bytes(length);
+    if ((std::fseek(file, offset, SEEK_SET) != 0) || (std::fread(bytes.data(), 1, length, file) != length)) {
+        ESP_LOGE(TAG, "Failed to read %lu bytes at offset %lu", length, offset);
+        return {};
+    }
+    return bytes;
+}
+
+auto SearchIndexBuilder::addBlock(std::uint32_t spineIndex, std::uint32_t blockIndex, std::string_view text) -> void
+{
+    SearchIndex::tokenize(text, [&](std::string_view term) {
+        auto [it, inserted] = terms.try_emplace(std::string{term});
+        auto &postings = it->second;
+
+        /* Blocks are added in order, so duplicates are always the last posting */
+        if (!inserted && (postings.lastSpineIndex == spineIndex) && (postings.lastBlockIndex == blockIndex)) {
+            return;
+        }
+
+        const auto spineDelta = spineIndex - postings.lastSpineIndex;
+        appendVarint(postings.data, spineDelta);
+        appendVarint(postings.data, (spineDelta > 0) ? blockIndex : (blockIndex - postings.lastBlockIndex));
+        postings.lastSpineIndex = spineIndex;
+        postings.lastBlockIndex = blockIndex;
+    });
+}
+
+auto SearchIndexBuilder::write(const std::filesystem::path &path, std::uint32_t bookSize) const -> bool
+{
+    /* Dictionary has to be sorted for lookups */
+    std::vector<const decltype(terms)::value_type *> sortedTerms;
+    sortedTerms.reserve(terms.size());
+    for (const auto &term : terms) {
+        sortedTerms.push_back(&term);
+    }
+    std::sort(sortedTerms.begin(), sortedTerms.end(), [](const auto *lhs, const auto *rhs) {
+        return lhs->first < rhs->first;
+    });
+
+    std::vector<std::uint8_t> dictionary;
+    std::vector<std::uint8_t> sparseIndex;
+    std::uint32_t postingsOffset = 0;
+    std::uint32_t sparseIndexCount = 0;
+    for (std::size_t index = 0; index < sortedTerms.size(); ++index) {
+        const auto &[term, postings] = *sortedTerms[index];
+
+        if ((index % SearchIndex::sparseIndexInterval) == 0) {
+            appendVarint(sparseIndex, dictionary.size());
+            appendVarint(sparseIndex, term.size());
+            sparseIndex.insert(sparseIndex.end(), term.begin(), term.end());
+            sparseIndexCount++;
+        }
+
+        dictionary.push_back(term.size());
+        dictionary.insert(dictionary.end(), term.begin(), term.end());
+        appendVarint(dictionary, postingsOffset);
+        appendVarint(dictionary, postings.data.size());
+        postingsOffset += postings.data.size();
+    }
+
+    const auto header = SearchIndex::Header{
+        .magic = SearchIndex::fileMagic,
+        .version = SearchIndex::fileVersion,
+        .bookSize = bookSize,
+        .termsCount = static_cast<std::uint32_t>(sortedTerms.size()),
+        .dictionaryOffset = sizeof(SearchIndex::Header),
+        .postingsOffset = static_cast<std::uint32_t>(sizeof(SearchIndex::Header) + dictionary.size()),
+        .sparseIndexOffset = static_cast<std::uint32_t>(sizeof(SearchIndex::Header) + dictionary.size() + postingsOffset),
+        .sparseIndexCount = sparseIndexCount
+    };
+
+    auto file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        ESP_LOGE(TAG, "Failed to create '%s': %s", path.c_str(), std::strerror(errno));
+        return false;
+    }
+
+    auto written = (std::fwrite(&header, sizeof(header), 1, file) == 1) &&
+                   (std::fwrite(dictionary.data(), 1, dictionary.size(), file) == dictionary.size());
+    for (std::size_t index = 0; written && (index < sortedTerms.size()); ++index) {
+        const auto &data = sortedTerms[index]->second.data;
+        written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    }
+    written = written && (std::fwrite(sparseIndex.data(), 1, sparseIndex.size(), file) == sparseIndex.size());
+
+    std::fclose(file);
+    return written;
+}
+
+auto SearchIndexBuilder::clear() -> void
+{
+    terms.clear();
+}
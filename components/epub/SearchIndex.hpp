@@ -0,0 +1,91 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+struct SearchHit
+{
+    std::uint32_t spineIndex;
+    std::uint32_t blockIndex;
+
+    auto operator<=>(const SearchHit &other) const = default;
+};
+
+/* Inverted index file layout:
+ * - header
+ * - dictionary - terms in ascending order, each followed by varint offset and length of its postings
+ * - postings - (spine, block) pairs in ascending order, delta + varint encoded
+ * - sparse index - every n-th term of the dictionary with its offset, loaded to RAM to find the
+ *   small part of the dictionary to be scanned for a term */
+class SearchIndex
+{
+    public:
+        static constexpr auto maxTermLength = 32;
+
+        SearchIndex(const std::filesystem::path &path, std::uint32_t bookSize);
+        ~SearchIndex() noexcept;
+
+        SearchIndex(const SearchIndex &) = delete;
+        auto operator=(const SearchIndex &) -> SearchIndex & = delete;
+
+        /* Returns blocks containing all words of the query */
+        [[nodiscard]] auto find(std::string_view query) const -> std::vector<SearchHit>;
+
+        [[nodiscard]] static auto isValid(const std::filesystem::path &path, std::uint32_t bookSize) -> bool;
+        static auto tokenize(std::string_view text, const std::function<void(std::string_view term)> &callback) -> void;
+
+    private:
+        friend class SearchIndexBuilder;
+
+        static constexpr std::uint32_t fileMagic = 0x58444953; // "SIDX"
+        static constexpr std::uint32_t fileVersion = 3;
+        static constexpr auto sparseIndexInterval = 32; // terms
+
+        struct Header
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t bookSize;
+            std::uint32_t termsCount;
+            std::uint32_t dictionaryOffset;
+            std::uint32_t postingsOffset;
+            std::uint32_t sparseIndexOffset;
+            std::uint32_t sparseIndexCount;
+        };
+
+        struct SparseEntry
+        {
+            std::string term;
+            std::uint32_t dictionaryOffset;
+        };
+
+        std::FILE *file;
+        Header header;
+        std::vector<SparseEntry> sparseIndex;
+
+        [[nodiscard]] auto findTerm(std::string_view term) const -> std::vector<SearchHit>;
+        [[nodiscard]] auto readBytes(std::uint32_t offset, std::uint32_t length) const -> std::vector<std::uint8_t>;
+};
+
+class SearchIndexBuilder
+{
+    public:
+        auto addBlock(std::uint32_t spineIndex, std::uint32_t blockIndex, std::string_view text) -> void;
+        auto write(const std::filesystem::path &path, std::uint32_t bookSize) const -> bool;
+        auto clear() -> void;
+
+    private:
+        struct Postings
+        {
+            std::vector<std::uint8_t> data;
+            std::uint32_t lastSpineIndex;
+            std::uint32_t lastBlockIndex;
+        };
+
+        std::unordered_map<std::string, Postings> terms;
+};
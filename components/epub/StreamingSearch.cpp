@@ -0,0 +1,414 @@
+#include "StreamingSearch.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+#include <utility>
+
+namespace
+{
+    struct NamedEntity
+    {
+        std::string_view name;
+        char replacement;
+    };
+
+    /* pugixml decodes the XML ones, HtmlEntities handles nbsp */
+    constexpr NamedEntity namedEntities[] = {
+        {"amp", '&'},
+        {"lt", '<'},
+        {"gt", '>'},
+        {"quot", '"'},
+        {"apos", '\''},
+        {"nbsp", ' '}
+    };
+
+    constexpr std::string_view blockTags[] = {"p", "div", "h1", "h2", "h3", "h4", "h5", "h6"};
+    constexpr std::string_view imageTags[] = {"img", "image"};
+    constexpr std::string_view commentStart = "!--";
+}
+
+StreamingSearch::StreamingSearch(std::string_view query)
+{
+    /* Lowercase the query and collapse whitespace the same way the scanned text is */
+    auto isSpacePending = false;
+    for (const auto c : query) {
+        if (isSpace(c)) {
+            isSpacePending = !pattern.empty();
+            continue;
+        }
+        if (pattern.size() + (isSpacePending ? 2 : 1) > maxQueryLength) {
+            break;
+        }
+        if (isSpacePending) {
+            pattern.push_back(' ');
+            isSpacePending = false;
+        }
+        pattern.push_back(static_cast<char>(toLower(c)));
+    }
+
+    /* Bad character shifts */
+    shifts.fill(pattern.size());
+    for (std::size_t i = 0; i + 1 < pattern.size(); ++i) {
+        shifts[static_cast<std::uint8_t>(pattern[i])] = pattern.size() - 1 - i;
+    }
+
+    beginSection(0);
+}
+
+auto StreamingSearch::isQueryValid() const -> bool
+{
+    return !pattern.empty();
+}
+
+auto StreamingSearch::beginSection(std::uint32_t spineIndex) -> void
+{
+    this->spineIndex = spineIndex;
+    state = State::Text;
+    blockIndex = 0;
+    openBlocksCount = 0;
+    resetBlock();
+}
+
+auto StreamingSearch::feed(std::string_view markup) -> void
+{
+    for (const auto c : markup) {
+        parseChar(c);
+    }
+}
+
+auto StreamingSearch::endSection() -> void
+{
+    /* Text of an unterminated block is dropped, as the walker does */
+    resetBlock();
+}
+
+auto StreamingSearch::takeHits() -> std::vector<Hit>
+{
+    return std::exchange(hits, {});
+}
+
+auto StreamingSearch::parseChar(char c) -> void
+{
+    switch (state) {
+        case State::Text:
+            if (c == '<') {
+                beginTag();
+            }
+            else if (c == '&') {
+                entity.clear();
+                state = State::Entity;
+            }
+            else {
+                appendText(c);
+            }
+            break;
+
+        case State::Tag:
+            if (c == '>') {
+                endTag();
+                state = State::Text;
+            }
+            else if (!isTagNameComplete) {
+                if ((c == '/') && tagName.empty() && !isClosingTag) {
+                    isClosingTag = true;
+                }
+                else if (isSpace(c) || (c == '/')) {
+                    isTagNameComplete = true;
+                }
+                else if (tagName.size() <= maxTagNameLength) { // Longer names end up not matching any block tag
+                    tagName.push_back(c);
+                    if (tagName == commentStart) {
+                        dashesCount = 0;
+                        state = State::Comment;
+                    }
+                }
+            }
+            else if ((c == '"') || (c == '\'')) {
+                quoteChar = c;
+                state = State::TagQuotedValue;
+            }
+            previousChar = c;
+            break;
+
+        case State::TagQuotedValue:
+            if (c == quoteChar) {
+                state = State::Tag;
+            }
+            previousChar = c;
+            break;
+
+        case State::Comment:
+            if ((c == '>') && (dashesCount >= 2)) {
+                state = State::Text;
+            }
+            dashesCount = (c == '-') ? (dashesCount + 1) : 0;
+            break;
+
+        case State::Entity:
+            if (c == ';') {
+                endEntity();
+                state = State::Text;
+            }
+            else if ((std::isalnum(static_cast<unsigned char>(c)) || (c == '#')) && (entity.size() < maxEntityLength)) {
+                entity.push_back(c);
+            }
+            else {
+                /* Not an entity, pass it through as text */
+                state = State::Text;
+                appendText('&');
+                for (const auto entityChar : entity) {
+                    appendText(entityChar);
+                }
+                parseChar(c);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+auto StreamingSearch::beginTag() -> void
+{
+    /* Pending whitespace is kept, it separates text of inline elements */
+    tagName.clear();
+    isTagNameComplete = false;
+    isClosingTag = false;
+    previousChar = '<';
+    state = State::Tag;
+}
+
+auto StreamingSearch::endTag() -> void
+{
+    if (isImageTag()) {
+        if (!isClosingTag) {
+            addImageBlock();
+        }
+        return;
+    }
+    if (!isBlockTag()) {
+        return;
+    }
+
+    const auto isSelfClosing = (previousChar == '/');
+    if (!isClosingTag) {
+        openBlocksCount++;
+    }
+    if (isClosingTag || isSelfClosing) {
+        endBlock();
+    }
+}
+
+auto StreamingSearch::endEntity() -> void
+{
+    if (openBlocksCount > 0) {
+        blockHasText = true;
+    }
+
+    if (!entity.empty() && (entity[0] == '#')) {
+        const auto isHex = (entity.size() > 1) && ((entity[1] == 'x') || (entity[1] == 'X'));
+        const auto digits = entity.c_str() + (isHex ? 2 : 1);
+        char *end;
+        const auto codepoint = std::strtoul(digits, &end, isHex ? 16 : 10);
+        if ((end != digits) && (*end == '\0') && (codepoint > 0) && (codepoint <= 0x10FFFF)) {
+            appendCodepoint(static_cast<std::uint32_t>(codepoint));
+            return;
+        }
+    }
+    else {
+        const auto it = std::find_if(std::begin(namedEntities), std::end(namedEntities), [this](const auto &namedEntity) {
+            return namedEntity.name == entity;
+        });
+        if (it != std::end(namedEntities)) {
+            appendText(it->replacement);
+            return;
+        }
+    }
+
+    /* Unknown entity is left as it is */
+    appendText('&');
+    for (const auto c : entity) {
+        appendText(c);
+    }
+    appendText(';');
+}
+
+auto StreamingSearch::appendText(char c) -> void
+{
+    if (openBlocksCount == 0) {
+        return;
+    }
+
+    /* Whitespace runs are collapsed to a single space, leading whitespace of a block is dropped */
+    if (isSpace(c)) {
+        isSpacePending = true;
+        return;
+    }
+    if (isSpacePending && blockHasText) {
+        pushWindow(' ');
+    }
+    isSpacePending = false;
+    blockHasText = true;
+    pushWindow(c);
+}
+
+auto StreamingSearch::appendCodepoint(std::uint32_t codepoint) -> void
+{
+    if (codepoint < 0x80) {
+        appendText(static_cast<char>(codepoint));
+    }
+    else if (codepoint < 0x800) {
+        appendText(static_cast<char>(0xC0 | (codepoint >> 6)));
+        appendText(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+    else if (codepoint < 0x10000) {
+        appendText(static_cast<char>(0xE0 | (codepoint >> 12)));
+        appendText(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+        appendText(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+    else {
+        appendText(static_cast<char>(0xF0 | (codepoint >> 18)));
+        appendText(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+        appendText(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+        appendText(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+}
+
+auto StreamingSearch::pushWindow(char c) -> void
+{
+    if (isHitReported) {
+        return;
+    }
+
+    window.push_back(c);
+    if (window.size() >= windowScanThreshold) {
+        scanWindow(false);
+    }
+}
+
+auto StreamingSearch::endBlock() -> void
+{
+    /* Walker creates a block only if some text was collected */
+    if (!blockHasText) {
+        return;
+    }
+
+    scanWindow(true);
+    blockIndex++;
+    if (openBlocksCount > 0) {
+        openBlocksCount--;
+    }
+    resetBlock();
+}
+
+auto StreamingSearch::addImageBlock() -> void
+{
+    /* Walker splits off the text preceding an image, the image itself takes one block */
+    if (blockHasText) {
+        scanWindow(true);
+        blockIndex++;
+        resetBlock();
+    }
+    blockIndex++;
+}
+
+auto StreamingSearch::resetBlock() -> void
+{
+    window.clear();
+    scanStart = 0;
+    matchStart = noMatch;
+    isWindowTrimmed = false;
+    isHitReported = false;
+    blockHasText = false;
+    isSpacePending = false;
+}
+
+auto StreamingSearch::scanWindow(bool isBlockEnd) -> void
+{
+    if (isHitReported) {
+        return;
+    }
+
+    const auto patternLength = pattern.size();
+    if (matchStart == noMatch) {
+        auto position = scanStart;
+        while (position + patternLength <= window.size()) {
+            const auto lastChar = toLower(window[position + patternLength - 1]);
+            const auto isMatch = (lastChar == static_cast<std::uint8_t>(pattern.back())) &&
+                std::equal(pattern.begin(), pattern.end() - 1, window.begin() + position, [](char patternChar, char textChar) {
+                    return toLower(textChar) == static_cast<std::uint8_t>(patternChar);
+                });
+            if (isMatch) {
+                matchStart = position;
+                break;
+            }
+            position += shifts[lastChar];
+        }
+        if (matchStart == noMatch) {
+            scanStart = position;
+        }
+    }
+
+    /* Wait for some text after the match to be shown in the snippet */
+    if ((matchStart != noMatch) && (isBlockEnd || (window.size() >= matchStart + patternLength + snippetBytesAfter))) {
+        reportHit();
+        isHitReported = true;
+        window.clear();
+        return;
+    }
+    if (isBlockEnd) {
+        return;
+    }
+
+    /* Drop the text already scanned, keeping only the context needed for the snippet */
+    const auto keepFrom = (matchStart != noMatch) ? matchStart : scanStart;
+    const auto trimmedBytes = keepFrom - std::min<std::size_t>(keepFrom, snippetBytesBefore);
+    if (trimmedBytes > 0) {
+        window.erase(0, trimmedBytes);
+        if (matchStart != noMatch) {
+            matchStart -= trimmedBytes;
+        }
+        else {
+            scanStart -= trimmedBytes;
+        }
+        isWindowTrimmed = true;
+    }
+}
+
+auto StreamingSearch::reportHit() -> void
+{
+    /* Don't cut UTF-8 characters at the snippet edges */
+    auto start = matchStart - std::min<std::size_t>(matchStart, snippetBytesBefore);
+    while ((start < matchStart) && ((static_cast<std::uint8_t>(window[start]) & 0xC0) == 0x80)) {
+        start++;
+    }
+    auto end = std::min(window.size(), matchStart + pattern.size() + snippetBytesAfter);
+    while ((end > matchStart + pattern.size()) && (end < window.size()) && ((static_cast<std::uint8_t>(window[end]) & 0xC0) == 0x80)) {
+        end--;
+    }
+
+    auto snippet = std::string{(isWindowTrimmed || (start > 0)) ? "..." : ""};
+    snippet.append(window, start, end - start);
+    hits.push_back({{spineIndex, blockIndex}, std::move(snippet)});
+}
+
+auto StreamingSearch::isBlockTag() const -> bool
+{
+    return std::find(std::begin(blockTags), std::end(blockTags), tagName) != std::end(blockTags);
+}
+
+auto StreamingSearch::isImageTag() const -> bool
+{
+    return std::find(std::begin(imageTags), std::end(imageTags), tagName) != std::end(imageTags);
+}
+
+auto StreamingSearch::toLower(char c) -> std::uint8_t
+{
+    /* Only ASCII is case-folded, the same as in the search index */
+    return static_cast<std::uint8_t>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+auto StreamingSearch::isSpace(char c) -> bool
+{
+    return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "SearchIndex.hpp"
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+/* Phrase search over raw section markup fed in chunks of any size, used when the book
+ * has no search index yet. Tags are stripped and entities decoded on the fly, text
+ * is matched with Boyer-Moore-Horspool in a window of bounded size, so memory usage
+ * doesn't depend on the size of the section. Blocks are counted the same way
+ * EpubSectionWalker creates them, so the hits point to the same blocks the page view
+ * shows. Only the first match in each block is reported. */
+class StreamingSearch
+{
+    public:
+        struct Hit
+        {
+            SearchHit position;
+            std::string snippet;
+        };
+
+        static constexpr auto maxQueryLength = 64;
+
+        explicit StreamingSearch(std::string_view query);
+
+        [[nodiscard]] auto isQueryValid() const -> bool;
+
+        auto beginSection(std::uint32_t spineIndex) -> void;
+        auto feed(std::string_view markup) -> void;
+        auto endSection() -> void;
+
+        /* Returns hits found since the previous call */
+        [[nodiscard]] auto takeHits() -> std::vector<Hit>;
+
+    private:
+        static constexpr auto maxTagNameLength = 8;
+        static constexpr auto maxEntityLength = 10;
+        static constexpr auto windowScanThreshold = 512; // bytes
+        static constexpr auto snippetBytesBefore = 24;
+        static constexpr auto snippetBytesAfter = 64;
+        static constexpr auto noMatch = std::string::npos;
+
+        enum class State
+        {
+            Text,
+            Tag,
+            TagQuotedValue,
+            Comment,
+            Entity
+        };
+
+        std::string pattern;
+        std::array<std::size_t, 256> shifts;
+
+        State state;
+        std::string tagName;
+        bool isTagNameComplete;
+        bool isClosingTag;
+        char quoteChar;
+        char previousChar;
+        std::size_t dashesCount;
+        std::string entity;
+
+        std::uint32_t spineIndex;
+        std::uint32_t blockIndex;
+        std::size_t openBlocksCount;
+        bool blockHasText;
+        bool isSpacePending;
+
+        std::string window;
+        std::size_t scanStart;
+        std::size_t matchStart;
+        bool isWindowTrimmed;
+        bool isHitReported;
+
+        std::vector<Hit> hits;
+
+        auto parseChar(char c) -> void;
+        auto beginTag() -> void;
+        auto endTag() -> void;
+        auto endEntity() -> void;
+        auto appendText(char c) -> void;
+        auto appendCodepoint(std::uint32_t codepoint) -> void;
+        auto pushWindow(char c) -> void;
+        auto endBlock() -> void;
+        auto addImageBlock() -> void;
+        auto resetBlock() -> void;
+        auto scanWindow(bool isBlockEnd) -> void;
+        auto reportHit() -> void;
+
+        [[nodiscard]] auto isBlockTag() const -> bool;
+        [[nodiscard]] auto isImageTag() const -> bool;
+        [[nodiscard]] static auto toLower(char c) -> std::uint8_t;
+        [[nodiscard]] static auto isSpace(char c) -> bool;
+};
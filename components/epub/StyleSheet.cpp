@@ -0,0 +1,586 @@
+#include "StyleSheet.hpp"
+#include <esp_log.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+#define TAG __FILENAME__
+
+namespace
+{
+    /* Percentages are resolved against a nominal container width, as block widths are not known before layout */
+    constexpr auto percentBaseEm = 20;
+    constexpr auto emHundredths = 100;
+
+    auto isSpace(char c) -> bool
+    {
+        return std::isspace(static_cast<unsigned char>(c));
+    }
+
+    auto trim(std::string_view text) -> std::string_view
+    {
+        while (!text.empty() && isSpace(text.front())) {
+            text.remove_prefix(1);
+        }
+        while (!text.empty() && isSpace(text.back())) {
+            text.remove_suffix(1);
+        }
+        return text;
+    }
+
+    auto toLower(std::string_view text) -> std::string
+    {
+        std::string lower{text};
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) {
+            return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        });
+        return lower;
+    }
+
+    /* Splits text on whitespace, calls callback for each token until it returns false */
+    template<typename Callback>
+    auto forEachToken(std::string_view text, Callback &&callback) -> void
+    {
+        std::size_t start = 0;
+        while (start < text.size()) {
+            if (isSpace(text[start])) {
+                ++start;
+                continue;
+            }
+            auto end = start;
+            while ((end < text.size()) && !isSpace(text[end])) {
+                ++end;
+            }
+            if (!callback(text.substr(start, end - start))) {
+                return;
+            }
+            start = end;
+        }
+    }
+
+    auto hasToken(std::string_view tokens, std::string_view token) -> bool
+    {
+        auto isFound = false;
+        forEachToken(tokens, [&](std::string_view current) {
+            isFound = (current == token);
+            return !isFound;
+        });
+        return isFound;
+    }
+
+    auto removeComments(std::string_view css) -> std::string
+    {
+        std::string result;
+        result.reserve(css.size());
+        std::size_t start = 0;
+        while (start < css.size()) {
+            const auto commentStart = css.find("/*", start);
+            result += css.substr(start, commentStart - start);
+            if (commentStart == std::string_view::npos) {
+                break;
+            }
+            const auto commentEnd = css.find("*/", commentStart + 2);
+            if (commentEnd == std::string_view::npos) {
+                break;
+            }
+            result += ' ';
+            start = commentEnd + 2;
+        }
+        return result;
+    }
+
+    /* Returns position right after the block opened at given position, nested blocks are skipped as a whole */
+    auto skipBlock(std::string_view css, std::size_t openPosition) -> std::size_t
+    {
+        std::size_t depth = 0;
+        for (auto i = openPosition; i < css.size(); ++i) {
+            if (css[i] == '{') {
+                ++depth;
+            }
+            else if ((css[i] == '}') && (--depth == 0)) {
+                return i + 1;
+            }
+        }
+        return css.size();
+    }
+
+    auto isIdentifierChar(char c) -> bool
+    {
+        return std::isalnum(static_cast<unsigned char>(c)) || (c == '-') || (c == '_') || (static_cast<unsigned char>(c) >= 0x80);
+    }
+}
+
+auto StyleSheet::Declarations::merge(const Declarations &other) -> void
+{
+    const auto mergeProperty = [](auto &property, const auto &otherProperty) {
+        if (otherProperty.has_value()) {
+            property = otherProperty;
+        }
+    };
+
+    mergeProperty(textAlign, other.textAlign);
+    mergeProperty(textIndent, other.textIndent);
+    mergeProperty(marginTop, other.marginTop);
+    mergeProperty(marginBottom, other.marginBottom);
+    mergeProperty(marginLeft, other.marginLeft);
+    mergeProperty(marginRight, other.marginRight);
+    mergeProperty(paddingTop, other.paddingTop);
+    mergeProperty(paddingBottom, other.paddingBottom);
+    mergeProperty(paddingLeft, other.paddingLeft);
+    mergeProperty(paddingRight, other.paddingRight);
+    mergeProperty(isItalic, other.isItalic);
+    mergeProperty(isBold, other.isBold);
+    mergeProperty(display, other.display);
+}
+
+StyleSheet::StyleSheet(std::string_view css)
+{
+    const auto text = removeComments(css);
+    const auto cssText = std::string_view{text};
+
+    std::size_t position = 0;
+    while (position < cssText.size()) {
+        const auto blockStart = cssText.find_first_of("{;@", position);
+        if (blockStart == std::string_view::npos) {
+            break;
+        }
+
+        /* At-rules are skipped, both statements (@import, @charset) and blocks (@media, @font-face) */
+        if (cssText[blockStart] == '@') {
+            const auto end = cssText.find_first_of("{;", blockStart);
+            if (end == std::string_view::npos) {
+                break;
+            }
+            position = (cssText[end] == ';') ? (end + 1) : skipBlock(cssText, end);
+            continue;
+        }
+
+        /* Stray semicolon, e.g. after a rule */
+        if (cssText[blockStart] == ';') {
+            position = blockStart + 1;
+            continue;
+        }
+
+        const auto blockEnd = cssText.find('}', blockStart);
+        if (blockEnd == std::string_view::npos) {
+            break;
+        }
+        const auto declarations = parseDeclarations(cssText.substr(blockStart + 1, blockEnd - blockStart - 1));
+        addRules(cssText.substr(position, blockStart - position), declarations);
+        position = blockEnd + 1;
+    }
+
+    ESP_LOGD(TAG, "Parsed %zu rules", rules.size());
+}
+
+auto StyleSheet::collectMatches(const std::vector<Element> &path, std::uint16_t sheetIndex, std::vector<Match> &matches) const -> void
+{
+    if (path.empty()) {
+        return;
+    }
+
+    /* Only rules whose last compound could match the element are checked */
+    const auto &element = path.back();
+    const auto matchBucket = [&](const RuleIndex &index, std::string_view key) {
+        const auto it = index.find(key);
+        if (it == index.end()) {
+            return;
+        }
+        for (const auto ruleIndex : it->second) {
+            matchRule(ruleIndex, path, sheetIndex, matches);
+        }
+    };
+
+    if (!element.id.empty()) {
+        matchBucket(rulesById, element.id);
+    }
+    std::vector<std::string_view> classes;
+    forEachToken(element.classes, [&](std::string_view className) {
+        if (std::find(classes.begin(), classes.end(), className) == classes.end()) { // Rule would be matched twice for repeated class
+            classes.push_back(className);
+            matchBucket(rulesByClass, className);
+        }
+        return true;
+    });
+    matchBucket(rulesByName, element.name);
+    for (const auto ruleIndex : universalRules) {
+        matchRule(ruleIndex, path, sheetIndex, matches);
+    }
+}
+
+auto StyleSheet::parseDeclarations(std::string_view declarations) -> Declarations
+{
+    Declarations result;
+    std::size_t position = 0;
+    while (position < declarations.size()) {
+        auto end = declarations.find(';', position);
+        if (end == std::string_view::npos) {
+            end = declarations.size();
+        }
+
+        const auto declaration = declarations.substr(position, end - position);
+        position = end + 1;
+
+        const auto colon = declaration.find(':');
+        if (colon == std::string_view::npos) {
+            continue;
+        }
+
+        auto value = trim(declaration.substr(colon + 1));
+        const auto important = value.find('!');
+        if (important != std::string_view::npos) {
+            value = trim(value.substr(0, important));
+        }
+        parseProperty(toLower(trim(declaration.substr(0, colon))), toLower(value), result);
+    }
+    return result;
+}
+
+auto StyleSheet::cascade(std::vector<Match> &matches) -> Declarations
+{
+    /* Later rules of the same specificity win, order holds the stylesheet index in the upper half */
+    std::sort(matches.begin(), matches.end(), [](const auto &a, const auto &b) {
+        return (a.specificity != b.specificity) ? (a.specificity < b.specificity) : (a.order < b.order);
+    });
+
+    Declarations result;
+    for (const auto &match : matches) {
+        result.merge(*match.declarations);
+    }
+    return result;
+}
+
+auto StyleSheet::addRules(std::string_view selectors, const Declarations &declarations) -> void
+{
+    std::size_t position = 0;
+    while (position <= selectors.size()) {
+        auto end = selectors.find(',', position);
+        if (end == std::string_view::npos) {
+            end = selectors.size();
+        }
+
+        auto rule = parseSelector(trim(selectors.substr(position, end - position)));
+        if (rule.has_value()) {
+            rule->declarations = declarations;
+            addRule(std::move(*rule));
+        }
+        position = end + 1;
+    }
+}
+
+auto StyleSheet::addRule(Rule &&rule) -> void
+{
+    if (rules.size() >= maxRulesCount) {
+        ESP_LOGW(TAG, "Too many rules, dropping the rest");
+        return;
+    }
+
+    /* Rule is indexed by the most selective part of its last compound */
+    const auto ruleIndex = static_cast<std::uint16_t>(rules.size());
+    const auto &subject = rule.compounds.back();
+    if (!subject.id.empty()) {
+        rulesById[subject.id].push_back(ruleIndex);
+    }
+    else if (!subject.classes.empty()) {
+        rulesByClass[subject.classes.front()].push_back(ruleIndex);
+    }
+    else if (!subject.name.empty()) {
+        rulesByName[subject.name].push_back(ruleIndex);
+    }
+    else {
+        universalRules.push_back(ruleIndex);
+    }
+    rules.push_back(std::move(rule));
+}
+
+auto StyleSheet::matchRule(std::uint16_t ruleIndex, const std::vector<Element> &path, std::uint16_t sheetIndex, std::vector<Match> &matches) const -> void
+{
+    const auto &rule = rules[ruleIndex];
+    if (matchesFrom(rule, rule.compounds.size() - 1, path, path.size() - 1)) {
+        const auto order = (static_cast<std::uint32_t>(sheetIndex) << 16) | ruleIndex;
+        matches.push_back({rule.specificity, order, &rule.declarations});
+    }
+}
+
+auto StyleSheet::matchesFrom(const Rule &rule, std::size_t compoundIndex, const std::vector<Element> &path, std::size_t pathIndex) -> bool
+{
+    const auto &compound = rule.compounds[compoundIndex];
+    if (!matchesCompound(compound, path[pathIndex])) {
+        return false;
+    }
+    if (compoundIndex == 0) {
+        return true;
+    }
+    if (pathIndex == 0) {
+        return false;
+    }
+
+    if (compound.combinator == Combinator::Child) {
+        return matchesFrom(rule, compoundIndex - 1, path, pathIndex - 1);
+    }
+    for (auto ancestorIndex = pathIndex; ancestorIndex > 0; --ancestorIndex) {
+        if (matchesFrom(rule, compoundIndex - 1, path, ancestorIndex - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto StyleSheet::matchesCompound(const Compound &compound, const Element &element) -> bool
+{
+    if (!compound.name.empty() && (compound.name != element.name)) {
+        return false;
+    }
+    if (!compound.id.empty() && (compound.id != element.id)) {
+        return false;
+    }
+    return std::all_of(compound.classes.begin(), compound.classes.end(), [&](const auto &className) {
+        return hasToken(element.classes, className);
+    });
+}
+
+auto StyleSheet::parseSelector(std::string_view selector) -> std::optional<Rule>
+{
+    if (selector.empty()) {
+        return std::nullopt;
+    }
+
+    Rule rule{};
+    auto combinator = Combinator::Descendant;
+    std::uint32_t idsCount = 0;
+    std::uint32_t classesCount = 0;
+    std::uint32_t namesCount = 0;
+
+    std::size_t position = 0;
+    while (position < selector.size()) {
+        const auto c = selector[position];
+        if (isSpace(c)) {
+            ++position;
+            continue;
+        }
+        if (c == '>') {
+            combinator = Combinator::Child;
+            ++position;
+            continue;
+        }
+
+        /* Parse compound, anything else than type, class and id makes the whole rule unsupported */
+        Compound compound{};
+        compound.combinator = combinator;
+        combinator = Combinator::Descendant;
+        while ((position < selector.size()) && !isSpace(selector[position]) && (selector[position] != '>')) {
+            const auto prefix = selector[position];
+            if (prefix == '*') {
+                ++position;
+                continue;
+            }
+
+            const auto isPrefixed = (prefix == '.') || (prefix == '#');
+            if (!isPrefixed && !isIdentifierChar(prefix)) {
+                return std::nullopt;
+            }
+
+            const auto start = position + (isPrefixed ? 1 : 0);
+            auto end = start;
+            while ((end < selector.size()) && isIdentifierChar(selector[end])) {
+                ++end;
+            }
+            if (end == start) {
+                return std::nullopt;
+            }
+
+            const auto identifier = selector.substr(start, end - start);
+            if (prefix == '.') {
+                compound.classes.emplace_back(identifier);
+                ++classesCount;
+            }
+            else if (prefix == '#') {
+                compound.id = identifier;
+                ++idsCount;
+            }
+            else {
+                compound.name = toLower(identifier);
+                ++namesCount;
+            }
+            position = end;
+        }
+        rule.compounds.push_back(std::move(compound));
+    }
+
+    if (rule.compounds.empty()) {
+        return std::nullopt;
+    }
+    rule.specificity = idsCount * 10000 + classesCount * 100 + namesCount;
+    return rule;
+}
+
+auto StyleSheet::parseLength(std::string_view value) -> std::optional<std::int16_t>
+{
+    if (value == "auto") { // Only used for centering with margins, which is not supported
+        return 0;
+    }
+
+    const std::string valueString{value};
+    char *unit = nullptr;
+    const auto number = std::strtof(valueString.c_str(), &unit);
+    if (unit == valueString.c_str()) {
+        return std::nullopt;
+    }
+
+    /* Absolute units are converted assuming the usual 16px (12pt) em */
+    const auto unitName = std::string_view{unit};
+    float hundredths;
+    if ((unitName == "em") || (unitName == "rem")) {
+        hundredths = number * emHundredths;
+    }
+    else if (unitName == "ex") {
+        hundredths = number * emHundredths / 2;
+    }
+    else if (unitName == "px") {
+        hundredths = number * emHundredths / 16;
+    }
+    else if (unitName == "pt") {
+        hundredths = number * emHundredths / 12;
+    }
+    else if (unitName == "pc") {
+        hundredths = number * emHundredths;
+    }
+    else if (unitName == "in") {
+        hundredths = number * emHundredths * 6;
+    }
+    else if (unitName == "cm") {
+        hundredths = number * emHundredths * 6 / 2.54f;
+    }
+    else if (unitName == "mm") {
+        hundredths = number * emHundredths * 6 / 25.4f;
+    }
+    else if (unitName == "%") {
+        hundredths = number * percentBaseEm * emHundredths / 100;
+    }
+    else if (unitName.empty() && (number == 0.0f)) {
+        hundredths = 0;
+    }
+    else {
+        return std::nullopt;
+    }
+
+    constexpr auto min = static_cast<float>(std::numeric_limits<std::int16_t>::min());
+    constexpr auto max = static_cast<float>(std::numeric_limits<std::int16_t>::max());
+    return static_cast<std::int16_t>(std::clamp(hundredths, min, max));
+}
+
+auto StyleSheet::parseProperty(std::string_view name, std::string_view value, Declarations &declarations) -> void
+{
+    /* Invalid values are ignored, they don't reset a valid declaration preceding them */
+    const auto setLength = [value](std::optional<std::int16_t> &property) {
+        const auto length = parseLength(value);
+        if (length.has_value()) {
+            property = length;
+        }
+    };
+
+    if (name == "text-align") {
+        if ((value == "left") || (value == "start")) {
+            declarations.textAlign = TextAlign::Left;
+        }
+        else if ((value == "right") || (value == "end")) {
+            declarations.textAlign = TextAlign::Right;
+        }
+        else if (value == "center") {
+            declarations.textAlign = TextAlign::Center;
+        }
+        else if (value == "justify") {
+            declarations.textAlign = TextAlign::Justify;
+        }
+    }
+    else if (name == "text-indent") {
+        setLength(declarations.textIndent);
+    }
+    else if (name == "font-style") {
+        if ((value == "italic") || (value == "oblique")) {
+            declarations.isItalic = true;
+        }
+        else if (value == "normal") {
+            declarations.isItalic = false;
+        }
+    }
+    else if (name == "font-weight") {
+        if ((value == "bold") || (value == "bolder")) {
+            declarations.isBold = true;
+        }
+        else if ((value == "normal") || (value == "lighter")) {
+            declarations.isBold = false;
+        }
+        else if (!value.empty() && std::isdigit(static_cast<unsigned char>(value.front()))) {
+            declarations.isBold = (std::atoi(std::string{value}.c_str()) >= 600);
+        }
+    }
+    else if (name == "display") {
+        if (value == "none") {
+            declarations.display = Display::None;
+        }
+        else if ((value == "inline") || (value == "inline-block")) {
+            declarations.display = Display::Inline;
+        }
+        else if (!value.empty()) {
+            declarations.display = Display::Block;
+        }
+    }
+    else if ((name == "margin") || (name == "padding")) {
+        /* Shorthand with one to four values - top, right, bottom, left, missing ones are copied from the opposite side */
+        std::vector<std::int16_t> lengths;
+        auto isValid = true;
+        forEachToken(value, [&](std::string_view token) {
+            const auto length = parseLength(token);
+            isValid = length.has_value() && (lengths.size() < 4);
+            if (isValid) {
+                lengths.push_back(*length);
+            }
+            return isValid;
+        });
+        if (!isValid || lengths.empty()) {
+            return;
+        }
+
+        const auto top = lengths[0];
+        const auto right = (lengths.size() > 1) ? lengths[1] : top;
+        const auto bottom = (lengths.size() > 2) ? lengths[2] : top;
+        const auto left = (lengths.size() > 3) ? lengths[3] : right;
+        if (name == "margin") {
+            declarations.marginTop = top;
+            declarations.marginRight = right;
+            declarations.marginBottom = bottom;
+            declarations.marginLeft = left;
+        }
+        else {
+            declarations.paddingTop = top;
+            declarations.paddingRight = right;
+            declarations.paddingBottom = bottom;
+            declarations.paddingLeft = left;
+        }
+    }
+    else if (name == "margin-top") {
+        setLength(declarations.marginTop);
+    }
+    else if (name == "margin-bottom") {
+        setLength(declarations.marginBottom);
+    }
+    else if (name == "margin-left") {
+        setLength(declarations.marginLeft);
+    }
+    else if (name == "margin-right") {
+        setLength(declarations.marginRight);
+    }
+    else if (name == "padding-top") {
+        setLength(declarations.paddingTop);
+    }
+    else if (name == "padding-bottom") {
+        setLength(declarations.paddingBottom);
+    }
+    else if (name == "padding-left") {
+        setLength(declarations.paddingLeft);
+    }
+    else if (name == "padding-right") {
+        setLength(declarations.paddingRight);
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "TextBlock.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <optional>
+#include <limits>
+#include <cstdint>
+
+/* Parser of the subset of CSS that matters for reflowed text on e-ink - alignment, indentation,
+ * margins and paddings, italic and bold faces and display. Selectors made of type, class and id
+ * parts joined with descendant or child combinators are supported, rules with anything else
+ * (attributes, pseudo-classes, sibling combinators) are skipped, as well as at-rules. */
+class StyleSheet
+{
+    public:
+        enum class Display : std::uint8_t
+        {
+            Inline,
+            Block,
+            None
+        };
+
+        /* Lengths are in hundredths of em, the same as in BlockStyle */
+        struct Declarations
+        {
+            std::optional<TextAlign> textAlign;
+            std::optional<std::int16_t> textIndent;
+            std::optional<std::int16_t> marginTop;
+            std::optional<std::int16_t> marginBottom;
+            std::optional<std::int16_t> marginLeft;
+            std::optional<std::int16_t> marginRight;
+            std::optional<std::int16_t> paddingTop;
+            std::optional<std::int16_t> paddingBottom;
+            std::optional<std::int16_t> paddingLeft;
+            std::optional<std::int16_t> paddingRight;
+            std::optional<bool> isItalic;
+            std::optional<bool> isBold;
+            std::optional<Display> display;
+
+            /* Properties set in other override these */
+            auto merge(const Declarations &other) -> void;
+        };
+
+        /* Element as seen by selectors, views point into the parsed document */
+        struct Element
+        {
+            std::string_view name;
+            std::string_view id;
+            std::string_view classes; // Space separated
+        };
+
+        /* Rule matching an element, matches of all stylesheets are sorted by precedence before merging */
+        struct Match
+        {
+            std::uint32_t specificity;
+            std::uint32_t order;
+            const Declarations *declarations;
+        };
+
+        explicit StyleSheet(std::string_view css);
+
+        /* Adds rules matching the last element of the path, preceded by its ancestors */
+        auto collectMatches(const std::vector<Element> &path, std::uint16_t sheetIndex, std::vector<Match> &matches) const -> void;
+
+        [[nodiscard]] static auto parseDeclarations(std::string_view declarations) -> Declarations;
+        [[nodiscard]] static auto cascade(std::vector<Match> &matches) -> Declarations;
+
+    private:
+        enum class Combinator : std::uint8_t
+        {
+            Descendant,
+            Child
+        };
+
+        struct Compound
+        {
+            std::string name; // Empty for any element
+            std::string id;
+            std::vector<std::string> classes;
+            Combinator combinator; // Relation to the compound on the left
+        };
+
+        struct Rule
+        {
+            std::vector<Compound> compounds; // The last one is matched against the element itself
+            std::uint32_t specificity;
+            Declarations declarations;
+        };
+
+        using RuleIndex = std::map<std::string, std::vector<std::uint16_t>, std::less<>>;
+
+        static constexpr auto maxRulesCount = std::numeric_limits<std::uint16_t>::max();
+
+        std::vector<Rule> rules;
+        RuleIndex rulesById;
+        RuleIndex rulesByClass;
+        RuleIndex rulesByName;
+        std::vector<std::uint16_t> universalRules;
+
+        auto addRules(std::string_view selectors, const Declarations &declarations) -> void;
+        auto addRule(Rule &&rule) -> void;
+        auto matchRule(std::uint16_t ruleIndex, const std::vector<Element> &path, std::uint16_t sheetIndex, std::vector<Match> &matches) const -> void;
+
+        [[nodiscard]] static auto matchesFrom(const Rule &rule, std::size_t compoundIndex, const std::vector<Element> &path, std::size_t pathIndex) -> bool;
+        [[nodiscard]] static auto matchesCompound(const Compound &compound, const Element &element) -> bool;
+        [[nodiscard]] static auto parseSelector(std::string_view selector) -> std::optional<Rule>;
+        [[nodiscard]] static auto parseLength(std::string_view value) -> std::optional<std::int16_t>;
+        static auto parseProperty(std::string_view name, std::string_view value, Declarations &declarations) -> void;
+};
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <cstdint>
 
 enum class Font
 {
@@ -8,8 +10,53 @@ enum class Font
     Bold
 };
 
+/* Flags, combined for nested emphasis */
+enum class TextStyle : std::uint8_t
+{
+    Regular = 0,
+    Italic = 1 << 0,
+    Bold = 1 << 1,
+    BoldItalic = Italic | Bold
+};
+
+/* Part of the block text drawn in other than regular style, text between runs is regular */
+struct StyleRun
+{
+    std::uint32_t offset;
+    std::uint16_t length;
+    TextStyle style;
+};
+
+enum class TextAlign : std::uint8_t
+{
+    Left,
+    Right,
+    Center,
+    Justify
+};
+
+/* Layout of a block resolved from stylesheets of the section, lengths are in hundredths of em.
+ * Vertical margins include paddings, horizontal ones add up over nested block elements. */
+struct BlockStyle
+{
+    std::int16_t marginTop;
+    std::int16_t marginBottom;
+    std::int16_t marginLeft;
+    std::int16_t marginRight;
+    std::int16_t textIndent;
+    TextAlign textAlign;
+    bool isHidden; // Block is kept, so that block indices don't depend on stylesheets
+
+    auto operator==(const BlockStyle &other) const -> bool = default;
+};
+
+using BlockStyles = std::vector<BlockStyle>;
+
 struct TextBlock
 {
     std::string text;
     Font font;
+    std::vector<StyleRun> runs; // Sorted by offset, not overlapping
+    std::string image; // Archive path of the picture in image block, such block has no text
+    std::uint16_t style; // Index in the style table of the section
 };
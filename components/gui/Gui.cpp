@@ -1,12 +1,42 @@
 #include "Gui.hpp"
 #include "StatusBar.hpp"
 #include "FilesListView.hpp"
+#include "TocListView.hpp"
+#include "Settings.hpp"
+#include <reading_state.h>
+#include <esp_log.h>
+
+#define TAG __FILENAME__
 
 namespace gui
 {
+    namespace
+    {
+        auto resumeReading() -> void
+        {
+            reading_state_t state;
+            const auto err = reading_state_load(&state);
+            if (err != ESP_OK) {
+                ESP_LOGI(TAG, "No reading state to resume, error: %s", esp_err_to_name(err));
+                return;
+            }
+
+            /* Open the book on top of the files list, so that going back from it works as usual */
+            ESP_LOGI(TAG, "Resuming '%s' at section %lu, block %lu, offset %lu", state.book_path, state.spine_index, state.block_index, state.byte_offset);
+            if (!tocListViewCreate(state.book_path)) {
+                reading_state_clear();
+                return;
+            }
+            tocListViewResume({state.spine_index, state.block_index, state.byte_offset});
+        }
+    }
+
     auto create(const std::filesystem::path &rootPath) -> void
     {
+        /* Before any view, so the resumed book is laid out with the chosen fonts from the first page */
+        settingsLoad(rootPath);
         statusBarCreate();
         filesListViewCreate(rootPath);
+        resumeReading();
     }
 }
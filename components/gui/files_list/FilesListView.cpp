@@ -3,10 +3,14 @@
 #include "DirectoryIterator.hpp"
 #include "ErrorPopup.hpp"
 #include "TocListView.hpp"
+#include "RecycledList.hpp"
+#include "ThumbnailCache.hpp"
 #include "Fonts.h"
+#include <eink_worker.h>
 #include <lvgl.h>
 #include <esp_log.h>
 #include <vector>
+#include <algorithm>
 
 #define TAG __FILENAME__
 
@@ -14,11 +18,29 @@ namespace gui
 {
     namespace
     {
-        lv_obj_t *filesList;
+        enum class EntryType
+        {
+            Up,
+            Directory,
+            SupportedFile,
+            UnsupportedFile
+        };
+
+        struct Entry
+        {
+            std::filesystem::path name;
+            EntryType type;
+        };
+
+        std::unique_ptr<RecycledList> filesList;
+        lv_timer_t *thumbnailsTimer;
+        bool isCovered;
+        bool isListed;
+        bool areThumbnailsShown;
 
         std::filesystem::path rootPath;
         std::filesystem::path currentPath;
-        std::vector<std::filesystem::path> currentEntries;
+        std::vector<Entry> currentEntries;
 
         auto reloadList() -> void;
 
@@ -32,76 +54,125 @@ namespace gui
             return path.extension() == ".epub";
         }
 
-        auto upClickCallback(lv_event_t *event) -> void
+        auto getEntryIcon(EntryType type) -> const char *
         {
-            if (!isCurrentPathRoot()) {
-                currentPath = currentPath.parent_path();
-                reloadList();
+            switch (type) {
+                case EntryType::Up:
+                case EntryType::Directory:
+                    return LV_SYMBOL_DIRECTORY;
+                case EntryType::SupportedFile:
+                    return GUI_SYMBOL_BOOK;
+                case EntryType::UnsupportedFile:
+                default:
+                    return LV_SYMBOL_FILE;
             }
         }
 
-        auto directoryClickCallback(lv_event_t *event) -> void
+        auto getListItem(std::size_t entryIndex) -> RecycledList::Item
         {
-            const auto entryIndex = reinterpret_cast<std::size_t>(lv_event_get_user_data(event));
-            currentPath /= currentEntries[entryIndex];
+            const auto &entry = currentEntries[entryIndex];
+            const void *icon = getEntryIcon(entry.type);
+
+            /* Books show generic icon until their covers are loaded in the background */
+            if (entry.type == EntryType::SupportedFile) {
+                if (const auto thumbnail = thumbnailCacheGet(currentPath / entry.name)) {
+                    icon = thumbnail;
+                    areThumbnailsShown = true;
+                }
+            }
+            return {icon, entry.name.string(), 0};
+        }
 
-            reloadList();
+        auto updateGrayscale() -> void
+        {
+            /* Grayscale refreshes are slower, so they are used only when there are covers to show */
+            if (!isCovered) {
+                eink_worker_set_grayscale(areThumbnailsShown);
+            }
         }
 
-        auto supportedFileClickCallback(lv_event_t *event) -> void
+        auto thumbnailsTimerCallback(lv_timer_t *timer) -> void
         {
-            const auto entryIndex = reinterpret_cast<std::size_t>(lv_event_get_user_data(event));
-            tocListViewCreate(currentPath / currentEntries[entryIndex]);
+            const auto loadedBooks = thumbnailCachePoll();
+            if (isCovered) {
+                return;
+            }
+
+            for (const auto &bookPath : loadedBooks) {
+                if (bookPath.parent_path() != currentPath) {
+                    continue;
+                }
+                const auto it = std::find_if(currentEntries.begin(), currentEntries.end(), [&](const auto &entry) {
+                    return entry.name == bookPath.filename();
+                });
+                if (it != currentEntries.end()) {
+                    filesList->refreshItem(std::distance(currentEntries.begin(), it));
+                }
+            }
+            updateGrayscale();
         }
 
-        auto unsupportedFileClickCallback(lv_event_t *event) -> void
+        auto entryClickCallback(std::size_t entryIndex) -> void
         {
-            const auto entryIndex = reinterpret_cast<std::size_t>(lv_event_get_user_data(event));
-            createErrorPopup("File '" + currentEntries[entryIndex].string() + "' has unsupported format!");
+            const auto &entry = currentEntries[entryIndex];
+            switch (entry.type) {
+                case EntryType::Up:
+                    if (!isCurrentPathRoot()) {
+                        currentPath = currentPath.parent_path();
+                        reloadList();
+                    }
+                    break;
+
+                case EntryType::Directory:
+                    currentPath /= entry.name;
+                    reloadList();
+                    break;
+
+                case EntryType::SupportedFile:
+                    tocListViewCreate(currentPath / entry.name);
+                    break;
+
+                case EntryType::UnsupportedFile:
+                    createErrorPopup("File '" + entry.name.string() + "' has unsupported format!");
+                    break;
+
+                default:
+                    break;
+            }
         }
 
         auto reloadList() -> void
         {
-            /* Delete current list contents */
-            lv_obj_clean(filesList);
+            isListed = true;
+            currentEntries.clear();
+            areThumbnailsShown = false;
+            thumbnailCacheCancel(); // Thumbnails of the previous directory are not needed anymore
 
-            /* Create directory up button */
+            /* Add directory up entry */
             if (!isCurrentPathRoot()) {
-                auto upButton = lv_list_add_btn(filesList, LV_SYMBOL_DIRECTORY, "..");
-                lv_obj_set_style_text_font(upButton, &gui_montserrat_medium_36, LV_PART_MAIN);
-                lv_obj_set_style_pad_top(upButton, style::button::padTop, LV_PART_MAIN);
-                lv_obj_set_style_pad_bottom(upButton, style::button::padBottom, LV_PART_MAIN);
-                lv_obj_add_event_cb(upButton, upClickCallback, LV_EVENT_CLICKED, nullptr);
+                currentEntries.push_back({"..", EntryType::Up});
             }
 
-            /* Create new entries */
-            std::size_t entryIndex = 0;
-            currentEntries.clear();
+            /* Collect new entries, rows for them are created only when they become visible */
             for (const auto &entry : fs::DirectoryIterator(currentPath)) {
-                currentEntries.emplace_back(entry.path().filename());
-
-                lv_obj_t *entryButton;
+                auto filename = entry.path().filename();
+                if (filename.string().starts_with('.')) { // Hidden files, e.g. reader's caches
+                    continue;
+                }
                 if (entry.is_directory()) {
-                    entryButton = lv_list_add_btn(filesList, LV_SYMBOL_DIRECTORY, entry.path().filename().c_str());
-                    lv_obj_add_event_cb(entryButton, directoryClickCallback, LV_EVENT_CLICKED, reinterpret_cast<void *>(entryIndex)); // This is very ugly hack...
+                    currentEntries.push_back({std::move(filename), EntryType::Directory});
                 }
                 else if (isSupportedFile(entry.path())) {
-                    entryButton = lv_list_add_btn(filesList, GUI_SYMBOL_BOOK, currentEntries.back().c_str());
-                    lv_obj_add_event_cb(entryButton, supportedFileClickCallback, LV_EVENT_CLICKED, reinterpret_cast<void *>(entryIndex));
+                    currentEntries.push_back({std::move(filename), EntryType::SupportedFile});
                 }
                 else {
-                    entryButton = lv_list_add_btn(filesList, LV_SYMBOL_FILE, currentEntries.back().c_str());
-                    lv_obj_add_event_cb(entryButton, unsupportedFileClickCallback, LV_EVENT_CLICKED, reinterpret_cast<void *>(entryIndex));
+                    currentEntries.push_back({std::move(filename), EntryType::UnsupportedFile});
                 }
-
-                lv_obj_set_style_text_font(entryButton, &gui_montserrat_medium_36, LV_PART_MAIN);
-                lv_obj_set_style_pad_top(entryButton, style::button::padTop, LV_PART_MAIN);
-                lv_obj_set_style_pad_bottom(entryButton, style::button::padBottom, LV_PART_MAIN);
-                auto entryButtonLabel = lv_obj_get_child(entryButton, lv_obj_get_child_cnt(entryButton) - 1); // Label is created as a last child
-                lv_label_set_long_mode(entryButtonLabel, LV_LABEL_LONG_WRAP); // Disable scrolling, just wrap the text
-
-                entryIndex++;
             }
+
+            filesList->setItemCount(currentEntries.size());
+            filesList->scrollToTop();
+            updateGrayscale();
         }
     }
 
@@ -110,11 +181,41 @@ namespace gui
         rootPath = path;
         currentPath = rootPath;
 
-        filesList = lv_list_create(lv_scr_act());
-        lv_obj_set_size(filesList, style::width, style::height);
-        lv_obj_align(filesList, LV_ALIGN_TOP_MID, 0, style::offsetY);
-        lv_obj_clear_flag(filesList, LV_OBJ_FLAG_SCROLL_ELASTIC);
+        filesList = std::make_unique<RecycledList>(lv_scr_act(), style::width, style::height, &gui_montserrat_medium_36);
+        lv_obj_align(filesList->getObject(), LV_ALIGN_TOP_MID, 0, style::offsetY);
+        filesList->setItemGetter(getListItem);
+        filesList->setClickCallback(entryClickCallback);
+
+        /* Covers are loaded in the background and shown as they come */
+        thumbnailCacheOpen(rootPath, {style::thumbnail::width, style::thumbnail::height});
+        thumbnailsTimer = lv_timer_create(thumbnailsTimerCallback, style::thumbnail::pollPeriodMs, nullptr);
+
+        /* Directory is read only once the list is seen, a book resumed at boot covers it right away */
+        isListed = false;
+        lv_async_call([](void *) {
+            if (!isCovered && !isListed) {
+                reloadList();
+            }
+        }, nullptr);
+    }
+
+    auto filesListViewSetCovered(bool covered) -> void
+    {
+        isCovered = covered;
+        if (isCovered) {
+            /* Views of the book are text only, page view switches to grayscale by itself for pictures */
+            thumbnailCacheCancel();
+            eink_worker_set_grayscale(false);
+            return;
+        }
+
+        if (!isListed) {
+            reloadList();
+            return;
+        }
 
-        reloadList();
+        /* Rebind the rows, thumbnails requests were dropped when covered */
+        filesList->setItemCount(currentEntries.size());
+        updateGrayscale();
     }
 }
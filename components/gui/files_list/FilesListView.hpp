@@ -5,4 +5,6 @@
 namespace gui
 {
     auto filesListViewCreate(const std::filesystem::path &path) -> void;
+    /* Files list stays under the views of an opened book, it's told when it gets covered by them and uncovered again */
+    auto filesListViewSetCovered(bool covered) -> void;
 }
@@ -9,9 +9,11 @@ namespace gui::style
     inline constexpr auto height = (style::main_area::height - marginTop);
     inline constexpr auto offsetY = (style::main_area::minY + marginTop);
 
-    namespace button
+    namespace thumbnail
     {
-        inline constexpr auto padTop = 20;
-        inline constexpr auto padBottom = 20;
+        /* Fits in a list row with a few pixels of margin */
+        inline constexpr auto width = 54;
+        inline constexpr auto height = 72;
+        inline constexpr auto pollPeriodMs = 250;
     }
 }
@@ -0,0 +1,93 @@
+#include "AdvanceCache.hpp"
+
+namespace gui
+{
+    namespace
+    {
+        constexpr auto widthBits = 16;
+
+        /* Fibonacci hashing, spreads keys of neighbouring letters over the table */
+        auto getSlot(std::uint64_t key, std::size_t tableSize) -> std::size_t
+        {
+            return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 40) & (tableSize - 1);
+        }
+    }
+
+    AdvanceCache::AdvanceCache(const lv_font_t *font)
+        : font{font}, widths(arrayCodepointsCount, unknownWidth), table(initialTableSize, 0), tableCount{0}, statistics{0, 0, 0} {}
+
+    auto AdvanceCache::getWidth(std::uint32_t letter, std::uint32_t letterNext) -> lv_coord_t
+    {
+        std::lock_guard lock{mutex};
+
+        if ((letterNext == 0) && (letter < arrayCodepointsCount)) {
+            auto &width = widths[letter];
+            if (width != unknownWidth) {
+                statistics.hits++;
+                return static_cast<lv_coord_t>(width);
+            }
+            statistics.misses++;
+            width = lv_font_get_glyph_width(font, letter, 0);
+            return static_cast<lv_coord_t>(width);
+        }
+
+        /* Invalid codepoints are not cached */
+        if (((letter >> codepointBits) != 0) || ((letterNext >> codepointBits) != 0)) {
+            statistics.misses++;
+            return static_cast<lv_coord_t>(lv_font_get_glyph_width(font, letter, letterNext));
+        }
+
+        /* Key is never 0, the letter is outside of the array or the next one is given */
+        const auto key = (static_cast<std::uint64_t>(letter) << codepointBits) | letterNext;
+        const auto entry = table[findInTable(key)];
+        if (entry != 0) {
+            statistics.hits++;
+            return static_cast<lv_coord_t>(entry & ((1U << widthBits) - 1));
+        }
+
+        statistics.misses++;
+        const auto width = static_cast<lv_coord_t>(lv_font_get_glyph_width(font, letter, letterNext));
+        insertToTable(key, width);
+        return width;
+    }
+
+    auto AdvanceCache::getStatistics() const -> Statistics
+    {
+        std::lock_guard lock{mutex};
+
+        auto result = statistics;
+        result.size = (widths.size() * sizeof(widths.front())) + (table.size() * sizeof(table.front()));
+        return result;
+    }
+
+    auto AdvanceCache::findInTable(std::uint64_t key) const -> std::size_t
+    {
+        /* Table is never full, so the search ends at the key or at an empty slot */
+        auto slot = getSlot(key, table.size());
+        while ((table[slot] != 0) && ((table[slot] >> widthBits) != key)) {
+            slot = (slot + 1) & (table.size() - 1);
+        }
+        return slot;
+    }
+
+    auto AdvanceCache::insertToTable(std::uint64_t key, lv_coord_t width) -> void
+    {
+        /* Table grows when 3/4 full, once at its limit further pairs are just not cached */
+        if (((tableCount + 1) * 4) > (table.size() * 3)) {
+            if (table.size() >= maxTableSize) {
+                return;
+            }
+
+            const auto entries = std::move(table);
+            table.assign(entries.size() * 2, 0);
+            for (const auto entry : entries) {
+                if (entry != 0) {
+                    table[findInTable(entry >> widthBits)] = entry;
+                }
+            }
+        }
+
+        table[findInTable(key)] = (key << widthBits) | static_cast<std::uint16_t>(width);
+        tableCount++;
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <lvgl.h>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+namespace gui
+{
+    /* Widths of letters of a font, as lv_font_get_glyph_width() returns them, kept since the first query,
+     * so that measuring text for pagination and placing letters when drawing don't go through the font
+     * for each letter again. Letters of Latin, Greek and Cyrillic scripts are in an array indexed by the
+     * codepoint, other letters and kerned pairs in a flat hash table of limited size. Fonts must not change
+     * metrics while cached. Safe to use from the UI and indexer tasks. */
+    class AdvanceCache
+    {
+        public:
+            struct Statistics
+            {
+                std::uint32_t hits;
+                std::uint32_t misses;
+                std::size_t size; // Bytes of both tables
+            };
+
+            explicit AdvanceCache(const lv_font_t *font);
+
+            AdvanceCache(const AdvanceCache &) = delete;
+            auto operator=(const AdvanceCache &) -> AdvanceCache & = delete;
+
+            /* Width of the letter followed by the next one, 0 if not kerned */
+            [[nodiscard]] auto getWidth(std::uint32_t letter, std::uint32_t letterNext) -> lv_coord_t;
+
+            [[nodiscard]] auto getStatistics() const -> Statistics;
+
+        private:
+            static constexpr std::uint32_t arrayCodepointsCount = 0x530; // Up to the end of Cyrillic Supplement
+            static constexpr std::uint16_t unknownWidth = 0xFFFF;
+            static constexpr std::uint32_t codepointBits = 21;
+            static constexpr std::size_t initialTableSize = 1024;
+            static constexpr std::size_t maxTableSize = 8192;
+
+            const lv_font_t *font;
+            mutable std::mutex mutex;
+            std::vector<std::uint16_t> widths; // Of single letters up to arrayCodepointsCount
+            std::vector<std::uint64_t> table; // Letter, next letter and width packed, 0 if the slot is empty
+            std::size_t tableCount;
+            Statistics statistics;
+
+            [[nodiscard]] auto findInTable(std::uint64_t key) const -> std::size_t;
+            auto insertToTable(std::uint64_t key, lv_coord_t width) -> void;
+    };
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+namespace gui
+{
+    /* Inclusive range of Unicode codepoints a font has glyphs for */
+    struct CodepointRange
+    {
+        std::uint32_t first;
+        std::uint32_t last;
+    };
+}
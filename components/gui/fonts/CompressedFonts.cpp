@@ -0,0 +1,53 @@
+#include "CompressedFonts.hpp"
+#include "Fonts.h"
+#include <esp_timer.h>
+#include <atomic>
+
+namespace gui
+{
+    namespace
+    {
+        /* Enough for all glyphs of the UI fonts in use at once, the reading fallback fonts evict each other */
+        constexpr auto cacheCapacity = 64 * 1024;
+
+        GlyphCache cache{cacheCapacity};
+        std::atomic<std::uint32_t> decodeTimeUs;
+
+        auto decode(const lv_font_t *font, std::uint32_t letter, std::size_t size, std::vector<std::uint8_t> &bitmap) -> bool
+        {
+            /* Decompressed to LVGL's buffer shared by all fonts, the cache lock keeps others out of it */
+            const auto start = esp_timer_get_time();
+            const auto decoded = lv_font_get_bitmap_fmt_txt(font, letter);
+            if (decoded == nullptr) {
+                return false;
+            }
+            bitmap.assign(decoded, decoded + size);
+            decodeTimeUs += static_cast<std::uint32_t>(esp_timer_get_time() - start);
+            return true;
+        }
+    }
+
+    auto compressedFontsGetStatistics() -> CompressedFontsStatistics
+    {
+        return {cache.getStatistics(), decodeTimeUs};
+    }
+}
+
+extern "C" const uint8_t *gui_font_get_cached_bitmap(const lv_font_t *font, uint32_t letter)
+{
+    if (letter == '\t') {
+        letter = ' ';
+    }
+
+    lv_font_glyph_dsc_t glyph;
+    if (!lv_font_get_glyph_dsc_fmt_txt(font, &glyph, letter, 0) || (glyph.box_w == 0) || (glyph.box_h == 0)) {
+        return nullptr;
+    }
+
+    /* Decompressed bitmaps of 3 bpp fonts are widened to 4 bpp */
+    const auto bpp = static_cast<std::size_t>((glyph.bpp == 3) ? 4 : glyph.bpp);
+    const auto size = (static_cast<std::size_t>(glyph.box_w) * glyph.box_h * bpp + 7) / 8;
+    return gui::cache.get(font, letter, [font, letter, size](std::vector<std::uint8_t> &bitmap) {
+        return gui::decode(font, letter, size, bitmap);
+    });
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "GlyphCache.hpp"
+#include <cstdint>
+
+namespace gui
+{
+    struct CompressedFontsStatistics
+    {
+        GlyphCache::Statistics glyphs;
+        std::uint32_t decodeTimeUs; // Total time spent decompressing the missed glyphs
+    };
+
+    /* Compiled-in fonts are subset and RLE compressed at build time by font_pipeline.py. Their glyphs
+     * are decompressed on first use to a cache shared by all of them, see gui_font_get_cached_bitmap. */
+    [[nodiscard]] auto compressedFontsGetStatistics() -> CompressedFontsStatistics;
+}
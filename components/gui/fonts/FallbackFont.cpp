@@ -0,0 +1,167 @@
+#include "FallbackFont.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace gui
+{
+    FallbackFont::FallbackFont(const std::vector<Link> &chain)
+    {
+        if (chain.empty() || (chain.size() > maxFontsCount)) {
+            throw std::runtime_error{"Invalid length of font chain"};
+        }
+
+        buildTable(chain);
+
+        font = *chain.front().font;
+        font.get_glyph_dsc = getGlyphDsc;
+        font.get_glyph_bitmap = getGlyphBitmap;
+        font.dsc = this;
+        font.fallback = nullptr;
+    }
+
+    auto FallbackFont::get() const -> const lv_font_t *
+    {
+        return &font;
+    }
+
+    auto FallbackFont::getFontsCount() const -> std::size_t
+    {
+        return fonts.size();
+    }
+
+    auto FallbackFont::getTableSize() const -> std::size_t
+    {
+        return (directory.size() * sizeof(directory.front())) + pages.size();
+    }
+
+    auto FallbackFont::getBuiltInRanges(const lv_font_t *font) -> std::vector<CodepointRange>
+    {
+        std::vector<CodepointRange> result;
+        const auto dsc = static_cast<const lv_font_fmt_txt_dsc_t *>(font->dsc);
+        for (std::uint32_t i = 0; i < dsc->cmap_num; ++i) {
+            const auto &cmap = dsc->cmaps[i];
+            if (cmap.unicode_list == nullptr) {
+                if (cmap.range_length != 0) {
+                    result.push_back({cmap.range_start, cmap.range_start + cmap.range_length - 1});
+                }
+                continue;
+            }
+
+            for (std::uint32_t j = 0; j < cmap.list_length; ++j) {
+                const auto codepoint = cmap.range_start + cmap.unicode_list[j];
+                if (!result.empty() && ((result.back().last + 1) == codepoint)) {
+                    result.back().last = codepoint;
+                    continue;
+                }
+                result.push_back({codepoint, codepoint});
+            }
+        }
+        return result;
+    }
+
+    auto FallbackFont::buildTable(const std::vector<Link> &chain) -> void
+    {
+        fonts.reserve(chain.size());
+        for (const auto &link : chain) {
+            fonts.push_back(link.font);
+        }
+
+        /* First pages are shared by whole blocks of one font, in the order of the chain, the last by blocks of no font */
+        const auto sharedPagesCount = static_cast<std::uint16_t>(fonts.size() + 1);
+        pages.resize(sharedPagesCount * pageSize);
+        for (std::uint16_t page = 0; page < sharedPagesCount; ++page) {
+            const auto value = (page < fonts.size()) ? static_cast<std::uint8_t>(page) : noFont;
+            std::fill_n(pages.begin() + (page * pageSize), pageSize, value);
+        }
+        directory.assign(pagesCount, sharedPagesCount - 1);
+
+        /* Fonts are written from the end of the chain, so that the earlier ones overwrite the later */
+        for (auto index = fonts.size(); index-- > 0;) {
+            for (const auto &range : chain[index].ranges) {
+                const auto first = range.first;
+                const auto last = std::min(range.last, codepointsCount - 1);
+                if (first > last) {
+                    continue;
+                }
+
+                for (auto block = first >> pageBits; block <= (last >> pageBits); ++block) {
+                    const auto blockFirst = block << pageBits;
+                    const auto blockLast = blockFirst + pageSize - 1;
+                    if ((first <= blockFirst) && (last >= blockLast)) {
+                        directory[block] = static_cast<std::uint16_t>(index);
+                        continue;
+                    }
+
+                    /* Block partially covered gets its own page, starting as a copy of the shared one */
+                    if (directory[block] < sharedPagesCount) {
+                        const auto page = static_cast<std::uint16_t>(pages.size() / pageSize);
+                        pages.resize(pages.size() + pageSize);
+                        std::copy_n(pages.begin() + (directory[block] * pageSize), pageSize, pages.begin() + (page * pageSize));
+                        directory[block] = page;
+                    }
+
+                    const auto pageStart = pages.begin() + (directory[block] * pageSize);
+                    const auto from = std::max(first, blockFirst) - blockFirst;
+                    const auto to = std::min(last, blockLast) - blockFirst;
+                    std::fill(pageStart + from, pageStart + to + 1, static_cast<std::uint8_t>(index));
+                }
+            }
+        }
+
+        compactPages(sharedPagesCount);
+    }
+
+    auto FallbackFont::compactPages(std::uint16_t sharedPagesCount) -> void
+    {
+        /* Own pages that ended up filled by one font, once the later fonts were overwritten, are shared instead */
+        std::vector<std::uint8_t> compacted{pages.begin(), pages.begin() + (sharedPagesCount * pageSize)};
+        for (auto &page : directory) {
+            if (page < sharedPagesCount) {
+                continue;
+            }
+
+            const auto pageStart = pages.begin() + (page * pageSize);
+            const auto value = *pageStart;
+            if (std::all_of(pageStart, pageStart + pageSize, [value](std::uint8_t entry) { return entry == value; })) {
+                page = (value == noFont) ? (sharedPagesCount - 1) : value;
+                continue;
+            }
+
+            page = static_cast<std::uint16_t>(compacted.size() / pageSize);
+            compacted.insert(compacted.end(), pageStart, pageStart + pageSize);
+        }
+        pages = std::move(compacted);
+    }
+
+    auto FallbackFont::findFont(std::uint32_t letter) const -> const lv_font_t *
+    {
+        if (letter >= codepointsCount) {
+            return nullptr;
+        }
+
+        const auto page = directory[letter >> pageBits];
+        const auto index = pages[(page << pageBits) | (letter & (pageSize - 1))];
+        return (index != noFont) ? fonts[index] : nullptr;
+    }
+
+    auto FallbackFont::getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *glyph, std::uint32_t letter, std::uint32_t letterNext) -> bool
+    {
+        /* Fonts draw tabulator as wide space */
+        const auto self = static_cast<const FallbackFont *>(font->dsc);
+        const auto letterFont = self->findFont((letter == '\t') ? ' ' : letter);
+        if (letterFont == nullptr) {
+            return false;
+        }
+
+        /* Letters of different fonts are not kerned */
+        const auto isNextInFont = (letterNext != 0) && (self->findFont(letterNext) == letterFont);
+        return letterFont->get_glyph_dsc(letterFont, glyph, letter, isNextInFont ? letterNext : 0);
+    }
+
+    auto FallbackFont::getGlyphBitmap(const lv_font_t *font, std::uint32_t letter) -> const std::uint8_t *
+    {
+        const auto self = static_cast<const FallbackFont *>(font->dsc);
+        const auto letterFont = self->findFont((letter == '\t') ? ' ' : letter);
+        return (letterFont != nullptr) ? letterFont->get_glyph_bitmap(letterFont, letter) : nullptr;
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CodepointRange.hpp"
+#include <lvgl.h>
+#include <vector>
+#include <cstdint>
+
+namespace gui
+{
+    /* Chain of fonts presented to LVGL as one - each character is taken from the first font in the chain
+     * that has it. The font of every codepoint is resolved once, when the chain is created, into a two-level
+     * table, so finding it when a glyph is measured or drawn costs two array reads instead of searching the
+     * character map of each font in turn, as LVGL's fallback does. Line metrics are the ones of the first font.
+     * Fonts must outlive the chain. */
+    class FallbackFont
+    {
+        public:
+            struct Link
+            {
+                const lv_font_t *font;
+                std::vector<CodepointRange> ranges;
+            };
+
+            explicit FallbackFont(const std::vector<Link> &chain);
+
+            FallbackFont(const FallbackFont &) = delete;
+            auto operator=(const FallbackFont &) -> FallbackFont & = delete;
+
+            [[nodiscard]] auto get() const -> const lv_font_t *;
+            [[nodiscard]] auto getFontsCount() const -> std::size_t;
+            [[nodiscard]] auto getTableSize() const -> std::size_t; // Bytes of both levels
+
+            /* Codepoints of a compiled-in font in LVGL's format */
+            [[nodiscard]] static auto getBuiltInRanges(const lv_font_t *font) -> std::vector<CodepointRange>;
+
+        private:
+            static constexpr auto pageBits = 8;
+            static constexpr auto pageSize = 1U << pageBits;
+            static constexpr auto codepointsCount = 0x110000U;
+            static constexpr auto pagesCount = codepointsCount / pageSize;
+            static constexpr std::uint8_t noFont = 0xFF;
+            static constexpr auto maxFontsCount = noFont;
+
+            lv_font_t font;
+            std::vector<const lv_font_t *> fonts;
+            std::vector<std::uint16_t> directory; // Page of each block of codepoints
+            std::vector<std::uint8_t> pages; // Index of the font of each codepoint, pages of uniform blocks are shared
+
+            auto buildTable(const std::vector<Link> &chain) -> void;
+            auto compactPages(std::uint16_t sharedPagesCount) -> void;
+            [[nodiscard]] auto findFont(std::uint32_t letter) const -> const lv_font_t *;
+
+            static auto getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *glyph, std::uint32_t letter, std::uint32_t letterNext) -> bool;
+            static auto getGlyphBitmap(const lv_font_t *font, std::uint32_t letter) -> const std::uint8_t *;
+    };
+}
@@ -0,0 +1,546 @@
+#include "FontFile.hpp"
+#include "FontFileReader.hpp"
+#include <esp_log.h>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        constexpr auto labelSize = 8; // Length of the table including the label, then four letters of its name
+        constexpr auto characterRangeRecordSize = 16;
+
+        /* Values of 3 bpp bitmaps are widened to 4 bpp the same way LVGL does it */
+        constexpr std::uint8_t widened3Bpp[] = {0, 2, 4, 6, 9, 11, 13, 15};
+
+        template<typename T>
+        auto readValue(const std::vector<std::uint8_t> &data, std::size_t offset) -> T
+        {
+            T value{};
+            if ((offset + sizeof(T)) <= data.size()) {
+                std::memcpy(&value, &data[offset], sizeof(T));
+            }
+            return value;
+        }
+
+        /* Glyph records are packed bit by bit, most significant bit first */
+        class BitReader
+        {
+            public:
+                BitReader(const std::vector<std::uint8_t> &data, std::size_t position) : data{data}, position{position} {}
+
+                auto read(std::uint8_t count) -> std::uint32_t
+                {
+                    std::uint32_t value = 0;
+                    for (std::uint8_t i = 0; i < count; ++i) {
+                        const auto byteIndex = position / 8;
+                        const auto bit = (byteIndex < data.size()) ? ((data[byteIndex] >> (7 - (position % 8))) & 1) : 0;
+                        value = (value << 1) | bit;
+                        position++;
+                    }
+                    return value;
+                }
+
+                auto readSigned(std::uint8_t count) -> std::int32_t
+                {
+                    const auto value = read(count);
+                    if ((count > 0) && ((value & (1U << (count - 1))) != 0)) {
+                        return static_cast<std::int32_t>(value | (~0U << count));
+                    }
+                    return static_cast<std::int32_t>(value);
+                }
+
+            private:
+                const std::vector<std::uint8_t> &data;
+                std::size_t position;
+        };
+
+        /* LVGL's run-length encoding: values repeated twice are followed by a 1-bit flag for each further repetition,
+         * after 10 of them a 6-bit counter follows */
+        class RleDecoder
+        {
+            public:
+                RleDecoder(BitReader &reader, std::uint8_t bpp) : reader{reader}, bpp{bpp} {}
+
+                auto next() -> std::uint8_t
+                {
+                    switch (state) {
+                        case State::Single: {
+                            const auto value = static_cast<std::uint8_t>(reader.read(bpp));
+                            if (!isFirst && (value == previous)) {
+                                count = 0;
+                                state = State::Repeat;
+                            }
+                            isFirst = false;
+                            previous = value;
+                            return value;
+                        }
+                        case State::Repeat:
+                            count++;
+                            if (reader.read(1) == 0) {
+                                return readSingle();
+                            }
+                            if (count == 11) {
+                                count = static_cast<std::uint8_t>(reader.read(6));
+                                if (count == 0) {
+                                    return readSingle();
+                                }
+                                state = State::Counter;
+                            }
+                            return previous;
+                        case State::Counter:
+                        default:
+                            count--;
+                            if (count == 0) {
+                                return readSingle();
+                            }
+                            return previous;
+                    }
+                }
+
+            private:
+                enum class State
+                {
+                    Single,
+                    Repeat,
+                    Counter
+                };
+
+                BitReader &reader;
+                std::uint8_t bpp;
+                State state = State::Single;
+                std::uint8_t previous = 0;
+                std::uint8_t count = 0;
+                bool isFirst = true;
+
+                auto readSingle() -> std::uint8_t
+                {
+                    previous = static_cast<std::uint8_t>(reader.read(bpp));
+                    state = State::Single;
+                    return previous;
+                }
+        };
+
+        auto writePixel(std::vector<std::uint8_t> &bitmap, std::size_t index, std::uint8_t bpp, std::uint8_t value) -> void
+        {
+            const auto bitOffset = index * bpp;
+            bitmap[bitOffset / 8] |= static_cast<std::uint8_t>(value << (8 - bpp - (bitOffset % 8)));
+        }
+    }
+
+    FontFile::FontFile(const std::filesystem::path &path, GlyphCache &cache)
+        : font{}, cache{cache}, path{path}, header{}, glyphsStart{0}, kerningRightClassesCount{0}
+    {
+        try {
+            std::vector<std::uint8_t> table;
+            const auto headerLength = readTable(0, "head", table);
+            std::memcpy(&header, table.data(), std::min(table.size(), sizeof(header)));
+            const auto bpp = header.bitsPerPixel;
+            if ((bpp != 1) && (bpp != 2) && (bpp != 3) && (bpp != 4) && (bpp != 8)) {
+                throw std::runtime_error{"Unsupported bits per pixel"};
+            }
+
+            const auto characterMapStart = headerLength;
+            const auto characterMapLength = readTable(characterMapStart, "cmap", table);
+            loadCharacterMap(table);
+
+            /* Glyph records are not read until the glyph is used, only the length of their table */
+            const auto glyphOffsetsStart = characterMapStart + characterMapLength;
+            const auto glyphOffsetsLength = readTable(glyphOffsetsStart, "loca", table);
+            glyphsStart = glyphOffsetsStart + glyphOffsetsLength;
+            const auto glyphsLength = readLabel(glyphsStart, "glyf");
+            loadGlyphOffsets(table, glyphsLength);
+
+            if (header.tablesCount >= 4) {
+                readTable(glyphsStart + glyphsLength, "kern", table);
+                loadKerning(table);
+            }
+        }
+        catch (...) {
+            fontFileRelease(path);
+            throw;
+        }
+
+        font.get_glyph_dsc = getGlyphDsc;
+        font.get_glyph_bitmap = getGlyphBitmap;
+        font.line_height = static_cast<lv_coord_t>(header.ascent - header.descent);
+        font.base_line = static_cast<lv_coord_t>(-header.descent);
+        font.subpx = LV_FONT_SUBPX_NONE;
+        font.underline_position = static_cast<std::int8_t>(header.underlinePosition);
+        font.underline_thickness = static_cast<std::int8_t>(header.underlineThickness);
+        font.dsc = this;
+        font.fallback = nullptr;
+
+        ESP_LOGI(TAG, "Loaded %s, %zu glyphs, size %u px, %u bpp", path.c_str(), glyphs.size(), header.fontSize, header.bitsPerPixel);
+    }
+
+    FontFile::~FontFile() noexcept
+    {
+        cache.removeFont(this);
+        fontFileRelease(path);
+    }
+
+    auto FontFile::get() const -> const lv_font_t *
+    {
+        return &font;
+    }
+
+    auto FontFile::getGlyphsCount() const -> std::size_t
+    {
+        return glyphs.size();
+    }
+
+    auto FontFile::getCodepointRanges() const -> std::vector<CodepointRange>
+    {
+        std::vector<CodepointRange> result;
+        for (const auto &range : ranges) {
+            if (range.length == 0) {
+                continue;
+            }
+            const auto isSparse = (range.type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) || (range.type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL);
+            if (!isSparse) {
+                result.push_back({range.start, range.start + range.length - 1});
+                continue;
+            }
+            for (const auto codepoint : range.codepoints) {
+                result.push_back({range.start + codepoint, range.start + codepoint});
+            }
+        }
+        return result;
+    }
+
+    auto FontFile::readLabel(std::uint32_t offset, const char *label) -> std::uint32_t
+    {
+        std::uint32_t length;
+        char name[4];
+        if (!fontFileRead(path, offset, &length, sizeof(length)) || !fontFileRead(path, offset + sizeof(length), name, sizeof(name)) ||
+            (std::memcmp(name, label, sizeof(name)) != 0) || (length < labelSize)) {
+            throw std::runtime_error{std::string{"Invalid font table "} + label};
+        }
+        return length;
+    }
+
+    auto FontFile::readTable(std::uint32_t offset, const char *label, std::vector<std::uint8_t> &table) -> std::uint32_t
+    {
+        const auto length = readLabel(offset, label);
+        table.resize(length - labelSize);
+        if (!fontFileRead(path, offset + labelSize, table.data(), table.size())) {
+            throw std::runtime_error{std::string{"Truncated font table "} + label};
+        }
+        return length;
+    }
+
+    auto FontFile::loadCharacterMap(const std::vector<std::uint8_t> &table) -> void
+    {
+        /* Offsets of range data are relative to the start of the table, including its label */
+        const auto count = readValue<std::uint32_t>(table, 0);
+        if ((4 + static_cast<std::size_t>(count) * characterRangeRecordSize) > table.size()) {
+            throw std::runtime_error{"Invalid character map"};
+        }
+
+        ranges.resize(count);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const auto record = 4 + i * characterRangeRecordSize;
+            const auto rawDataOffset = readValue<std::uint32_t>(table, record);
+            const auto entriesCount = readValue<std::uint16_t>(table, record + 12);
+            auto &range = ranges[i];
+            range.start = readValue<std::uint32_t>(table, record + 4);
+            range.length = readValue<std::uint16_t>(table, record + 8);
+            range.glyphIdStart = readValue<std::uint16_t>(table, record + 10);
+            range.type = readValue<std::uint8_t>(table, record + 14);
+
+            /* Range data has to lie within the table, checks are written so that they can't wrap */
+            const auto isDataValid = [&](std::size_t dataSize) {
+                return (rawDataOffset >= labelSize) && ((rawDataOffset - labelSize) <= table.size()) && (dataSize <= (table.size() - (rawDataOffset - labelSize)));
+            };
+            const std::size_t dataOffset = rawDataOffset - labelSize;
+
+            switch (range.type) {
+                case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                    if (!isDataValid(range.length)) {
+                        throw std::runtime_error{"Invalid character range"};
+                    }
+                    range.glyphIdOffsets.assign(&table[dataOffset], &table[dataOffset] + range.length);
+                    break;
+                case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+                case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY: {
+                    const auto isFull = (range.type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL);
+                    if (!isDataValid(entriesCount * sizeof(std::uint16_t) * (isFull ? 2 : 1))) {
+                        throw std::runtime_error{"Invalid character range"};
+                    }
+                    range.codepoints.resize(entriesCount);
+                    std::memcpy(range.codepoints.data(), &table[dataOffset], entriesCount * sizeof(std::uint16_t));
+                    if (isFull) {
+                        range.glyphIdOffsets.resize(entriesCount);
+                        std::memcpy(range.glyphIdOffsets.data(), &table[dataOffset + entriesCount * sizeof(std::uint16_t)], entriesCount * sizeof(std::uint16_t));
+                    }
+                    break;
+                }
+                case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                    break;
+                default:
+                    throw std::runtime_error{"Unknown character range type"};
+            }
+        }
+    }
+
+    auto FontFile::loadGlyphOffsets(const std::vector<std::uint8_t> &table, std::uint32_t glyphsLength) -> void
+    {
+        const auto count = readValue<std::uint32_t>(table, 0);
+        const auto offsetSize = (header.indexToLocFormat == 0) ? sizeof(std::uint16_t) : sizeof(std::uint32_t);
+        if ((header.indexToLocFormat > 1) || ((4 + static_cast<std::size_t>(count) * offsetSize) > table.size())) {
+            throw std::runtime_error{"Invalid glyph offsets"};
+        }
+
+        glyphOffsets.resize(count + 1);
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const auto offset = 4 + i * offsetSize;
+            glyphOffsets[i] = (offsetSize == sizeof(std::uint16_t)) ? readValue<std::uint16_t>(table, offset) : readValue<std::uint32_t>(table, offset);
+        }
+        glyphOffsets[count] = glyphsLength;
+        glyphs.assign(count, Glyph{});
+    }
+
+    auto FontFile::loadKerning(const std::vector<std::uint8_t> &table) -> void
+    {
+        const auto format = readValue<std::uint8_t>(table, 0);
+        if (format == 0) {
+            /* Sorted pairs of glyph ids, 8 or 16 bits each, followed by the values */
+            const auto count = readValue<std::uint32_t>(table, 4);
+            const auto idSize = (header.glyphIdFormat == 0) ? 1 : 2;
+            const auto valuesOffset = 8 + static_cast<std::size_t>(count) * idSize * 2;
+            if ((valuesOffset + count) > table.size()) {
+                throw std::runtime_error{"Invalid kerning pairs"};
+            }
+
+            kerningPairs.resize(count);
+            for (std::uint32_t i = 0; i < count; ++i) {
+                const auto offset = 8 + i * idSize * 2;
+                const std::uint32_t left = (idSize == 1) ? table[offset] : readValue<std::uint16_t>(table, offset);
+                const std::uint32_t right = (idSize == 1) ? table[offset + 1] : readValue<std::uint16_t>(table, offset + 2);
+                kerningPairs[i] = (left << 16) | right;
+            }
+            kerningPairValues.assign(reinterpret_cast<const std::int8_t *>(&table[valuesOffset]),
+                                     reinterpret_cast<const std::int8_t *>(&table[valuesOffset]) + count);
+        }
+        else if (format == 3) {
+            /* Class of each glyph on the left and on the right side, then values for pairs of classes */
+            const auto mappingLength = readValue<std::uint16_t>(table, 4);
+            const auto rows = readValue<std::uint8_t>(table, 6);
+            const auto columns = readValue<std::uint8_t>(table, 7);
+            const auto valuesOffset = 8 + static_cast<std::size_t>(mappingLength) * 2;
+            if ((valuesOffset + rows * columns) > table.size()) {
+                throw std::runtime_error{"Invalid kerning classes"};
+            }
+
+            kerningLeftClasses.assign(&table[8], &table[8] + mappingLength);
+            kerningRightClasses.assign(&table[8 + mappingLength], &table[8 + mappingLength] + mappingLength);
+
+            /* Classes start from 1 and index the values without further checks */
+            if ((!kerningLeftClasses.empty() && (*std::max_element(kerningLeftClasses.begin(), kerningLeftClasses.end()) > rows)) ||
+                (!kerningRightClasses.empty() && (*std::max_element(kerningRightClasses.begin(), kerningRightClasses.end()) > columns))) {
+                throw std::runtime_error{"Invalid kerning classes"};
+            }
+            kerningClassValues.assign(reinterpret_cast<const std::int8_t *>(&table[valuesOffset]),
+                                      reinterpret_cast<const std::int8_t *>(&table[valuesOffset]) + rows * columns);
+            kerningRightClassesCount = columns;
+        }
+        else {
+            ESP_LOGW(TAG, "Unknown kerning format %u, kerning not used", format);
+        }
+    }
+
+    auto FontFile::getGlyphId(std::uint32_t letter) const -> std::uint32_t
+    {
+        for (const auto &range : ranges) {
+            if ((letter < range.start) || ((letter - range.start) >= range.length)) {
+                continue;
+            }
+
+            const auto offset = letter - range.start;
+            switch (range.type) {
+                case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                    return range.glyphIdStart + offset;
+                case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                    return range.glyphIdStart + range.glyphIdOffsets[offset];
+                default: {
+                    const auto it = std::lower_bound(range.codepoints.begin(), range.codepoints.end(), offset);
+                    if ((it == range.codepoints.end()) || (*it != offset)) {
+                        return 0;
+                    }
+                    const auto index = std::distance(range.codepoints.begin(), it);
+                    return range.glyphIdStart + (range.glyphIdOffsets.empty() ? index : range.glyphIdOffsets[index]);
+                }
+            }
+        }
+        return 0;
+    }
+
+    auto FontFile::getKerning(std::uint32_t leftId, std::uint32_t rightId) const -> std::int32_t
+    {
+        if (!kerningPairs.empty()) {
+            const auto pair = (leftId << 16) | rightId;
+            const auto it = std::lower_bound(kerningPairs.begin(), kerningPairs.end(), pair);
+            return ((it != kerningPairs.end()) && (*it == pair)) ? kerningPairValues[std::distance(kerningPairs.begin(), it)] : 0;
+        }
+
+        /* Class 0 means the glyph is not kerned */
+        if ((leftId >= kerningLeftClasses.size()) || (rightId >= kerningRightClasses.size())) {
+            return 0;
+        }
+        const auto leftClass = kerningLeftClasses[leftId];
+        const auto rightClass = kerningRightClasses[rightId];
+        if ((leftClass == 0) || (rightClass == 0)) {
+            return 0;
+        }
+        return kerningClassValues[(leftClass - 1) * kerningRightClassesCount + (rightClass - 1)];
+    }
+
+    auto FontFile::getGlyph(std::uint32_t glyphId) const -> const Glyph *
+    {
+        std::lock_guard lock{mutex};
+
+        if ((glyphId == 0) || (glyphId >= glyphs.size())) {
+            return nullptr;
+        }
+        auto &glyph = glyphs[glyphId];
+        if (glyph.isLoaded) {
+            return &glyph;
+        }
+
+        std::vector<std::uint8_t> record;
+        if (!readRecord(glyphId, record, true)) {
+            return nullptr;
+        }
+
+        BitReader reader{record, 0};
+        std::uint32_t advance = (header.advanceWidthBits == 0) ? header.defaultAdvanceWidth : reader.read(header.advanceWidthBits);
+        if (header.advanceWidthFormat == 0) {
+            advance *= 16;
+        }
+        glyph.advance = static_cast<std::uint16_t>(advance);
+        glyph.offsetX = static_cast<std::int8_t>(reader.readSigned(header.xyBits));
+        glyph.offsetY = static_cast<std::int8_t>(reader.readSigned(header.xyBits));
+        glyph.width = static_cast<std::uint8_t>(reader.read(header.whBits));
+        glyph.height = static_cast<std::uint8_t>(reader.read(header.whBits));
+        glyph.isLoaded = true;
+        return &glyph;
+    }
+
+    auto FontFile::getBitsPerPixel() const -> std::uint8_t
+    {
+        return (header.bitsPerPixel == 3) ? 4 : header.bitsPerPixel;
+    }
+
+    auto FontFile::readRecord(std::uint32_t glyphId, std::vector<std::uint8_t> &record, bool isHeaderOnly) const -> bool
+    {
+        /* Called with the mutex locked */
+        const auto start = glyphOffsets[glyphId];
+        const auto end = glyphOffsets[glyphId + 1];
+        if (end < start) {
+            return false;
+        }
+
+        const auto headerBits = header.advanceWidthBits + 2 * header.xyBits + 2 * header.whBits;
+        const auto size = isHeaderOnly ? std::min<std::uint32_t>(end - start, (headerBits + 7) / 8) : (end - start);
+        record.resize(size);
+        if (!fontFileRead(path, glyphsStart + start, record.data(), size)) {
+            ESP_LOGE(TAG, "Failed to read glyph %lu", static_cast<unsigned long>(glyphId));
+            return false;
+        }
+        return true;
+    }
+
+    auto FontFile::loadBitmap(std::uint32_t glyphId, const Glyph &glyph, std::vector<std::uint8_t> &bitmap) const -> bool
+    {
+        std::vector<std::uint8_t> record;
+        {
+            std::lock_guard lock{mutex};
+            if (!readRecord(glyphId, record, false)) {
+                return false;
+            }
+        }
+
+        /* Bitmap follows the glyph header without alignment, rows are not padded */
+        const auto headerBits = header.advanceWidthBits + 2 * header.xyBits + 2 * header.whBits;
+        const auto bpp = header.bitsPerPixel;
+        const auto outputBpp = getBitsPerPixel();
+        const auto width = static_cast<std::size_t>(glyph.width);
+        const auto pixelsCount = width * glyph.height;
+        bitmap.assign((pixelsCount * outputBpp + 7) / 8, 0);
+
+        BitReader reader{record, static_cast<std::size_t>(headerBits)};
+        const auto storePixel = [&](std::size_t index, std::uint8_t value) {
+            writePixel(bitmap, index, outputBpp, (bpp == 3) ? widened3Bpp[value & 7] : value);
+        };
+
+        if (header.compression == LV_FONT_FMT_TXT_PLAIN) {
+            for (std::size_t i = 0; i < pixelsCount; ++i) {
+                storePixel(i, static_cast<std::uint8_t>(reader.read(bpp)));
+            }
+            return true;
+        }
+
+        /* With prefilter each row is stored XORed with the previous one */
+        const auto isPrefiltered = (header.compression == LV_FONT_FMT_TXT_COMPRESSED);
+        RleDecoder decoder{reader, bpp};
+        std::vector<std::uint8_t> row(width, 0);
+        for (std::size_t y = 0; y < glyph.height; ++y) {
+            for (std::size_t x = 0; x < width; ++x) {
+                const auto value = decoder.next();
+                row[x] = (isPrefiltered && (y > 0)) ? (row[x] ^ value) : value;
+                storePixel(y * width + x, row[x]);
+            }
+        }
+        return true;
+    }
+
+    auto FontFile::getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *glyph, std::uint32_t letter, std::uint32_t letterNext) -> bool
+    {
+        const auto self = static_cast<const FontFile *>(font->dsc);
+
+        /* Tab is a double space, as in LVGL's fonts */
+        const auto isTab = (letter == '\t');
+        const auto glyphId = self->getGlyphId(isTab ? ' ' : letter);
+        const auto fileGlyph = self->getGlyph(glyphId);
+        if (fileGlyph == nullptr) {
+            return false;
+        }
+
+        /* Advance and kerning are in 1/16 pixel */
+        std::int32_t advance = fileGlyph->advance * (isTab ? 2 : 1);
+        if (letterNext != 0) {
+            const auto nextGlyphId = self->getGlyphId(letterNext);
+            if (nextGlyphId != 0) {
+                advance += (self->getKerning(glyphId, nextGlyphId) * self->header.kerningScale) >> 4;
+            }
+        }
+
+        glyph->adv_w = static_cast<std::uint16_t>(std::max<std::int32_t>((advance + 8) >> 4, 0));
+        glyph->box_w = fileGlyph->width * (isTab ? 2 : 1);
+        glyph->box_h = fileGlyph->height;
+        glyph->ofs_x = fileGlyph->offsetX;
+        glyph->ofs_y = fileGlyph->offsetY;
+        glyph->bpp = self->getBitsPerPixel();
+        glyph->is_placeholder = false;
+        return true;
+    }
+
+    auto FontFile::getGlyphBitmap(const lv_font_t *font, std::uint32_t letter) -> const std::uint8_t *
+    {
+        const auto self = static_cast<const FontFile *>(font->dsc);
+        const auto glyphId = self->getGlyphId((letter == '\t') ? ' ' : letter);
+        const auto fileGlyph = self->getGlyph(glyphId);
+        if ((fileGlyph == nullptr) || (fileGlyph->width == 0) || (fileGlyph->height == 0)) {
+            return nullptr;
+        }
+
+        return self->cache.get(self, glyphId, [self, glyphId, fileGlyph](std::vector<std::uint8_t> &bitmap) {
+            return self->loadBitmap(glyphId, *fileGlyph, bitmap);
+        });
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "GlyphCache.hpp"
+#include "CodepointRange.hpp"
+#include <lvgl.h>
+#include <filesystem>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+namespace gui
+{
+    /* Font in LVGL's binary format (lv_font_conv --format bin) read from the SD card on demand. Character map
+     * and kerning are loaded when the font is opened, metrics of a glyph when it's first measured and bitmaps
+     * through the glyph cache, so only the glyphs in use take memory. File is not kept open, see fontFileRead.
+     * Throws std::runtime_error if the file is not a valid font. Safe to use from the UI and indexer tasks. */
+    class FontFile
+    {
+        public:
+            FontFile(const std::filesystem::path &path, GlyphCache &cache);
+            ~FontFile() noexcept;
+
+            FontFile(const FontFile &) = delete;
+            auto operator=(const FontFile &) -> FontFile & = delete;
+
+            [[nodiscard]] auto get() const -> const lv_font_t *;
+            [[nodiscard]] auto getGlyphsCount() const -> std::size_t;
+            [[nodiscard]] auto getCodepointRanges() const -> std::vector<CodepointRange>;
+
+        private:
+            /* Layout of the "head" table */
+            struct Header
+            {
+                std::uint32_t version;
+                std::uint16_t tablesCount;
+                std::uint16_t fontSize;
+                std::uint16_t ascent;
+                std::int16_t descent;
+                std::uint16_t typoAscent;
+                std::int16_t typoDescent;
+                std::uint16_t typoLineGap;
+                std::int16_t minY;
+                std::int16_t maxY;
+                std::uint16_t defaultAdvanceWidth;
+                std::uint16_t kerningScale;
+                std::uint8_t indexToLocFormat;
+                std::uint8_t glyphIdFormat;
+                std::uint8_t advanceWidthFormat;
+                std::uint8_t bitsPerPixel;
+                std::uint8_t xyBits;
+                std::uint8_t whBits;
+                std::uint8_t advanceWidthBits;
+                std::uint8_t compression;
+                std::uint8_t subpixelsMode;
+                std::uint8_t padding;
+                std::int16_t underlinePosition;
+                std::uint16_t underlineThickness;
+            };
+
+            struct CharacterRange
+            {
+                std::uint32_t start;
+                std::uint32_t length;
+                std::uint16_t glyphIdStart;
+                std::uint8_t type; // One of LV_FONT_FMT_TXT_CMAP_*
+                std::vector<std::uint16_t> codepoints; // Sparse ranges, relative to the start
+                std::vector<std::uint16_t> glyphIdOffsets;
+            };
+
+            struct Glyph
+            {
+                std::uint16_t advance; // In 1/16 pixel
+                std::uint8_t width;
+                std::uint8_t height;
+                std::int8_t offsetX;
+                std::int8_t offsetY;
+                bool isLoaded;
+            };
+
+            lv_font_t font;
+            GlyphCache &cache;
+            std::filesystem::path path;
+            mutable std::mutex mutex; // Guards loading of glyph metrics
+            Header header;
+            std::uint32_t glyphsStart;
+            std::vector<std::uint32_t> glyphOffsets; // One more than glyphs, the last is the end of the table
+            mutable std::vector<Glyph> glyphs;
+            std::vector<CharacterRange> ranges;
+
+            /* Kerning is either a sorted list of glyph pairs (left << 16 | right), or classes of glyphs */
+            std::vector<std::uint32_t> kerningPairs;
+            std::vector<std::int8_t> kerningPairValues;
+            std::vector<std::uint8_t> kerningLeftClasses;
+            std::vector<std::uint8_t> kerningRightClasses;
+            std::vector<std::int8_t> kerningClassValues;
+            std::uint8_t kerningRightClassesCount;
+
+            auto readLabel(std::uint32_t offset, const char *label) -> std::uint32_t;
+            auto readTable(std::uint32_t offset, const char *label, std::vector<std::uint8_t> &table) -> std::uint32_t;
+            auto loadCharacterMap(const std::vector<std::uint8_t> &table) -> void;
+            auto loadGlyphOffsets(const std::vector<std::uint8_t> &table, std::uint32_t glyphsLength) -> void;
+            auto loadKerning(const std::vector<std::uint8_t> &table) -> void;
+
+            [[nodiscard]] auto getGlyphId(std::uint32_t letter) const -> std::uint32_t;
+            [[nodiscard]] auto getKerning(std::uint32_t leftId, std::uint32_t rightId) const -> std::int32_t;
+            [[nodiscard]] auto getGlyph(std::uint32_t glyphId) const -> const Glyph *;
+            [[nodiscard]] auto getBitsPerPixel() const -> std::uint8_t;
+            auto readRecord(std::uint32_t glyphId, std::vector<std::uint8_t> &record, bool isHeaderOnly) const -> bool;
+            auto loadBitmap(std::uint32_t glyphId, const Glyph &glyph, std::vector<std::uint8_t> &bitmap) const -> bool;
+
+            static auto getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *glyph, std::uint32_t letter, std::uint32_t letterNext) -> bool;
+            static auto getGlyphBitmap(const lv_font_t *font, std::uint32_t letter) -> const std::uint8_t *;
+    };
+}
@@ -0,0 +1,51 @@
+#include "FontFileReader.hpp"
+#include <esp_log.h>
+#include <mutex>
+#include <cstdio>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        std::mutex mutex; // Guards the handle and its path
+        std::FILE *file = nullptr;
+        std::filesystem::path openPath;
+
+        auto close() -> void
+        {
+            if (file != nullptr) {
+                std::fclose(file);
+                file = nullptr;
+            }
+            openPath.clear();
+        }
+    }
+
+    auto fontFileRead(const std::filesystem::path &path, std::uint32_t offset, void *data, std::size_t size) -> bool
+    {
+        std::lock_guard lock{mutex};
+
+        if ((file == nullptr) || (openPath != path)) {
+            close();
+            file = std::fopen(path.c_str(), "rb");
+            if (file == nullptr) {
+                ESP_LOGE(TAG, "Failed to open font file '%s'", path.c_str());
+                return false;
+            }
+            openPath = path;
+        }
+
+        return (std::fseek(file, offset, SEEK_SET) == 0) && (std::fread(data, 1, size, file) == size);
+    }
+
+    auto fontFileRelease(const std::filesystem::path &path) -> void
+    {
+        std::lock_guard lock{mutex};
+
+        if (openPath == path) {
+            close();
+        }
+    }
+}
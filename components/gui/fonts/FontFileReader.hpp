@@ -0,0 +1,16 @@
+#pragma once
+
+#include <filesystem>
+#include <cstdint>
+#include <cstddef>
+
+namespace gui
+{
+    /* Font and atlas files are not kept open, FATFS has only a few handles for books, indexes and caches.
+     * All fonts read through one handle, reopened when another file is read. Fonts miss glyphs mostly while
+     * the first pages are laid out, so it's seldom reopened after that. Safe to use from any task. */
+    auto fontFileRead(const std::filesystem::path &path, std::uint32_t offset, void *data, std::size_t size) -> bool;
+
+    /* Closes the handle if it's open for the file, so that it's read anew after being written */
+    auto fontFileRelease(const std::filesystem::path &path) -> void;
+}
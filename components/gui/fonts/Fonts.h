@@ -5,10 +5,20 @@
 LV_FONT_DECLARE(gui_montserrat_medium_20)
 LV_FONT_DECLARE(gui_montserrat_medium_24)
 LV_FONT_DECLARE(gui_montserrat_medium_28)
-LV_FONT_DECLARE(gui_montserrat_medium_30)
 LV_FONT_DECLARE(gui_montserrat_medium_36)
 LV_FONT_DECLARE(gui_montserrat_medium_44)
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bitmap getter of the compiled-in fonts, their bitmaps are compressed and decoded to the glyph cache on first use */
+const uint8_t *gui_font_get_cached_bitmap(const lv_font_t *font, uint32_t letter);
+
+#ifdef __cplusplus
+}
+#endif
+
 #define GUI_SYMBOL_BOOK                     "\xEF\x80\xAD" // 0xF02D
 #define GUI_SYMBOL_BOOK_OPEN                "\xEF\x94\x98" // 0xF518
 
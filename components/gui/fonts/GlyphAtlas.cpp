@@ -0,0 +1,179 @@
+#include "GlyphAtlas.hpp"
+#include "FontFileReader.hpp"
+#include <esp_log.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        constexpr char atlasMagic[4] = {'G', 'A', 'T', 'L'};
+        constexpr std::uint32_t atlasVersion = 1;
+        constexpr std::uint32_t maxBitmapSize = 64 * 1024;
+    }
+
+    GlyphAtlas::GlyphAtlas(const std::filesystem::path &path, std::uint32_t fontId, std::uint32_t glyphsCount)
+        : path{path}, isEnabled{true}, offsets(glyphsCount, 0), end{0}, storedCount{0}
+    {
+        if (load(fontId, glyphsCount)) {
+            ESP_LOGI(TAG, "Atlas '%s' holds %zu glyphs", path.c_str(), storedCount);
+            return;
+        }
+
+        /* Missing, damaged or made for another font */
+        std::fill(offsets.begin(), offsets.end(), 0);
+        storedCount = 0;
+        if (!create(fontId, glyphsCount)) {
+            ESP_LOGE(TAG, "Failed to create atlas '%s', glyphs won't be kept", path.c_str());
+            isEnabled = false;
+            return;
+        }
+        ESP_LOGI(TAG, "Created atlas '%s'", path.c_str());
+    }
+
+    GlyphAtlas::~GlyphAtlas() noexcept
+    {
+        flush();
+        fontFileRelease(path);
+    }
+
+    auto GlyphAtlas::read(std::uint32_t glyphId, std::size_t size, std::vector<std::uint8_t> &bitmap) -> bool
+    {
+        if (!isEnabled || (glyphId >= offsets.size())) {
+            return false;
+        }
+
+        /* Glyph not appended yet is still in memory */
+        const auto pending = std::find_if(pendingGlyphs.begin(), pendingGlyphs.end(), [glyphId](const PendingGlyph &glyph) {
+            return glyph.glyphId == glyphId;
+        });
+        if (pending != pendingGlyphs.end()) {
+            if (pending->bitmap.size() != size) {
+                return false;
+            }
+            bitmap = pending->bitmap;
+            return true;
+        }
+
+        if (offsets[glyphId] == 0) {
+            return false;
+        }
+        RecordHeader record;
+        const auto recordOffset = offsets[glyphId] - sizeof(record);
+        if (!fontFileRead(path, recordOffset, &record, sizeof(record)) || (record.glyphId != glyphId) || (record.size != size)) {
+            return false;
+        }
+        bitmap.resize(size);
+        return fontFileRead(path, offsets[glyphId], bitmap.data(), size);
+    }
+
+    auto GlyphAtlas::write(std::uint32_t glyphId, const std::vector<std::uint8_t> &bitmap) -> void
+    {
+        if (!isEnabled || (glyphId >= offsets.size()) || (bitmap.size() > maxBitmapSize)) {
+            return;
+        }
+
+        pendingGlyphs.push_back({glyphId, bitmap});
+        if (pendingGlyphs.size() >= flushPeriod) {
+            flush();
+        }
+    }
+
+    auto GlyphAtlas::getGlyphsCount() const -> std::size_t
+    {
+        return storedCount + pendingGlyphs.size();
+    }
+
+    auto GlyphAtlas::load(std::uint32_t fontId, std::uint32_t glyphsCount) -> bool
+    {
+        std::error_code error;
+        if (!std::filesystem::exists(path, error)) {
+            return false;
+        }
+
+        Header header;
+        if (!fontFileRead(path, 0, &header, sizeof(header)) || (std::memcmp(header.magic, atlasMagic, sizeof(header.magic)) != 0) ||
+            (header.version != atlasVersion) || (header.fontId != fontId) || (header.glyphsCount != glyphsCount)) {
+            return false;
+        }
+
+        const auto fileSize = static_cast<std::uint32_t>(std::filesystem::file_size(path, error));
+        if (error) {
+            return false;
+        }
+
+        /* Index of the records, the last one may be cut short by a power loss */
+        end = sizeof(header);
+        RecordHeader record;
+        while (fontFileRead(path, end, &record, sizeof(record))) {
+            const auto bitmapOffset = end + sizeof(record);
+            if ((record.glyphId >= glyphsCount) || (record.size > maxBitmapSize) || ((bitmapOffset + record.size) > fileSize)) {
+                break;
+            }
+            if (offsets[record.glyphId] == 0) {
+                storedCount++;
+            }
+            offsets[record.glyphId] = bitmapOffset;
+            end = bitmapOffset + record.size;
+        }
+        return true;
+    }
+
+    auto GlyphAtlas::create(std::uint32_t fontId, std::uint32_t glyphsCount) -> bool
+    {
+        fontFileRelease(path);
+        auto file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        Header header;
+        std::memcpy(header.magic, atlasMagic, sizeof(header.magic));
+        header.version = atlasVersion;
+        header.fontId = fontId;
+        header.glyphsCount = glyphsCount;
+        const auto isWritten = (std::fwrite(&header, sizeof(header), 1, file) == 1);
+        std::fclose(file);
+        end = sizeof(header);
+        return isWritten;
+    }
+
+    auto GlyphAtlas::flush() -> void
+    {
+        if (!isEnabled || pendingGlyphs.empty()) {
+            return;
+        }
+
+        /* Shared handle would keep reading the file as it was before */
+        fontFileRelease(path);
+        auto file = std::fopen(path.c_str(), "r+b");
+        if (file == nullptr) {
+            ESP_LOGE(TAG, "Failed to open atlas '%s', %zu glyphs not stored", path.c_str(), pendingGlyphs.size());
+            pendingGlyphs.clear();
+            return;
+        }
+
+        /* Record is complete only when its bitmap is, a torn one is overwritten by the next after reboot */
+        for (const auto &glyph : pendingGlyphs) {
+            const RecordHeader record{glyph.glyphId, static_cast<std::uint32_t>(glyph.bitmap.size())};
+            if ((std::fseek(file, end, SEEK_SET) != 0) || (std::fwrite(&record, sizeof(record), 1, file) != 1) ||
+                (std::fwrite(glyph.bitmap.data(), 1, glyph.bitmap.size(), file) != glyph.bitmap.size())) {
+                ESP_LOGE(TAG, "Failed to store glyph %lu, atlas disabled", static_cast<unsigned long>(glyph.glyphId));
+                isEnabled = false;
+                break;
+            }
+
+            if (offsets[glyph.glyphId] == 0) {
+                storedCount++;
+            }
+            offsets[glyph.glyphId] = end + sizeof(record);
+            end += sizeof(record) + glyph.bitmap.size();
+        }
+        std::fclose(file);
+        pendingGlyphs.clear();
+    }
+}
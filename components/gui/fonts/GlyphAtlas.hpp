@@ -0,0 +1,63 @@
+#pragma once
+
+#include <filesystem>
+#include <vector>
+#include <cstdint>
+
+namespace gui
+{
+    /* Rasterised glyphs of one font at one size, kept in a file on the SD card across reboots.
+     * Glyphs are only appended, the file is rebuilt when the font or its size changes. Atlas that
+     * can't be read or written is not used, glyphs are then rasterised every time they are loaded.
+     * File is read through fontFileRead and opened for writing only to append the pending glyphs.
+     * Not synchronised, the font owning it guards it with its own lock. */
+    class GlyphAtlas
+    {
+        public:
+            GlyphAtlas(const std::filesystem::path &path, std::uint32_t fontId, std::uint32_t glyphsCount);
+            ~GlyphAtlas() noexcept;
+
+            GlyphAtlas(const GlyphAtlas &) = delete;
+            auto operator=(const GlyphAtlas &) -> GlyphAtlas & = delete;
+
+            /* Bitmap has to be of the given size, stored glyph of another size is treated as missing */
+            auto read(std::uint32_t glyphId, std::size_t size, std::vector<std::uint8_t> &bitmap) -> bool;
+            auto write(std::uint32_t glyphId, const std::vector<std::uint8_t> &bitmap) -> void;
+
+            [[nodiscard]] auto getGlyphsCount() const -> std::size_t;
+
+        private:
+            static constexpr auto flushPeriod = 16; // Glyphs kept in memory before they are appended to the file
+
+            struct Header
+            {
+                char magic[4];
+                std::uint32_t version;
+                std::uint32_t fontId;
+                std::uint32_t glyphsCount;
+            };
+
+            struct RecordHeader
+            {
+                std::uint32_t glyphId;
+                std::uint32_t size;
+            };
+
+            struct PendingGlyph
+            {
+                std::uint32_t glyphId;
+                std::vector<std::uint8_t> bitmap;
+            };
+
+            std::filesystem::path path;
+            bool isEnabled;
+            std::vector<std::uint32_t> offsets; // Of bitmaps in the file, 0 if the glyph is not there
+            std::uint32_t end;
+            std::size_t storedCount;
+            std::vector<PendingGlyph> pendingGlyphs;
+
+            auto load(std::uint32_t fontId, std::uint32_t glyphsCount) -> bool;
+            auto create(std::uint32_t fontId, std::uint32_t glyphsCount) -> bool;
+            auto flush() -> void;
+    };
+}
@@ -0,0 +1,63 @@
+#include "GlyphCache.hpp"
+#include <functional>
+
+namespace gui
+{
+    GlyphCache::GlyphCache(std::size_t capacity) : statistics{0, 0, 0, 0, capacity} {}
+
+    auto GlyphCache::removeFont(const void *font) -> void
+    {
+        std::lock_guard lock{mutex};
+
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (it->key.font != font) {
+                ++it;
+                continue;
+            }
+            statistics.size -= it->bitmap.size();
+            index.erase(it->key);
+            it = entries.erase(it);
+        }
+    }
+
+    auto GlyphCache::getStatistics() const -> Statistics
+    {
+        std::lock_guard lock{mutex};
+        return statistics;
+    }
+
+    auto GlyphCache::KeyHash::operator()(const Key &key) const -> std::size_t
+    {
+        return std::hash<const void *>{}(key.font) ^ (static_cast<std::size_t>(key.glyphId) * 2654435761U);
+    }
+
+    auto GlyphCache::find(const Key &key) -> const std::uint8_t *
+    {
+        const auto it = index.find(key);
+        if (it == index.end()) {
+            statistics.misses++;
+            return nullptr;
+        }
+
+        statistics.hits++;
+        entries.splice(entries.begin(), entries, it->second);
+        return it->second->bitmap.data();
+    }
+
+    auto GlyphCache::insert(const Key &key, std::vector<std::uint8_t> &&bitmap) -> const std::uint8_t *
+    {
+        /* Glyph bigger than the whole cache is still kept, alone */
+        while (!entries.empty() && ((statistics.size + bitmap.size()) > statistics.capacity)) {
+            auto &last = entries.back();
+            statistics.size -= last.bitmap.size();
+            statistics.evictions++;
+            index.erase(last.key);
+            entries.pop_back();
+        }
+
+        statistics.size += bitmap.size();
+        entries.push_front({key, std::move(bitmap)});
+        index.emplace(key, entries.begin());
+        return entries.front().bitmap.data();
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+namespace gui
+{
+    /* Least recently used glyph bitmaps of fonts that are not stored in flash, limited by the total size of
+     * the bitmaps. Bitmaps are allocated with malloc, which places them in PSRAM. Returned bitmap stays valid
+     * until the next glyph is added, which is enough for LVGL drawing letters one by one in its task. */
+    class GlyphCache
+    {
+        public:
+            struct Statistics
+            {
+                std::uint32_t hits;
+                std::uint32_t misses;
+                std::uint32_t evictions;
+                std::size_t size; // Bytes of bitmaps
+                std::size_t capacity;
+            };
+
+            explicit GlyphCache(std::size_t capacity);
+
+            GlyphCache(const GlyphCache &) = delete;
+            auto operator=(const GlyphCache &) -> GlyphCache & = delete;
+
+            /* Returns the cached bitmap, or the one filled by the loader on a miss. Loader returns false if the glyph
+             * can't be loaded, then nullptr is returned and nothing is cached. */
+            template<typename Loader>
+            auto get(const void *font, std::uint32_t glyphId, Loader &&loader) -> const std::uint8_t *
+            {
+                std::lock_guard lock{mutex};
+
+                const auto key = Key{font, glyphId};
+                if (const auto bitmap = find(key); bitmap != nullptr) {
+                    return bitmap;
+                }
+
+                std::vector<std::uint8_t> bitmap;
+                if (!loader(bitmap)) {
+                    return nullptr;
+                }
+                return insert(key, std::move(bitmap));
+            }
+
+            /* Drops all glyphs of the font, must be called before the font is destroyed */
+            auto removeFont(const void *font) -> void;
+
+            [[nodiscard]] auto getStatistics() const -> Statistics;
+
+        private:
+            struct Key
+            {
+                const void *font;
+                std::uint32_t glyphId;
+
+                auto operator==(const Key &other) const -> bool = default;
+            };
+
+            struct KeyHash
+            {
+                auto operator()(const Key &key) const -> std::size_t;
+            };
+
+            struct Entry
+            {
+                Key key;
+                std::vector<std::uint8_t> bitmap;
+            };
+
+            mutable std::mutex mutex;
+            std::list<Entry> entries; // Most recently used first
+            std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+            Statistics statistics;
+
+            auto find(const Key &key) -> const std::uint8_t *;
+            auto insert(const Key &key, std::vector<std::uint8_t> &&bitmap) -> const std::uint8_t *;
+    };
+}
@@ -0,0 +1,124 @@
+#include "GlyphRasterizer.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace gui
+{
+    namespace
+    {
+        /* Curves are flattened to lines deviating less than about a third of a pixel */
+        constexpr auto flatnessTolerance = 3.0f;
+        constexpr auto minCurveDeviation = 0.333f;
+    }
+
+    GlyphRasterizer::GlyphRasterizer(std::uint16_t width, std::uint16_t height)
+        : width{width}, height{height}, stride{static_cast<std::size_t>(width) + 2}, accumulator(stride * height, 0.0f) {}
+
+    auto GlyphRasterizer::addLine(const Point &from, const Point &to) -> void
+    {
+        if (from.y == to.y) {
+            return;
+        }
+
+        /* Edges going down add coverage, edges going up remove it */
+        const auto direction = (from.y < to.y) ? 1.0f : -1.0f;
+        const auto &top = (from.y < to.y) ? from : to;
+        const auto &bottom = (from.y < to.y) ? to : from;
+        const auto slope = (bottom.x - top.x) / (bottom.y - top.y);
+        const auto maxX = static_cast<float>(width);
+        const auto clampX = [maxX](float x) {
+            return std::clamp(x, 0.0f, maxX);
+        };
+
+        auto x = top.x;
+        if (top.y < 0.0f) {
+            x -= top.y * slope;
+        }
+        const auto firstRow = static_cast<std::int32_t>(std::max(top.y, 0.0f));
+        const auto endRow = std::min(static_cast<std::int32_t>(std::ceil(bottom.y)), static_cast<std::int32_t>(height));
+        for (auto row = firstRow; row < endRow; ++row) {
+            auto *line = &accumulator[row * stride];
+            const auto dy = std::min(static_cast<float>(row + 1), bottom.y) - std::max(static_cast<float>(row), top.y);
+            const auto nextX = x + slope * dy;
+            const auto delta = dy * direction;
+            const auto x0 = clampX(std::min(x, nextX));
+            const auto x1 = clampX(std::max(x, nextX));
+            const auto x0Floor = std::floor(x0);
+            const auto x0Index = static_cast<std::int32_t>(x0Floor);
+            const auto x1Ceil = std::ceil(x1);
+            const auto x1Index = static_cast<std::int32_t>(x1Ceil);
+
+            if (x1Index <= (x0Index + 1)) {
+                /* Edge within a single pixel, the part right of it is covered fully */
+                const auto middle = 0.5f * (x0 + x1) - x0Floor;
+                line[x0Index] += delta - delta * middle;
+                line[x0Index + 1] += delta * middle;
+            }
+            else {
+                /* Area under the edge crossing several pixels, the first and the last are partial */
+                const auto inverseWidth = 1.0f / (x1 - x0);
+                const auto x0Fraction = x0 - x0Floor;
+                const auto firstArea = 0.5f * inverseWidth * (1.0f - x0Fraction) * (1.0f - x0Fraction);
+                const auto x1Fraction = x1 - x1Ceil + 1.0f;
+                const auto lastArea = 0.5f * inverseWidth * x1Fraction * x1Fraction;
+                line[x0Index] += delta * firstArea;
+                if (x1Index == (x0Index + 2)) {
+                    line[x0Index + 1] += delta * (1.0f - firstArea - lastArea);
+                }
+                else {
+                    const auto secondArea = inverseWidth * (1.5f - x0Fraction);
+                    line[x0Index + 1] += delta * (secondArea - firstArea);
+                    for (auto column = x0Index + 2; column < (x1Index - 1); ++column) {
+                        line[column] += delta * inverseWidth;
+                    }
+                    const auto beforeLastArea = secondArea + static_cast<float>(x1Index - x0Index - 3) * inverseWidth;
+                    line[x1Index - 1] += delta * (1.0f - beforeLastArea - lastArea);
+                }
+                line[x1Index] += delta * lastArea;
+            }
+            x = nextX;
+        }
+    }
+
+    auto GlyphRasterizer::addQuadratic(const Point &from, const Point &control, const Point &to) -> void
+    {
+        const auto ddx = from.x - 2.0f * control.x + to.x;
+        const auto ddy = from.y - 2.0f * control.y + to.y;
+        const auto deviation = ddx * ddx + ddy * ddy;
+        if (deviation < minCurveDeviation) {
+            addLine(from, to);
+            return;
+        }
+
+        const auto segments = 1 + static_cast<std::int32_t>(std::sqrt(std::sqrt(flatnessTolerance * deviation)));
+        auto previous = from;
+        for (std::int32_t i = 1; i <= segments; ++i) {
+            const auto t = static_cast<float>(i) / static_cast<float>(segments);
+            const auto u = 1.0f - t;
+            const Point next{
+                u * u * from.x + 2.0f * u * t * control.x + t * t * to.x,
+                u * u * from.y + 2.0f * u * t * control.y + t * t * to.y
+            };
+            addLine(previous, next);
+            previous = next;
+        }
+    }
+
+    auto GlyphRasterizer::render(std::vector<std::uint8_t> &bitmap) const -> void
+    {
+        const auto pixelsCount = static_cast<std::size_t>(width) * height;
+        bitmap.assign((pixelsCount + 1) / 2, 0);
+
+        /* Overlapping contours of the same direction add up, coverage is clamped */
+        std::size_t index = 0;
+        for (std::size_t row = 0; row < height; ++row) {
+            auto coverage = 0.0f;
+            const auto *line = &accumulator[row * stride];
+            for (std::size_t column = 0; column < width; ++column, ++index) {
+                coverage += line[column];
+                const auto value = static_cast<std::uint8_t>(std::min(std::abs(coverage), 1.0f) * 15.0f + 0.5f);
+                bitmap[index / 2] |= static_cast<std::uint8_t>(value << (((index % 2) == 0) ? 4 : 0));
+            }
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace gui
+{
+    /* Anti-aliased scan conversion of glyph outlines. Each edge adds the exact area it covers to
+     * an accumulation buffer and coverage of a pixel is the running sum along its row, so there
+     * are no samples and no sorting of edges. Coordinates are in pixels of the bitmap, y down. */
+    class GlyphRasterizer
+    {
+        public:
+            struct Point
+            {
+                float x;
+                float y;
+            };
+
+            GlyphRasterizer(std::uint16_t width, std::uint16_t height);
+
+            auto addLine(const Point &from, const Point &to) -> void;
+            auto addQuadratic(const Point &from, const Point &control, const Point &to) -> void;
+
+            /* Packs coverage to 4 bpp, rows are not padded */
+            auto render(std::vector<std::uint8_t> &bitmap) const -> void;
+
+        private:
+            std::uint16_t width;
+            std::uint16_t height;
+            std::size_t stride; // Two more than width, for edges touching the right side
+            std::vector<float> accumulator;
+    };
+}
@@ -0,0 +1,204 @@
+#include "ReadingFonts.hpp"
+#include "FontFile.hpp"
+#include "TrueTypeFont.hpp"
+#include "FallbackFont.hpp"
+#include "Fonts.h"
+#include "DirectoryIterator.hpp"
+#include <esp_log.h>
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        /* Headings are larger in the ratio of the built-in faces */
+        constexpr std::uint16_t builtInBodySize = 28;
+        constexpr std::uint16_t builtInHeadingSize = 36;
+
+        /* Fonts for characters missing in the family, tried in this order, before the built-in one */
+        constexpr const char *fallbackFontNames[] = {"latin-extended", "cyrillic-greek", "symbols"};
+
+        /* Face is either pre-rasterised or rasterised on the device, nullptr font when neither loaded */
+        struct Face
+        {
+            std::unique_ptr<FontFile> fontFile;
+            std::unique_ptr<TrueTypeFont> trueTypeFont;
+            const lv_font_t *font;
+        };
+
+        /* Family face followed by the fallback faces and the built-in font */
+        struct Chain
+        {
+            Face face;
+            std::vector<Face> fallbackFaces;
+            std::vector<std::string> fallbackNames;
+            std::unique_ptr<FallbackFont> font;
+        };
+
+        std::optional<GlyphCache> cache;
+        Chain bodyChain;
+        Chain headingChain;
+        std::string family;
+
+        template<typename T, typename... Args>
+        auto tryLoad(const std::filesystem::path &path, Args &&...args) -> std::unique_ptr<T>
+        {
+            try {
+                return std::make_unique<T>(path, std::forward<Args>(args)...);
+            }
+            catch (const std::exception &e) {
+                ESP_LOGE(TAG, "Failed to load font '%s': %s", path.c_str(), e.what());
+                return nullptr;
+            }
+        }
+
+        /* Binary font is converted for one size, so one with the size in its name is preferred */
+        auto loadFace(const std::filesystem::path &directory, const char *name, std::uint16_t size) -> Face
+        {
+            Face face{nullptr, nullptr, nullptr};
+
+            const auto sizedName = std::string{name} + "-" + std::to_string(size);
+            for (const auto &fontFilePath : {directory / (sizedName + ".bin"), directory / (std::string{name} + ".bin")}) {
+                if (std::filesystem::exists(fontFilePath)) {
+                    face.fontFile = tryLoad<FontFile>(fontFilePath, *cache);
+                    face.font = (face.fontFile != nullptr) ? face.fontFile->get() : nullptr;
+                    return face;
+                }
+            }
+
+            const auto trueTypePath = directory / (std::string{name} + ".ttf");
+            if (std::filesystem::exists(trueTypePath)) {
+                const auto atlasPath = directory / (sizedName + ".atlas");
+                face.trueTypeFont = tryLoad<TrueTypeFont>(trueTypePath, size, atlasPath, *cache);
+                face.font = (face.trueTypeFont != nullptr) ? face.trueTypeFont->get() : nullptr;
+            }
+            return face;
+        }
+
+        auto getCodepointRanges(const Face &face) -> std::vector<CodepointRange>
+        {
+            return (face.fontFile != nullptr) ? face.fontFile->getCodepointRanges() : face.trueTypeFont->getCodepointRanges();
+        }
+
+        auto loadChain(const std::filesystem::path &familyPath, const std::filesystem::path &fallbackPath, const char *name, std::uint16_t size,
+                       const lv_font_t *builtInFont, std::uint16_t builtInSize) -> Chain
+        {
+            Chain chain{familyPath.empty() ? Face{nullptr, nullptr, nullptr} : loadFace(familyPath, name, size), {}, {}, nullptr};
+            if ((chain.face.font == nullptr) && !familyPath.empty()) {
+                ESP_LOGI(TAG, "No '%s' font in '%s', using the built-in one", name, familyPath.c_str());
+            }
+
+            /* Fallbacks match the size of the face they complete */
+            if (chain.face.font == nullptr) {
+                size = builtInSize;
+            }
+            for (const auto fallbackName : fallbackFontNames) {
+                if (auto face = loadFace(fallbackPath, fallbackName, size); face.font != nullptr) {
+                    chain.fallbackFaces.push_back(std::move(face));
+                    chain.fallbackNames.emplace_back(fallbackName);
+                }
+            }
+
+            /* Built-in font alone needs no chain */
+            if ((chain.face.font == nullptr) && chain.fallbackFaces.empty()) {
+                return chain;
+            }
+
+            /* Built-in font takes place of the missing family face, otherwise it's the last resort */
+            std::vector<FallbackFont::Link> links;
+            if (chain.face.font != nullptr) {
+                links.push_back({chain.face.font, getCodepointRanges(chain.face)});
+            }
+            else {
+                links.push_back({builtInFont, FallbackFont::getBuiltInRanges(builtInFont)});
+            }
+            for (const auto &face : chain.fallbackFaces) {
+                links.push_back({face.font, getCodepointRanges(face)});
+            }
+            if (chain.face.font != nullptr) {
+                links.push_back({builtInFont, FallbackFont::getBuiltInRanges(builtInFont)});
+            }
+
+            chain.font = std::make_unique<FallbackFont>(links);
+            ESP_LOGI(TAG, "Font chain of '%s' %u px: %zu fonts, lookup table %zu bytes", name, size, chain.font->getFontsCount(), chain.font->getTableSize());
+            return chain;
+        }
+
+        auto getChainFont(const Chain &chain, const lv_font_t *builtInFont) -> const lv_font_t *
+        {
+            return (chain.font != nullptr) ? chain.font->get() : builtInFont;
+        }
+    }
+
+    auto readingFontsLoad(const std::filesystem::path &familyPath, const std::filesystem::path &fallbackPath, std::uint16_t bodyFontSize, std::size_t cacheCapacity) -> void
+    {
+        /* Fonts of the previous family drop their glyphs from the cache they were created with */
+        bodyChain = {};
+        headingChain = {};
+        family.clear();
+        cache.emplace(cacheCapacity);
+
+        const auto headingFontSize = static_cast<std::uint16_t>(((bodyFontSize * builtInHeadingSize) + (builtInBodySize / 2)) / builtInBodySize);
+        bodyChain = loadChain(familyPath, fallbackPath, "body", bodyFontSize, &gui_montserrat_medium_28, builtInBodySize);
+        headingChain = loadChain(familyPath, fallbackPath, "heading", headingFontSize, &gui_montserrat_medium_36, builtInHeadingSize);
+
+        /* Fallbacks and sizes change metrics of the text as well, so they are part of the name */
+        if ((bodyChain.face.font != nullptr) || (headingChain.face.font != nullptr)) {
+            family = familyPath.filename().string() + "-" + std::to_string(bodyFontSize);
+        }
+        for (const auto name : fallbackFontNames) {
+            const auto isUsed = [name](const Chain &chain) {
+                return std::find(chain.fallbackNames.begin(), chain.fallbackNames.end(), name) != chain.fallbackNames.end();
+            };
+            if (isUsed(bodyChain) || isUsed(headingChain)) {
+                family += std::string{"+"} + name;
+            }
+        }
+    }
+
+    auto readingFontsGet(Font font) -> const lv_font_t *
+    {
+        switch (font) {
+            case Font::Bold:
+                return getChainFont(headingChain, &gui_montserrat_medium_36);
+            case Font::Normal:
+            default:
+                return getChainFont(bodyChain, &gui_montserrat_medium_28);
+        }
+    }
+
+    auto readingFontsGetFamily() -> const std::string &
+    {
+        return family;
+    }
+
+    auto readingFontsGetFamilies(const std::filesystem::path &fontsPath, const std::filesystem::path &fallbackPath) -> std::vector<std::string>
+    {
+        std::vector<std::string> families;
+        if (!std::filesystem::is_directory(fontsPath)) {
+            return families;
+        }
+
+        for (const auto &entry : fs::DirectoryIterator(fontsPath)) {
+            const auto path = entry.path();
+            const auto name = path.filename().string();
+            if (entry.is_directory() && !name.starts_with('.') && (path != fallbackPath)) {
+                families.push_back(name);
+            }
+        }
+        std::sort(families.begin(), families.end());
+        return families;
+    }
+
+    auto readingFontsGetCacheStatistics() -> GlyphCache::Statistics
+    {
+        return cache.has_value() ? cache->getStatistics() : GlyphCache::Statistics{0, 0, 0, 0, 0};
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "GlyphCache.hpp"
+#include <TextBlock.hpp>
+#include <lvgl.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace gui
+{
+    /* Fonts of the book text. A family is a directory with body and heading fonts, either in LVGL's
+     * binary format (body.bin or body-28.bin) or TrueType (body.ttf) rasterised on the device and kept
+     * in atlas files next to them. Characters missing in the family are taken from fonts in the fallback
+     * directory - latin-extended, cyrillic-greek and symbols, in this order, in the same formats - and
+     * then from the compiled-in Montserrat, which is also used in place of any face that is missing or
+     * broken. Glyph bitmaps of all faces share one cache of the given capacity in bytes. Faces don't keep
+     * their files open, all of them, fallbacks of both chains included, read through one handle.
+     *
+     * TrueType faces are rasterised at the given body size, headings are proportionally larger, binary faces
+     * of that size are preferred. Built-in faces have a fixed size. Empty family path uses only them.
+     *
+     * Fonts have to be loaded before the first page is laid out. Loading them again destroys the previous
+     * ones, nothing may use them then - neither faces derived from them nor the indexer. */
+    auto readingFontsLoad(const std::filesystem::path &familyPath, const std::filesystem::path &fallbackPath, std::uint16_t bodyFontSize, std::size_t cacheCapacity) -> void;
+
+    [[nodiscard]] auto readingFontsGet(Font font) -> const lv_font_t *;
+
+    /* Name and size of the loaded family followed by the fallback fonts, empty when only compiled-in faces are used */
+    [[nodiscard]] auto readingFontsGetFamily() -> const std::string &;
+
+    /* Names of the family directories in the fonts directory, sorted */
+    [[nodiscard]] auto readingFontsGetFamilies(const std::filesystem::path &fontsPath, const std::filesystem::path &fallbackPath) -> std::vector<std::string>;
+
+    [[nodiscard]] auto readingFontsGetCacheStatistics() -> GlyphCache::Statistics;
+}
@@ -0,0 +1,114 @@
+#include "SyntheticFont.hpp"
+#include <algorithm>
+
+namespace gui
+{
+    namespace
+    {
+        /* Reads pixel of a bitmap packed without row padding and scales it to 8 bits */
+        auto readPixel(const std::uint8_t *bitmap, std::uint8_t bpp, std::size_t index) -> std::uint8_t
+        {
+            const auto bitOffset = index * bpp;
+            const auto mask = (1U << bpp) - 1;
+            const auto value = (bitmap[bitOffset / 8] >> (8 - bpp - (bitOffset % 8))) & mask;
+            return static_cast<std::uint8_t>((value * 255) / mask);
+        }
+
+        auto floorDivide(std::int32_t dividend, std::int32_t divisor) -> std::int32_t
+        {
+            const auto quotient = dividend / divisor;
+            return ((dividend % divisor) < 0) ? (quotient - 1) : quotient;
+        }
+    }
+
+    SyntheticFont::SyntheticFont(const lv_font_t *baseFont, bool isBold, bool isItalic)
+        : font{*baseFont}, baseFont{baseFont}, isBold{isBold}, isItalic{isItalic}
+    {
+        font.get_glyph_dsc = getGlyphDsc;
+        font.get_glyph_bitmap = getGlyphBitmap;
+        font.dsc = this;
+        font.fallback = nullptr;
+    }
+
+    auto SyntheticFont::get() const -> const lv_font_t *
+    {
+        return &font;
+    }
+
+    auto SyntheticFont::getShift(const lv_font_glyph_dsc_t &baseGlyph, std::int32_t row) const -> std::int32_t
+    {
+        if (!isItalic) {
+            return 0;
+        }
+
+        /* Shift is proportional to the height above the baseline, so descenders lean left */
+        const auto heightAboveBaseline = baseGlyph.ofs_y + baseGlyph.box_h - 1 - row;
+        return floorDivide(heightAboveBaseline * slantNumerator, slantDenominator);
+    }
+
+    auto SyntheticFont::getGeometry(const lv_font_glyph_dsc_t &baseGlyph) const -> Geometry
+    {
+        const auto bottomShift = getShift(baseGlyph, baseGlyph.box_h - 1);
+        const auto topShift = getShift(baseGlyph, 0);
+        return {std::min(bottomShift, topShift), std::max(bottomShift, topShift)};
+    }
+
+    auto SyntheticFont::getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *glyph, std::uint32_t letter, std::uint32_t letterNext) -> bool
+    {
+        const auto self = static_cast<const SyntheticFont *>(font->dsc);
+        const auto baseFont = self->baseFont;
+        if (!baseFont->get_glyph_dsc(baseFont, glyph, letter, letterNext)) {
+            return false;
+        }
+        if ((glyph->box_w == 0) || (glyph->box_h == 0)) {
+            return true;
+        }
+
+        const auto geometry = self->getGeometry(*glyph);
+        glyph->box_w += geometry.maxShift - geometry.minShift;
+        glyph->ofs_x += geometry.minShift;
+        if (self->isBold) {
+            glyph->box_w += 1;
+            glyph->adv_w += 1;
+        }
+        glyph->bpp = 8;
+        return true;
+    }
+
+    auto SyntheticFont::getGlyphBitmap(const lv_font_t *font, std::uint32_t letter) -> const std::uint8_t *
+    {
+        const auto self = static_cast<const SyntheticFont *>(font->dsc);
+        const auto baseFont = self->baseFont;
+
+        lv_font_glyph_dsc_t baseGlyph;
+        if (!baseFont->get_glyph_dsc(baseFont, &baseGlyph, letter, 0)) {
+            return nullptr;
+        }
+        const auto baseBitmap = baseFont->get_glyph_bitmap(baseFont, letter);
+        if (baseBitmap == nullptr) {
+            return nullptr;
+        }
+
+        const auto geometry = self->getGeometry(baseGlyph);
+        const auto width = baseGlyph.box_w + (geometry.maxShift - geometry.minShift) + (self->isBold ? 1 : 0);
+        self->bitmap.assign(width * baseGlyph.box_h, 0);
+
+        for (std::int32_t row = 0; row < baseGlyph.box_h; ++row) {
+            const auto shift = self->getShift(baseGlyph, row) - geometry.minShift;
+            auto outputRow = &self->bitmap[row * width];
+            for (std::int32_t column = 0; column < baseGlyph.box_w; ++column) {
+                const auto pixel = readPixel(baseBitmap, baseGlyph.bpp, row * baseGlyph.box_w + column);
+                if (pixel == 0) {
+                    continue;
+                }
+
+                const auto x = column + shift;
+                outputRow[x] = std::max(outputRow[x], pixel);
+                if (self->isBold) {
+                    outputRow[x + 1] = std::max(outputRow[x + 1], pixel);
+                }
+            }
+        }
+        return self->bitmap.data();
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <lvgl.h>
+#include <vector>
+#include <cstdint>
+
+namespace gui
+{
+    /* Face derived at runtime from a regular font - slanted for italic, widened by one pixel
+     * for bold. Only regular faces are stored in flash, so emphasis costs no font data.
+     * Glyph bitmap is generated to a buffer valid until the next bitmap is requested, which
+     * is enough for LVGL drawing letters one by one. */
+    class SyntheticFont
+    {
+        public:
+            SyntheticFont(const lv_font_t *baseFont, bool isBold, bool isItalic);
+
+            SyntheticFont(const SyntheticFont &) = delete;
+            auto operator=(const SyntheticFont &) -> SyntheticFont & = delete;
+
+            [[nodiscard]] auto get() const -> const lv_font_t *;
+
+        private:
+            /* Slant of about 11 degrees */
+            static constexpr auto slantNumerator = 1;
+            static constexpr auto slantDenominator = 5;
+
+            struct Geometry
+            {
+                std::int32_t minShift;
+                std::int32_t maxShift;
+            };
+
+            lv_font_t font;
+            const lv_font_t *baseFont;
+            bool isBold;
+            bool isItalic;
+            mutable std::vector<std::uint8_t> bitmap;
+
+            [[nodiscard]] auto getShift(const lv_font_glyph_dsc_t &baseGlyph, std::int32_t row) const -> std::int32_t;
+            [[nodiscard]] auto getGeometry(const lv_font_glyph_dsc_t &baseGlyph) const -> Geometry;
+
+            static auto getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *glyph, std::uint32_t letter, std::uint32_t letterNext) -> bool;
+            static auto getGlyphBitmap(const lv_font_t *font, std::uint32_t letter) -> const std::uint8_t *;
+    };
+}
@@ -0,0 +1,631 @@
+#include "TrueTypeFont.hpp"
+#include "GlyphRasterizer.hpp"
+#include "FontFileReader.hpp"
+#include <esp_log.h>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        constexpr auto offsetTableSize = 12;
+        constexpr auto tableRecordSize = 16;
+        constexpr auto glyphHeaderSize = 10;
+
+        /* Flags of simple glyph points */
+        constexpr std::uint8_t onCurvePoint = 0x01;
+        constexpr std::uint8_t xShortVector = 0x02;
+        constexpr std::uint8_t yShortVector = 0x04;
+        constexpr std::uint8_t repeatFlag = 0x08;
+        constexpr std::uint8_t xIsSameOrPositive = 0x10;
+        constexpr std::uint8_t yIsSameOrPositive = 0x20;
+
+        /* Flags of composite glyph components */
+        constexpr std::uint16_t argumentsAreWords = 0x0001;
+        constexpr std::uint16_t argumentsAreXyValues = 0x0002;
+        constexpr std::uint16_t haveScale = 0x0008;
+        constexpr std::uint16_t moreComponents = 0x0020;
+        constexpr std::uint16_t haveXyScale = 0x0040;
+        constexpr std::uint16_t haveTwoByTwo = 0x0080;
+
+        /* TrueType data is big endian, reads past the end give zero */
+        auto readU8(const std::vector<std::uint8_t> &data, std::size_t offset) -> std::uint8_t
+        {
+            return (offset < data.size()) ? data[offset] : 0;
+        }
+
+        auto readU16(const std::vector<std::uint8_t> &data, std::size_t offset) -> std::uint16_t
+        {
+            return static_cast<std::uint16_t>((readU8(data, offset) << 8) | readU8(data, offset + 1));
+        }
+
+        auto readI16(const std::vector<std::uint8_t> &data, std::size_t offset) -> std::int16_t
+        {
+            return static_cast<std::int16_t>(readU16(data, offset));
+        }
+
+        auto readU32(const std::vector<std::uint8_t> &data, std::size_t offset) -> std::uint32_t
+        {
+            return (static_cast<std::uint32_t>(readU16(data, offset)) << 16) | readU16(data, offset + 2);
+        }
+
+        auto readF2Dot14(const std::vector<std::uint8_t> &data, std::size_t offset) -> float
+        {
+            return static_cast<float>(readI16(data, offset)) / 16384.0f;
+        }
+    }
+
+    TrueTypeFont::TrueTypeFont(const std::filesystem::path &path, std::uint16_t pixelSize, const std::filesystem::path &atlasPath, GlyphCache &cache)
+        : font{}, cache{cache}, path{path}, scale{0.0f}, glyphsTable{0, 0}
+    {
+        std::uint32_t checksum;
+        try {
+            std::vector<std::uint8_t> directory(offsetTableSize);
+            if (!readTable({0, offsetTableSize}, directory) || ((readU32(directory, 0) != 0x00010000) && (readU32(directory, 0) != 0x74727565))) {
+                throw std::runtime_error{"Not a TrueType font"}; // CFF outlines of OpenType fonts are not supported
+            }
+            const auto tablesCount = readU16(directory, 4);
+            if (!readTable({0, offsetTableSize + tablesCount * static_cast<std::uint32_t>(tableRecordSize)}, directory)) {
+                throw std::runtime_error{"Truncated table directory"};
+            }
+
+            std::vector<std::uint8_t> data;
+            if (!readTable(findTable(directory, "head"), data)) {
+                throw std::runtime_error{"Missing font header"};
+            }
+            checksum = readU32(data, 8);
+            const auto unitsPerEm = readU16(data, 18);
+            const auto isLongOffsets = (readI16(data, 50) != 0);
+            if (unitsPerEm == 0) {
+                throw std::runtime_error{"Invalid font header"};
+            }
+            scale = static_cast<float>(pixelSize) / static_cast<float>(unitsPerEm);
+
+            if (!readTable(findTable(directory, "maxp"), data)) {
+                throw std::runtime_error{"Missing maximum profile"};
+            }
+            const auto glyphsCount = readU16(data, 4);
+
+            if (!readTable(findTable(directory, "hhea"), data)) {
+                throw std::runtime_error{"Missing horizontal header"};
+            }
+            const auto ascent = static_cast<std::int32_t>(std::ceil(readI16(data, 4) * scale));
+            const auto descent = static_cast<std::int32_t>(std::floor(readI16(data, 6) * scale));
+            const auto metricsCount = std::min(readU16(data, 34), glyphsCount);
+
+            /* Glyphs past the last metric have the same advance */
+            if (!readTable(findTable(directory, "hmtx"), data) || (metricsCount == 0)) {
+                throw std::runtime_error{"Missing horizontal metrics"};
+            }
+            advances.resize(glyphsCount);
+            for (std::uint32_t i = 0; i < glyphsCount; ++i) {
+                advances[i] = readU16(data, std::min<std::uint32_t>(i, metricsCount - 1) * 4);
+            }
+
+            if (!readTable(findTable(directory, "loca"), data)) {
+                throw std::runtime_error{"Missing glyph offsets"};
+            }
+            glyphOffsets.resize(glyphsCount + 1);
+            for (std::uint32_t i = 0; i <= glyphsCount; ++i) {
+                glyphOffsets[i] = isLongOffsets ? readU32(data, i * 4) : (readU16(data, i * 2) * 2U);
+            }
+            glyphs.assign(glyphsCount, Glyph{});
+
+            glyphsTable = findTable(directory, "glyf");
+            if (glyphsTable.length == 0) {
+                throw std::runtime_error{"Missing glyphs"};
+            }
+
+            if (!readTable(findTable(directory, "cmap"), data)) {
+                throw std::runtime_error{"Missing character map"};
+            }
+            loadCharacterMap(data);
+
+            /* Kerning of the old table only, the one in GPOS needs a shaper */
+            if (readTable(findTable(directory, "kern"), data)) {
+                loadKerning(data);
+            }
+
+            font.line_height = static_cast<lv_coord_t>(ascent - descent);
+            font.base_line = static_cast<lv_coord_t>(-descent);
+            if (readTable(findTable(directory, "post"), data)) {
+                font.underline_position = static_cast<std::int8_t>(std::lround(readI16(data, 8) * scale));
+                font.underline_thickness = static_cast<std::int8_t>(std::max(std::lround(readI16(data, 10) * scale), 1L));
+            }
+        }
+        catch (...) {
+            fontFileRelease(path);
+            throw;
+        }
+
+        font.get_glyph_dsc = getGlyphDsc;
+        font.get_glyph_bitmap = getGlyphBitmap;
+        font.subpx = LV_FONT_SUBPX_NONE;
+        font.dsc = this;
+        font.fallback = nullptr;
+
+        /* Whole font checksum tells fonts apart, even of the same name */
+        std::uint32_t fontId = 2166136261;
+        for (const auto value : {checksum, static_cast<std::uint32_t>(pixelSize), static_cast<std::uint32_t>(rasterizerVersion)}) {
+            fontId = (fontId ^ value) * 16777619;
+        }
+        atlas.emplace(atlasPath, fontId, static_cast<std::uint32_t>(glyphs.size()));
+
+        ESP_LOGI(TAG, "Loaded %s, %zu glyphs, %zu characters, %zu kerning pairs, size %u px",
+                 path.c_str(), glyphs.size(), characterMap.size(), kerningPairs.size(), pixelSize);
+    }
+
+    TrueTypeFont::~TrueTypeFont() noexcept
+    {
+        cache.removeFont(this);
+        atlas.reset();
+        fontFileRelease(path);
+    }
+
+    auto TrueTypeFont::get() const -> const lv_font_t *
+    {
+        return &font;
+    }
+
+    auto TrueTypeFont::getGlyphsCount() const -> std::size_t
+    {
+        return glyphs.size();
+    }
+
+    auto TrueTypeFont::getCodepointRanges() const -> std::vector<CodepointRange>
+    {
+        /* Character map is sorted, so consecutive codepoints join into one range */
+        std::vector<CodepointRange> result;
+        for (const auto &mapping : characterMap) {
+            if (mapping.glyphId == 0) {
+                continue;
+            }
+            if (!result.empty() && (result.back().last + 1 == mapping.codepoint)) {
+                result.back().last = mapping.codepoint;
+                continue;
+            }
+            result.push_back({mapping.codepoint, mapping.codepoint});
+        }
+        return result;
+    }
+
+    auto TrueTypeFont::findTable(const std::vector<std::uint8_t> &directory, const char *tag) const -> Table
+    {
+        const auto tablesCount = readU16(directory, 4);
+        for (std::uint32_t i = 0; i < tablesCount; ++i) {
+            const auto record = offsetTableSize + i * tableRecordSize;
+            if (std::equal(tag, tag + 4, &directory[record])) {
+                return {readU32(directory, record + 8), readU32(directory, record + 12)};
+            }
+        }
+        return {0, 0};
+    }
+
+    auto TrueTypeFont::readTable(const Table &table, std::vector<std::uint8_t> &data) const -> bool
+    {
+        if (table.length == 0) {
+            return false;
+        }
+        data.resize(table.length);
+        return fontFileRead(path, table.offset, data.data(), data.size());
+    }
+
+    auto TrueTypeFont::loadCharacterMap(const std::vector<std::uint8_t> &data) -> void
+    {
+        /* Full Unicode subtable is preferred over the one of the basic plane */
+        std::uint32_t subtable = 0;
+        std::uint16_t subtableFormat = 0;
+        const auto subtablesCount = readU16(data, 2);
+        for (std::uint32_t i = 0; i < subtablesCount; ++i) {
+            const auto platform = readU16(data, 4 + i * 8);
+            const auto encoding = readU16(data, 6 + i * 8);
+            const auto offset = readU32(data, 8 + i * 8);
+            const auto format = readU16(data, offset);
+            const auto isUnicode = (platform == 0) || ((platform == 3) && ((encoding == 1) || (encoding == 10)));
+            if (isUnicode && ((format == 12) || ((format == 4) && (subtableFormat != 12)))) {
+                subtable = offset;
+                subtableFormat = format;
+            }
+        }
+
+        if (subtableFormat == 12) {
+            const auto groupsCount = readU32(data, subtable + 12);
+            for (std::uint32_t i = 0; i < groupsCount; ++i) {
+                const auto group = subtable + 16 + i * 12;
+                const auto first = readU32(data, group);
+                const auto last = std::min(readU32(data, group + 4), first + 0xFFFF); // Sane bound for damaged fonts
+                const auto glyphId = readU32(data, group + 8);
+                for (auto codepoint = first; codepoint <= last; ++codepoint) {
+                    characterMap.push_back({codepoint, static_cast<std::uint16_t>(glyphId + codepoint - first)});
+                }
+            }
+        }
+        else if (subtableFormat == 4) {
+            /* Segments of codepoints mapped by a delta, or through the glyph array following the range offsets */
+            const auto segmentsCount = readU16(data, subtable + 6) / 2U;
+            const auto endCodes = subtable + 14;
+            const auto startCodes = endCodes + segmentsCount * 2 + 2;
+            const auto deltas = startCodes + segmentsCount * 2;
+            const auto rangeOffsets = deltas + segmentsCount * 2;
+            for (std::uint32_t i = 0; i < segmentsCount; ++i) {
+                const std::uint32_t first = readU16(data, startCodes + i * 2);
+                const std::uint32_t last = readU16(data, endCodes + i * 2);
+                const auto delta = readU16(data, deltas + i * 2);
+                const auto rangeOffset = readU16(data, rangeOffsets + i * 2);
+                for (auto codepoint = first; (codepoint <= last) && (codepoint != 0xFFFF); ++codepoint) {
+                    std::uint16_t glyphId = 0;
+                    if (rangeOffset == 0) {
+                        glyphId = static_cast<std::uint16_t>(codepoint + delta);
+                    }
+                    else {
+                        glyphId = readU16(data, rangeOffsets + i * 2 + rangeOffset + (codepoint - first) * 2);
+                        if (glyphId != 0) {
+                            glyphId = static_cast<std::uint16_t>(glyphId + delta);
+                        }
+                    }
+                    if (glyphId != 0) {
+                        characterMap.push_back({codepoint, glyphId});
+                    }
+                }
+            }
+        }
+        else {
+            throw std::runtime_error{"No Unicode character map"};
+        }
+
+        std::sort(characterMap.begin(), characterMap.end(), [](const auto &a, const auto &b) {
+            return a.codepoint < b.codepoint;
+        });
+    }
+
+    auto TrueTypeFont::loadKerning(const std::vector<std::uint8_t> &data) -> void
+    {
+        /* Horizontal pairs of the first subtable, other formats are rare */
+        if ((readU16(data, 0) != 0) || (readU16(data, 2) == 0)) {
+            return;
+        }
+        const auto coverage = readU16(data, 8);
+        const auto isHorizontalPairs = ((coverage >> 8) == 0) && ((coverage & 0x07) == 0x01);
+        if (!isHorizontalPairs) {
+            return;
+        }
+
+        const auto pairsCount = readU16(data, 10);
+        kerningPairs.reserve(pairsCount);
+        kerningValues.reserve(pairsCount);
+        for (std::uint32_t i = 0; i < pairsCount; ++i) {
+            const auto pair = 18 + i * 6;
+            kerningPairs.push_back(readU32(data, pair));
+            kerningValues.push_back(readI16(data, pair + 4));
+        }
+    }
+
+    auto TrueTypeFont::getGlyphId(std::uint32_t letter) const -> std::uint32_t
+    {
+        const auto it = std::lower_bound(characterMap.begin(), characterMap.end(), letter, [](const auto &mapping, std::uint32_t codepoint) {
+            return mapping.codepoint < codepoint;
+        });
+        return ((it != characterMap.end()) && (it->codepoint == letter)) ? it->glyphId : 0;
+    }
+
+    auto TrueTypeFont::getKerning(std::uint32_t leftId, std::uint32_t rightId) const -> std::int32_t
+    {
+        const auto pair = (leftId << 16) | rightId;
+        const auto it = std::lower_bound(kerningPairs.begin(), kerningPairs.end(), pair);
+        return ((it != kerningPairs.end()) && (*it == pair)) ? kerningValues[std::distance(kerningPairs.begin(), it)] : 0;
+    }
+
+    auto TrueTypeFont::getGlyph(std::uint32_t glyphId) const -> const Glyph *
+    {
+        std::lock_guard lock{mutex};
+
+        if ((glyphId == 0) || (glyphId >= glyphs.size())) {
+            return nullptr;
+        }
+        auto &glyph = glyphs[glyphId];
+        if (glyph.isLoaded) {
+            return &glyph;
+        }
+
+        /* Box is the bounding box of the outline from the glyph header, in whole pixels */
+        std::vector<std::uint8_t> data;
+        if (!readGlyphData(glyphId, data)) {
+            return nullptr;
+        }
+        if (data.size() >= glyphHeaderSize) {
+            const auto left = static_cast<std::int32_t>(std::floor(readI16(data, 2) * scale));
+            const auto bottom = static_cast<std::int32_t>(std::floor(readI16(data, 4) * scale));
+            const auto right = static_cast<std::int32_t>(std::ceil(readI16(data, 6) * scale));
+            const auto top = static_cast<std::int32_t>(std::ceil(readI16(data, 8) * scale));
+            if ((right > left) && (top > bottom) && (((right - left) * (top - bottom)) <= maxGlyphPixels)) {
+                glyph.width = static_cast<std::uint16_t>(right - left);
+                glyph.height = static_cast<std::uint16_t>(top - bottom);
+                glyph.offsetX = static_cast<std::int16_t>(left);
+                glyph.offsetY = static_cast<std::int16_t>(bottom);
+            }
+        }
+        glyph.isLoaded = true;
+        return &glyph;
+    }
+
+    auto TrueTypeFont::readGlyphData(std::uint32_t glyphId, std::vector<std::uint8_t> &data) const -> bool
+    {
+        /* Called with the mutex locked, empty glyphs like space have no data */
+        const auto start = glyphOffsets[glyphId];
+        const auto end = glyphOffsets[glyphId + 1];
+        if ((end < start) || (end > glyphsTable.length)) {
+            return false;
+        }
+        data.resize(end - start);
+        if (data.empty()) {
+            return true;
+        }
+        if (!fontFileRead(path, glyphsTable.offset + start, data.data(), data.size())) {
+            ESP_LOGE(TAG, "Failed to read glyph %lu", static_cast<unsigned long>(glyphId));
+            return false;
+        }
+        return true;
+    }
+
+    auto TrueTypeFont::loadOutline(std::uint32_t glyphId, const Transform &transform, std::uint8_t depth, Contours &contours) const -> bool
+    {
+        std::vector<std::uint8_t> data;
+        if ((glyphId >= glyphs.size()) || !readGlyphData(glyphId, data)) {
+            return false;
+        }
+        if (data.size() < glyphHeaderSize) {
+            return true;
+        }
+
+        const auto contoursCount = readI16(data, 0);
+        if (contoursCount < 0) {
+            /* Composite glyph made of other glyphs, each placed by its own transformation */
+            if (depth >= maxCompositeDepth) {
+                return false;
+            }
+            std::size_t offset = glyphHeaderSize;
+            std::uint16_t flags;
+            do {
+                flags = readU16(data, offset);
+                const auto componentId = readU16(data, offset + 2);
+                offset += 4;
+
+                Transform component{1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+                if ((flags & argumentsAreWords) != 0) {
+                    component.dx = readI16(data, offset);
+                    component.dy = readI16(data, offset + 2);
+                    offset += 4;
+                }
+                else {
+                    component.dx = static_cast<std::int8_t>(readU8(data, offset));
+                    component.dy = static_cast<std::int8_t>(readU8(data, offset + 1));
+                    offset += 2;
+                }
+                if ((flags & argumentsAreXyValues) == 0) {
+                    component.dx = component.dy = 0.0f; // Components aligned by matching points are placed as they are
+                }
+                if ((flags & haveScale) != 0) {
+                    component.xx = component.yy = readF2Dot14(data, offset);
+                    offset += 2;
+                }
+                else if ((flags & haveXyScale) != 0) {
+                    component.xx = readF2Dot14(data, offset);
+                    component.yy = readF2Dot14(data, offset + 2);
+                    offset += 4;
+                }
+                else if ((flags & haveTwoByTwo) != 0) {
+                    component.xx = readF2Dot14(data, offset);
+                    component.xy = readF2Dot14(data, offset + 2);
+                    component.yx = readF2Dot14(data, offset + 4);
+                    component.yy = readF2Dot14(data, offset + 6);
+                    offset += 8;
+                }
+
+                if (!loadOutline(componentId, combine(transform, component), static_cast<std::uint8_t>(depth + 1), contours)) {
+                    return false;
+                }
+            } while (((flags & moreComponents) != 0) && (offset < data.size()));
+            return true;
+        }
+
+        /* Simple glyph - ends of contours, instructions, flags of points, then their x and y deltas */
+        std::vector<std::uint16_t> contourEnds(contoursCount);
+        for (std::int32_t i = 0; i < contoursCount; ++i) {
+            contourEnds[i] = readU16(data, glyphHeaderSize + i * 2);
+        }
+        const std::size_t pointsCount = contourEnds.empty() ? 0 : (contourEnds.back() + 1);
+        const auto instructionsLength = readU16(data, glyphHeaderSize + contoursCount * 2);
+        auto offset = glyphHeaderSize + contoursCount * 2 + 2 + static_cast<std::size_t>(instructionsLength);
+
+        std::vector<std::uint8_t> flags;
+        flags.reserve(pointsCount);
+        while ((flags.size() < pointsCount) && (offset < data.size())) {
+            const auto flag = readU8(data, offset++);
+            auto repeats = ((flag & repeatFlag) != 0) ? readU8(data, offset++) : 0;
+            flags.push_back(flag);
+            while ((repeats-- > 0) && (flags.size() < pointsCount)) {
+                flags.push_back(flag);
+            }
+        }
+        if (flags.size() < pointsCount) {
+            return false;
+        }
+
+        std::vector<OutlinePoint> points(pointsCount);
+        const auto readCoordinates = [&](std::uint8_t shortFlag, std::uint8_t sameFlag, float OutlinePoint::*coordinate) {
+            std::int32_t value = 0;
+            for (std::size_t i = 0; i < pointsCount; ++i) {
+                if ((flags[i] & shortFlag) != 0) {
+                    const auto delta = readU8(data, offset++);
+                    value += ((flags[i] & sameFlag) != 0) ? delta : -delta;
+                }
+                else if ((flags[i] & sameFlag) == 0) {
+                    value += readI16(data, offset);
+                    offset += 2;
+                }
+                points[i].*coordinate = static_cast<float>(value);
+            }
+        };
+        readCoordinates(xShortVector, xIsSameOrPositive, &OutlinePoint::x);
+        readCoordinates(yShortVector, yIsSameOrPositive, &OutlinePoint::y);
+
+        std::size_t start = 0;
+        for (const auto end : contourEnds) {
+            if ((end < start) || (end >= pointsCount)) {
+                return false;
+            }
+            auto &contour = contours.emplace_back();
+            for (auto i = start; i <= end; ++i) {
+                const auto &point = points[i];
+                contour.push_back({
+                    transform.xx * point.x + transform.yx * point.y + transform.dx,
+                    transform.xy * point.x + transform.yy * point.y + transform.dy,
+                    (flags[i] & onCurvePoint) != 0
+                });
+            }
+            start = end + 1;
+        }
+        return true;
+    }
+
+    auto TrueTypeFont::combine(const Transform &parent, const Transform &child) -> Transform
+    {
+        return {
+            parent.xx * child.xx + parent.yx * child.xy,
+            parent.xy * child.xx + parent.yy * child.xy,
+            parent.xx * child.yx + parent.yx * child.yy,
+            parent.xy * child.yx + parent.yy * child.yy,
+            parent.xx * child.dx + parent.yx * child.dy + parent.dx,
+            parent.xy * child.dx + parent.yy * child.dy + parent.dy
+        };
+    }
+
+    auto TrueTypeFont::rasterize(std::uint32_t glyphId, const Glyph &glyph, std::vector<std::uint8_t> &bitmap) const -> bool
+    {
+        Contours contours;
+        if (!loadOutline(glyphId, {1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f}, 0, contours)) {
+            return false;
+        }
+
+        /* Font units to pixels of the glyph box, y grows down in the bitmap */
+        const auto top = static_cast<float>(glyph.offsetY + glyph.height);
+        const auto toPixels = [this, &glyph, top](const OutlinePoint &point) {
+            return GlyphRasterizer::Point{point.x * scale - static_cast<float>(glyph.offsetX), top - point.y * scale};
+        };
+        const auto middle = [](const GlyphRasterizer::Point &a, const GlyphRasterizer::Point &b) {
+            return GlyphRasterizer::Point{(a.x + b.x) / 2.0f, (a.y + b.y) / 2.0f};
+        };
+
+        GlyphRasterizer rasterizer{glyph.width, glyph.height};
+        for (const auto &contour : contours) {
+            if (contour.size() < 2) {
+                continue;
+            }
+
+            /* Contour starts at a point on the curve, between two control points there is an implied one */
+            const auto firstOnCurve = std::find_if(contour.begin(), contour.end(), [](const auto &point) {
+                return point.isOnCurve;
+            });
+            const auto hasOnCurve = (firstOnCurve != contour.end());
+            const auto startIndex = hasOnCurve ? static_cast<std::size_t>(std::distance(contour.begin(), firstOnCurve)) : (contour.size() - 1);
+            const auto start = hasOnCurve ? toPixels(*firstOnCurve) : middle(toPixels(contour.back()), toPixels(contour.front()));
+
+            auto previous = start;
+            std::optional<GlyphRasterizer::Point> control;
+            for (std::size_t i = 1; i <= contour.size(); ++i) {
+                const auto &point = contour[(startIndex + i) % contour.size()];
+                const auto isStart = hasOnCurve && (i == contour.size());
+                const auto current = isStart ? start : toPixels(point);
+                if (point.isOnCurve || isStart) {
+                    if (control.has_value()) {
+                        rasterizer.addQuadratic(previous, *control, current);
+                    }
+                    else {
+                        rasterizer.addLine(previous, current);
+                    }
+                    previous = current;
+                    control.reset();
+                }
+                else {
+                    if (control.has_value()) {
+                        const auto implied = middle(*control, current);
+                        rasterizer.addQuadratic(previous, *control, implied);
+                        previous = implied;
+                    }
+                    control = current;
+                }
+            }
+            if (control.has_value()) {
+                rasterizer.addQuadratic(previous, *control, start); // Contour of control points only
+            }
+        }
+
+        rasterizer.render(bitmap);
+        return true;
+    }
+
+    auto TrueTypeFont::loadBitmap(std::uint32_t glyphId, const Glyph &glyph, std::vector<std::uint8_t> &bitmap) const -> bool
+    {
+        std::lock_guard lock{mutex};
+
+        const auto size = (static_cast<std::size_t>(glyph.width) * glyph.height + 1) / 2;
+        if (atlas->read(glyphId, size, bitmap)) {
+            return true;
+        }
+        if (!rasterize(glyphId, glyph, bitmap)) {
+            ESP_LOGE(TAG, "Failed to rasterise glyph %lu", static_cast<unsigned long>(glyphId));
+            return false;
+        }
+        atlas->write(glyphId, bitmap);
+        return true;
+    }
+
+    auto TrueTypeFont::getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *glyph, std::uint32_t letter, std::uint32_t letterNext) -> bool
+    {
+        const auto self = static_cast<const TrueTypeFont *>(font->dsc);
+
+        /* Tab is a double space, as in LVGL's fonts */
+        const auto isTab = (letter == '\t');
+        const auto glyphId = self->getGlyphId(isTab ? ' ' : letter);
+        const auto fontGlyph = self->getGlyph(glyphId);
+        if (fontGlyph == nullptr) {
+            return false;
+        }
+
+        /* Advance is rounded with kerning included, positions are not hinted */
+        std::int32_t advance = self->advances[glyphId] * (isTab ? 2 : 1);
+        if (letterNext != 0) {
+            const auto nextGlyphId = self->getGlyphId(letterNext);
+            if (nextGlyphId != 0) {
+                advance += self->getKerning(glyphId, nextGlyphId);
+            }
+        }
+
+        glyph->adv_w = static_cast<std::uint16_t>(std::max<std::int32_t>(std::lround(advance * self->scale), 0));
+        glyph->box_w = isTab ? 0 : fontGlyph->width;
+        glyph->box_h = isTab ? 0 : fontGlyph->height;
+        glyph->ofs_x = fontGlyph->offsetX;
+        glyph->ofs_y = fontGlyph->offsetY;
+        glyph->bpp = 4;
+        glyph->is_placeholder = false;
+        return true;
+    }
+
+    auto TrueTypeFont::getGlyphBitmap(const lv_font_t *font, std::uint32_t letter) -> const std::uint8_t *
+    {
+        const auto self = static_cast<const TrueTypeFont *>(font->dsc);
+        const auto glyphId = self->getGlyphId((letter == '\t') ? ' ' : letter);
+        const auto fontGlyph = self->getGlyph(glyphId);
+        if ((fontGlyph == nullptr) || (fontGlyph->width == 0) || (fontGlyph->height == 0)) {
+            return nullptr;
+        }
+
+        return self->cache.get(self, glyphId, [self, glyphId, fontGlyph](std::vector<std::uint8_t> &bitmap) {
+            return self->loadBitmap(glyphId, *fontGlyph, bitmap);
+        });
+    }
+}
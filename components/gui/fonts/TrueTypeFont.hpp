@@ -0,0 +1,111 @@
+#pragma once
+
+#include "GlyphCache.hpp"
+#include "GlyphAtlas.hpp"
+#include "CodepointRange.hpp"
+#include <lvgl.h>
+#include <filesystem>
+#include <vector>
+#include <mutex>
+#include <optional>
+#include <cstdint>
+
+namespace gui
+{
+    /* TrueType font rendered at the given pixel size on the device. Tables needed to map and measure
+     * characters are loaded when the font is opened, outlines are read and rasterised only when a glyph
+     * is first drawn. Rasterised glyphs go to the glyph cache and to the atlas file, so each of them
+     * is rasterised once per size. Neither file is kept open, see fontFileRead. Throws std::runtime_error
+     * if the file is not a TrueType font. Safe to use from the UI and indexer tasks. */
+    class TrueTypeFont
+    {
+        public:
+            TrueTypeFont(const std::filesystem::path &path, std::uint16_t pixelSize, const std::filesystem::path &atlasPath, GlyphCache &cache);
+            ~TrueTypeFont() noexcept;
+
+            TrueTypeFont(const TrueTypeFont &) = delete;
+            auto operator=(const TrueTypeFont &) -> TrueTypeFont & = delete;
+
+            [[nodiscard]] auto get() const -> const lv_font_t *;
+            [[nodiscard]] auto getGlyphsCount() const -> std::size_t;
+            [[nodiscard]] auto getCodepointRanges() const -> std::vector<CodepointRange>;
+
+        private:
+            static constexpr auto rasterizerVersion = 1; // Bump when rasterised glyphs change, rebuilds atlases
+            static constexpr auto maxCompositeDepth = 4;
+            static constexpr auto maxGlyphPixels = 256 * 256;
+
+            struct Table
+            {
+                std::uint32_t offset;
+                std::uint32_t length;
+            };
+
+            struct CharacterMapping
+            {
+                std::uint32_t codepoint;
+                std::uint16_t glyphId;
+            };
+
+            /* Box and offsets in pixels as LVGL wants them, advance in font units */
+            struct Glyph
+            {
+                std::uint16_t width;
+                std::uint16_t height;
+                std::int16_t offsetX;
+                std::int16_t offsetY;
+                bool isLoaded;
+            };
+
+            struct OutlinePoint
+            {
+                float x;
+                float y;
+                bool isOnCurve;
+            };
+
+            /* Affine transformation of composite glyph components, in font units */
+            struct Transform
+            {
+                float xx;
+                float xy;
+                float yx;
+                float yy;
+                float dx;
+                float dy;
+            };
+
+            using Contours = std::vector<std::vector<OutlinePoint>>;
+
+            lv_font_t font;
+            GlyphCache &cache;
+            std::filesystem::path path;
+            mutable std::mutex mutex; // Guards the atlas and loading of glyph metrics
+            float scale; // Pixels per font unit
+            Table glyphsTable;
+            std::vector<std::uint32_t> glyphOffsets; // One more than glyphs, the last is the end of the table
+            std::vector<std::uint16_t> advances;
+            mutable std::vector<Glyph> glyphs;
+            std::vector<CharacterMapping> characterMap; // Sorted by codepoint
+            std::vector<std::uint32_t> kerningPairs; // Sorted, left << 16 | right
+            std::vector<std::int16_t> kerningValues;
+            mutable std::optional<GlyphAtlas> atlas; // Opened once the font is known to be valid
+
+            auto findTable(const std::vector<std::uint8_t> &directory, const char *tag) const -> Table;
+            auto readTable(const Table &table, std::vector<std::uint8_t> &data) const -> bool;
+            auto loadCharacterMap(const std::vector<std::uint8_t> &data) -> void;
+            auto loadKerning(const std::vector<std::uint8_t> &data) -> void;
+
+            [[nodiscard]] auto getGlyphId(std::uint32_t letter) const -> std::uint32_t;
+            [[nodiscard]] auto getKerning(std::uint32_t leftId, std::uint32_t rightId) const -> std::int32_t;
+            [[nodiscard]] auto getGlyph(std::uint32_t glyphId) const -> const Glyph *;
+            auto readGlyphData(std::uint32_t glyphId, std::vector<std::uint8_t> &data) const -> bool;
+            auto loadOutline(std::uint32_t glyphId, const Transform &transform, std::uint8_t depth, Contours &contours) const -> bool;
+            auto rasterize(std::uint32_t glyphId, const Glyph &glyph, std::vector<std::uint8_t> &bitmap) const -> bool;
+            auto loadBitmap(std::uint32_t glyphId, const Glyph &glyph, std::vector<std::uint8_t> &bitmap) const -> bool;
+
+            static auto combine(const Transform &parent, const Transform &child) -> Transform;
+            static auto getGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *glyph, std::uint32_t letter, std::uint32_t letterNext) -> bool;
+            static auto getGlyphBitmap(const lv_font_t *font, std::uint32_t letter) -> const std::uint8_t *;
+    };
+}
@@ -0,0 +1,369 @@
+#!/usr/bin/env python3
+"""Build-time pipeline of the compiled-in fonts.
+
+Reads a font generated by lv_font_conv as a C array, keeps only the requested
+characters, compresses the glyph bitmaps with LVGL's RLE and writes the font
+back as C source. Bitmaps are fetched through gui_font_get_cached_bitmap, so
+each glyph is decompressed once and then served from the glyph cache.
+
+    font_pipeline.py convert --input in.c --output out.c --characters ascii
+    font_pipeline.py report --font in.c:ascii [--font ...]
+
+Characters are "all", "ascii" or a comma separated list of codepoints and
+ranges, e.g. "0x20-0x7E,0xF060".
+"""
+
+import argparse
+import re
+import sys
+
+GLYPH_DSC_SIZE = 8  # lv_font_fmt_txt_glyph_dsc_t
+CMAP_SIZE = 20  # lv_font_fmt_txt_cmap_t
+
+# RLE parameters fixed by LVGL's decoder
+RLE_SINGLE_REPEATS = 10  # Repeats encoded by a 1 bit each
+RLE_MAX_COUNTER = 63  # Further repeats in a 6-bit counter
+
+# Contiguous runs shorter than this go to a sparse range
+MIN_FULL_RANGE = 8
+
+
+class Font:
+    def __init__(self, path):
+        source = open(path, encoding='utf-8').read()
+        self.name = re.search(r'^const lv_font_t (\w+) = \{', source, re.M).group(1)
+        self.size = int(re.search(r'\* Size: (\d+) px', source).group(1))
+        self.bpp = int(re.search(r'\.bpp = (\d+)', source).group(1))
+        self.line_height = int(re.search(r'\.line_height = (-?\d+)', source).group(1))
+        self.base_line = int(re.search(r'\.base_line = (-?\d+)', source).group(1))
+        self.underline_position = int(re.search(r'\.underline_position = (-?\d+)', source).group(1))
+        self.underline_thickness = int(re.search(r'\.underline_thickness = (-?\d+)', source).group(1))
+        if re.search(r'\.kern_dsc = NULL', source) is None:
+            raise ValueError(f'{path}: kerning is not supported')
+        if int(re.search(r'\.bitmap_format = (\d+)', source).group(1)) != 0:
+            raise ValueError(f'{path}: font is compressed already')
+
+        bitmap_source = source[source.index('glyph_bitmap[] = {'):]
+        bitmap_source = bitmap_source[:bitmap_source.index('};')]
+        self.bitmap = bytes(int(value, 16) for value in re.findall(r'0x[0-9a-fA-F]+', bitmap_source))
+        self.glyphs = [tuple(int(value) for value in match) for match in re.findall(
+            r'\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), '
+            r'\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}', source)]
+
+        lists = {}
+        for match in re.finditer(r'static const uint16_t (\w+)\[\] = \{([^}]*)\}', source):
+            lists[match.group(1)] = [int(value, 16) for value in re.findall(r'0x[0-9a-fA-F]+', match.group(2))]
+
+        # Codepoint of each glyph, glyphs are sorted by codepoint in lv_font_conv output
+        self.codepoints = {}
+        for match in re.finditer(r'\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*'
+                                 r'\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), '
+                                 r'\.type = (\w+)', source):
+            start, length, glyph_id = int(match.group(1)), int(match.group(2)), int(match.group(3))
+            cmap_type = match.group(7)
+            if cmap_type == 'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY':
+                for offset in range(length):
+                    self.codepoints[glyph_id + offset] = start + offset
+            elif cmap_type == 'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY':
+                for index, offset in enumerate(lists[match.group(4)]):
+                    self.codepoints[glyph_id + index] = start + offset
+            else:
+                raise ValueError(f'{path}: unsupported character map {cmap_type}')
+
+    def pixels(self, glyph_id):
+        index, _, width, height, _, _ = self.glyphs[glyph_id]
+        values = []
+        for pixel in range(width * height):
+            bit = index * 8 + pixel * self.bpp
+            shift = 8 - self.bpp - bit % 8
+            values.append((self.bitmap[bit // 8] >> shift) & ((1 << self.bpp) - 1))
+        return values
+
+    def bitmap_size(self, glyph_id):
+        _, _, width, height, _, _ = self.glyphs[glyph_id]
+        return (width * height * self.bpp + 7) // 8
+
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def write(self, value, count):
+        self.bits.extend((value >> shift) & 1 for shift in range(count - 1, -1, -1))
+
+    def to_bytes(self):
+        bits = self.bits + [0] * (-len(self.bits) % 8)
+        return bytes(sum(bit << (7 - i) for i, bit in enumerate(bits[start:start + 8])) for start in range(0, len(bits), 8))
+
+
+def compress(pixels, width, bpp, prefilter):
+    """Encodes pixels the way lv_font_fmt_txt.c decodes them"""
+    if prefilter:
+        rows = [pixels[start:start + width] for start in range(0, len(pixels), width)]
+        pixels = rows[0] + [value for previous, row in zip(rows, rows[1:]) for value in
+                            (a ^ b for a, b in zip(row, previous))] if rows else []
+
+    writer = BitWriter()
+    position = 0
+    while position < len(pixels):
+        value = pixels[position]
+        run = 1
+        while (position + run < len(pixels)) and (pixels[position + run] == value):
+            run += 1
+        if run == 1:
+            writer.write(value, bpp)
+            position += 1
+            continue
+
+        # Second equal value switches the decoder to repeats, the value after them is read as a new one
+        writer.write(value, bpp)
+        writer.write(value, bpp)
+        repeats = min(run - 2, RLE_SINGLE_REPEATS + RLE_MAX_COUNTER)
+        position += 2 + repeats
+        if repeats <= RLE_SINGLE_REPEATS:
+            writer.write((1 << repeats) - 1, repeats)
+            writer.write(0, 1)
+        else:
+            writer.write((1 << (RLE_SINGLE_REPEATS + 1)) - 1, RLE_SINGLE_REPEATS + 1)
+            writer.write(repeats - RLE_SINGLE_REPEATS, 6)
+    return writer.to_bytes()
+
+
+def decompress(data, count, width, bpp, prefilter):
+    """Mirror of LVGL's decoder, to check every glyph before it is written"""
+    bits = ''.join(f'{byte:08b}' for byte in data) + '0' * 64
+    position = 0
+
+    def read(count):
+        nonlocal position
+        value = int(bits[position:position + count], 2) if count else 0
+        position += count
+        return value
+
+    values, state, previous, counter, first = [], 'single', 0, 0, True
+    for _ in range(count):
+        if state == 'single':
+            value = read(bpp)
+            if not first and value == previous:
+                counter, state = 0, 'repeat'
+            first, previous = False, value
+        elif state == 'repeat':
+            counter += 1
+            if read(1) == 0:
+                value = previous = read(bpp)
+                state = 'single'
+            elif counter == RLE_SINGLE_REPEATS + 1:
+                counter = read(6)
+                if counter == 0:
+                    value = previous = read(bpp)
+                    state = 'single'
+                else:
+                    value, state = previous, 'counter'
+            else:
+                value = previous
+        else:
+            counter -= 1
+            if counter == 0:
+                value = previous = read(bpp)
+                state = 'single'
+            else:
+                value = previous
+        values.append(value)
+
+    if prefilter:
+        for index in range(width, len(values)):
+            values[index] ^= values[index - width]
+    return values
+
+
+def parse_characters(spec):
+    if spec == 'all':
+        return None
+    if spec == 'ascii':
+        return set(range(0x20, 0x7F))
+    characters = set()
+    for part in spec.split(','):
+        first, _, last = part.partition('-')
+        characters.update(range(int(first, 0), int(last or first, 0) + 1))
+    return characters
+
+
+def subset(font, characters):
+    """Returns glyph ids of the kept characters, in codepoint order"""
+    return [glyph_id for glyph_id, codepoint in sorted(font.codepoints.items(), key=lambda item: item[1])
+            if characters is None or codepoint in characters]
+
+
+def encode(font, glyph_ids):
+    """Compresses glyphs with rows XORed with the previous ones, LVGL 8 can't be told they are not"""
+    bitmap = bytearray()
+    descriptors = []
+    for glyph_id in glyph_ids:
+        _, advance, width, height, offset_x, offset_y = font.glyphs[glyph_id]
+        descriptors.append((len(bitmap), advance, width, height, offset_x, offset_y))
+        if width * height == 0:
+            continue
+        pixels = font.pixels(glyph_id)
+        data = compress(pixels, width, font.bpp, True)
+        if decompress(data, len(pixels), width, font.bpp, True) != pixels:
+            raise RuntimeError(f'{font.name}: glyph U+{font.codepoints[glyph_id]:04X} does not survive compression')
+        bitmap += data
+    return bytes(bitmap), descriptors
+
+
+def build_character_map(codepoints):
+    """Contiguous runs become full ranges, the rest sparse ones, glyph ids follow the codepoints"""
+    runs = []
+    for codepoint in codepoints:
+        if runs and codepoint == runs[-1][-1] + 1:
+            runs[-1].append(codepoint)
+        else:
+            runs.append([codepoint])
+
+    ranges = []
+    glyph_id = 1
+    for run in runs:
+        is_full = len(run) >= MIN_FULL_RANGE
+        last = ranges[-1] if ranges else None
+        if not is_full and last is not None and last['sparse'] and (run[-1] - last['start']) <= 0xFFFF:
+            last['codepoints'] += run
+        else:
+            ranges.append({'start': run[0], 'sparse': not is_full, 'codepoints': list(run), 'glyph_id': glyph_id})
+        glyph_id += len(run)
+    return ranges
+
+
+def convert(font, characters, output, source_name):
+    glyph_ids = subset(font, characters)
+    if not glyph_ids:
+        raise ValueError(f'{font.name}: no characters left')
+
+    bitmap, descriptors = encode(font, glyph_ids)
+    ranges = build_character_map([font.codepoints[glyph_id] for glyph_id in glyph_ids])
+
+    lines = [
+        '/*******************************************************************************',
+        f' * Size: {font.size} px',
+        f' * Bpp: {font.bpp}',
+        f' * Generated by font_pipeline.py from {source_name}, do not edit',
+        f' * Glyphs: {len(glyph_ids)} of {len(font.codepoints)}, RLE compressed with prefilter',
+        ' ******************************************************************************/',
+        '',
+        '#include "Fonts.h"',
+        '',
+        '/*Store the image of the glyphs*/',
+        'static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {',
+    ]
+    for start in range(0, len(bitmap), 16):
+        lines.append('    ' + ', '.join(f'0x{byte:x}' for byte in bitmap[start:start + 16]) + ',')
+    lines += ['};', '', 'static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {',
+              '    {.bitmap_index = 0, .adv_w = 0, .box_h = 0, .box_w = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,']
+    for glyph_id, (index, advance, width, height, offset_x, offset_y) in zip(glyph_ids, descriptors):
+        lines.append(f'    {{.bitmap_index = {index}, .adv_w = {advance}, .box_w = {width}, .box_h = {height}, '
+                     f'.ofs_x = {offset_x}, .ofs_y = {offset_y}}}, /* U+{font.codepoints[glyph_id]:04X} */')
+    # LVGL looks up one codepoint past the end of a full range, it must not read past the descriptors
+    lines += ['    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* past the last range */',
+              '};', '']
+
+    for number, character_range in enumerate(ranges):
+        if character_range['sparse']:
+            offsets = [codepoint - character_range['start'] for codepoint in character_range['codepoints']]
+            lines.append(f'static const uint16_t unicode_list_{number}[] = {{')
+            for start in range(0, len(offsets), 8):
+                lines.append('    ' + ', '.join(f'0x{offset:x}' for offset in offsets[start:start + 8]) + ',')
+            lines += ['};', '']
+
+    lines.append('static const lv_font_fmt_txt_cmap_t cmaps[] = {')
+    for number, character_range in enumerate(ranges):
+        codepoints = character_range['codepoints']
+        if character_range['sparse']:
+            length = codepoints[-1] - character_range['start'] + 1
+            lines.append(f'    {{.range_start = {character_range["start"]}, .range_length = {length}, '
+                         f'.glyph_id_start = {character_range["glyph_id"]}, .unicode_list = unicode_list_{number}, '
+                         f'.glyph_id_ofs_list = NULL, .list_length = {len(codepoints)}, '
+                         f'.type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY}},')
+        else:
+            lines.append(f'    {{.range_start = {character_range["start"]}, .range_length = {len(codepoints)}, '
+                         f'.glyph_id_start = {character_range["glyph_id"]}, .unicode_list = NULL, '
+                         f'.glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY}},')
+    lines += [
+        '};',
+        '',
+        'static const lv_font_fmt_txt_dsc_t font_dsc = {',
+        '    .glyph_bitmap = glyph_bitmap,',
+        '    .glyph_dsc = glyph_dsc,',
+        '    .cmaps = cmaps,',
+        '    .kern_dsc = NULL,',
+        '    .kern_scale = 0,',
+        f'    .cmap_num = {len(ranges)},',
+        f'    .bpp = {font.bpp},',
+        '    .kern_classes = 0,',
+        '    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,',
+        '    .cache = NULL',  # Its letter and glyph id are written without a lock, UI and indexer tasks share the fonts
+        '};',
+        '',
+        f'const lv_font_t {font.name} = {{',
+        '    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,',
+        '    .get_glyph_bitmap = gui_font_get_cached_bitmap,',
+        f'    .line_height = {font.line_height},',
+        f'    .base_line = {font.base_line},',
+        '    .subpx = LV_FONT_SUBPX_NONE,',
+        f'    .underline_position = {font.underline_position},',
+        f'    .underline_thickness = {font.underline_thickness},',
+        '    .dsc = &font_dsc,',
+        '    .fallback = NULL,',
+        '    .user_data = NULL',
+        '};',
+        '',
+    ]
+    if output is not None:
+        with open(output, 'w', encoding='utf-8') as file:
+            file.write('\n'.join(lines))
+    return glyph_ids, bitmap, ranges
+
+
+def get_flash_size(glyphs_count, bitmap_size, ranges):
+    lists_size = sum(2 * len(character_range['codepoints']) for character_range in ranges if character_range['sparse'])
+    return bitmap_size + (glyphs_count + 1) * GLYPH_DSC_SIZE + len(ranges) * CMAP_SIZE + lists_size
+
+
+def report(fonts):
+    print(f'{"font":<28}{"glyphs":>14}{"before":>10}{"after":>10}{"saved":>8}  max glyph / average')
+    total_before = total_after = 0
+    for path, characters in fonts:
+        font = Font(path)
+        glyph_ids, bitmap, ranges = convert(font, parse_characters(characters), None, path)
+        full_ranges = build_character_map(sorted(font.codepoints.values()))
+        before = get_flash_size(len(font.glyphs) - 1, len(font.bitmap), full_ranges)
+        after = get_flash_size(len(glyph_ids), len(bitmap), ranges)
+        total_before += before
+        total_after += after
+
+        # Decoding cost is proportional to pixels, each one is a few bit reads on the device
+        pixels = [font.glyphs[glyph_id][2] * font.glyphs[glyph_id][3] for glyph_id in glyph_ids]
+        print(f'{font.name:<28}{len(glyph_ids):>6} of {len(font.glyphs) - 1:<6}{before:>10}{after:>10}'
+              f'{100 - 100 * after // before:>7}%  {max(pixels)} / {sum(pixels) // len(pixels)} px')
+    print(f'{"total":<28}{"":>14}{total_before:>10}{total_after:>10}{100 - 100 * total_after // total_before:>7}%')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command', required=True)
+    convert_parser = commands.add_parser('convert', help='subset and compress a font')
+    convert_parser.add_argument('--input', required=True)
+    convert_parser.add_argument('--output', required=True)
+    convert_parser.add_argument('--characters', default='all')
+    report_parser = commands.add_parser('report', help='print flash taken by fonts before and after')
+    report_parser.add_argument('--font', action='append', required=True, help='path:characters')
+    arguments = parser.parse_args()
+
+    if arguments.command == 'convert':
+        font = Font(arguments.input)
+        convert(font, parse_characters(arguments.characters), arguments.output, arguments.input.rsplit('/', 1)[-1])
+    else:
+        report([font.rsplit(':', 1) for font in arguments.font])
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
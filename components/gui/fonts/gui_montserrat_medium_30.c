@@ -1,6254 +0,0 @@
-/*******************************************************************************
- * Size: 30 px
- * Bpp: 4
- * Opts: 
- ******************************************************************************/
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-#include "lvgl.h"
-#else
-#include "lvgl/lvgl.h"
-#endif
-
-#ifndef GUI_MONTSERRAT_MEDIUM_30
-#define GUI_MONTSERRAT_MEDIUM_30 1
-#endif
-
-#if GUI_MONTSERRAT_MEDIUM_30
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xaf, 0xfb, 0x9f, 0xfa, 0x9f, 0xfa, 0x8f, 0xf9,
-    0x7f, 0xf8, 0x7f, 0xf8, 0x6f, 0xf7, 0x6f, 0xf6,
-    0x5f, 0xf6, 0x4f, 0xf5, 0x4f, 0xf5, 0x3f, 0xf4,
-    0x3f, 0xf3, 0x2f, 0xf3, 0x5, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x3b, 0xc3, 0xdf, 0xfd, 0xdf, 0xfe,
-    0x4e, 0xe5,
-
-    /* U+0022 "\"" */
-    0x1f, 0xf6, 0x0, 0xaf, 0xd1, 0xff, 0x50, 0xa,
-    0xfc, 0xf, 0xf5, 0x0, 0xaf, 0xc0, 0xff, 0x50,
-    0x9, 0xfc, 0xf, 0xf4, 0x0, 0x9f, 0xb0, 0xff,
-    0x40, 0x8, 0xfb, 0xf, 0xf3, 0x0, 0x8f, 0xa0,
-    0xff, 0x30, 0x8, 0xfa, 0x1, 0x10, 0x0, 0x1,
-    0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0xc, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x2, 0x22, 0x3f, 0xf4, 0x22, 0x22,
-    0x6f, 0xe2, 0x22, 0x20, 0x0, 0x0, 0x2, 0xff,
-    0x0, 0x0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x8f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x22, 0x22, 0xcf, 0x72, 0x22, 0x22, 0xff,
-    0x42, 0x22, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x2f, 0xf0, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0,
-    0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xf9, 0x0, 0x0, 0xb, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xeb,
-    0x72, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x20, 0x2, 0xef, 0xff, 0xcd, 0xfc,
-    0xae, 0xff, 0xf4, 0x0, 0xbf, 0xfc, 0x20, 0x7f,
-    0x70, 0x3, 0x9d, 0x0, 0x1f, 0xff, 0x10, 0x7,
-    0xf7, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0,
-    0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf6,
-    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfc, 0x69, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xb5, 0x10, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0xcf, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x7d, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x6, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0xb,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0,
-    0x9f, 0xf6, 0x9, 0x20, 0x0, 0x7, 0xf7, 0x0,
-    0xd, 0xff, 0x35, 0xff, 0x92, 0x0, 0x7f, 0x70,
-    0x1a, 0xff, 0xd0, 0x7f, 0xff, 0xfe, 0xac, 0xfc,
-    0xcf, 0xff, 0xf3, 0x0, 0x4c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd3, 0x0, 0x0, 0x3, 0x8b, 0xef,
-    0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x83, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x5c, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfa, 0x0, 0x0, 0x7, 0xfe, 0x99, 0xef,
-    0x70, 0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0,
-    0x3f, 0xd1, 0x0, 0x1d, 0xf3, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x6f,
-    0xd0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x1,
-    0xfd, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0xdf, 0x20, 0x0, 0x2, 0xfc, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x7,
-    0xf9, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x2e, 0xf3, 0x2, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xcc, 0xff,
-    0x70, 0xd, 0xf7, 0x0, 0x5a, 0xb8, 0x20, 0x0,
-    0x0, 0x5c, 0xff, 0xc5, 0x0, 0x8f, 0xc0, 0xc,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x20, 0xaf, 0xb2, 0x4, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2, 0xfe,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x6, 0xf8, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x8, 0xf6,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0xe,
-    0xf6, 0x0, 0x8, 0xf5, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x7, 0xf7,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x4, 0xfe,
-    0x10, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0xbf, 0x60, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x3f, 0xfa, 0x8d, 0xfb, 0x0,
-    0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xae, 0xfd, 0x70, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xb3,
-    0x13, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfd, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf9, 0x0, 0x0, 0xa, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0, 0xe,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40,
-    0x1, 0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf3, 0x5e, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0x25, 0xff, 0xf4, 0x0, 0x4, 0xc7, 0x0,
-    0x9, 0xff, 0x90, 0x0, 0x5f, 0xff, 0x40, 0x9,
-    0xff, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x4, 0xff,
-    0xf4, 0xe, 0xfa, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xaf, 0xf4, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xd0, 0x0,
-    0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x80, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x4,
-    0xdf, 0xff, 0xf6, 0x0, 0xa, 0xff, 0xfc, 0x86,
-    0x68, 0xdf, 0xff, 0xaf, 0xff, 0x60, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x3, 0xef, 0xd0,
-    0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa5, 0x0, 0x0,
-    0x2d, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x1f, 0xf6, 0x1f, 0xf5, 0xf, 0xf5, 0xf, 0xf5,
-    0xf, 0xf4, 0xf, 0xf4, 0xf, 0xf3, 0xf, 0xf3,
-    0x1, 0x10,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0xdf, 0xd0, 0x0, 0x6, 0xff, 0x50,
-    0x0, 0xe, 0xfe, 0x0, 0x0, 0x5f, 0xf7, 0x0,
-    0x0, 0xbf, 0xf2, 0x0, 0x0, 0xff, 0xd0, 0x0,
-    0x4, 0xff, 0x80, 0x0, 0x8, 0xff, 0x50, 0x0,
-    0xb, 0xff, 0x20, 0x0, 0xd, 0xff, 0x0, 0x0,
-    0xf, 0xfd, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x2f, 0xfa, 0x0, 0x0,
-    0x2f, 0xfa, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0xf, 0xfc, 0x0, 0x0, 0xf, 0xfd, 0x0, 0x0,
-    0xd, 0xff, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0xff, 0xd0, 0x0, 0x0, 0xaf, 0xf2, 0x0,
-    0x0, 0x5f, 0xf8, 0x0, 0x0, 0xe, 0xfe, 0x0,
-    0x0, 0x6, 0xff, 0x50, 0x0, 0x0, 0xdf, 0xd0,
-
-    /* U+0029 ")" */
-    0xc, 0xfe, 0x10, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0x0, 0xcf, 0xf1, 0x0, 0x0, 0x5f, 0xf7, 0x0,
-    0x0, 0xf, 0xfd, 0x0, 0x0, 0xa, 0xff, 0x20,
-    0x0, 0x6, 0xff, 0x60, 0x0, 0x2, 0xff, 0xa0,
-    0x0, 0x0, 0xff, 0xd0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x8f, 0xf4,
-    0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x9f, 0xf4,
-    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0xff, 0xd0,
-    0x0, 0x3, 0xff, 0xa0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0xb, 0xff, 0x20, 0x0, 0xf, 0xfd, 0x0,
-    0x0, 0x5f, 0xf7, 0x0, 0x0, 0xcf, 0xf1, 0x0,
-    0x4, 0xff, 0x80, 0x0, 0xc, 0xfe, 0x10, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0xc, 0x70, 0xe, 0xe0,
-    0x7, 0xc0, 0x3f, 0xfd, 0x5e, 0xe5, 0xdf, 0xf3,
-    0x2, 0xaf, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x4,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xf8, 0x0, 0x3e, 0xff, 0x7e, 0xe7, 0xff, 0xe3,
-    0xd, 0xa1, 0xe, 0xe0, 0x1a, 0xd0, 0x0, 0x0,
-    0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x8, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x0, 0x0, 0x0, 0x56, 0x66, 0x6b, 0xff, 0x66,
-    0x66, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x8, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x87, 0x0,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x0, 0x1, 0xcf, 0xb0, 0x7f, 0xff, 0x57,
-    0xff, 0xf5, 0x1c, 0xff, 0x20, 0x7f, 0xc0, 0xb,
-    0xf7, 0x0, 0xef, 0x20, 0x2f, 0xd0, 0x2, 0x84,
-    0x0,
-
-    /* U+002D "-" */
-    0x27, 0x77, 0x77, 0x77, 0x64, 0xff, 0xff, 0xff,
-    0xfc, 0x4f, 0xff, 0xff, 0xff, 0xc0,
-
-    /* U+002E "." */
-    0x0, 0x10, 0x2, 0xdf, 0xb0, 0x8f, 0xff, 0x58,
-    0xff, 0xf5, 0x1c, 0xfa, 0x0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x3, 0xad, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x1d, 0xff, 0xfe, 0xbb, 0xef,
-    0xff, 0xd1, 0x0, 0x0, 0xaf, 0xfe, 0x40, 0x0,
-    0x4, 0xef, 0xfb, 0x0, 0x4, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x40, 0xb, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xb0, 0x1f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0x4f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4,
-    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf7, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf8, 0x9f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x8f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x7f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf7, 0x4f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0x1f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0xb,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x7, 0xff, 0xb0,
-    0x4, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x40, 0x0, 0xaf, 0xfe, 0x40, 0x0, 0x4, 0xef,
-    0xfb, 0x0, 0x0, 0x1d, 0xff, 0xfe, 0xbb, 0xdf,
-    0xff, 0xd1, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x3, 0xad,
-    0xff, 0xda, 0x40, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xcf, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0x79, 0x99, 0x9f, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0xf, 0xff,
-
-    /* U+0032 "2" */
-    0x0, 0x2, 0x7b, 0xef, 0xfe, 0xb7, 0x10, 0x0,
-    0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50,
-    0x0, 0x1d, 0xff, 0xff, 0xca, 0xbd, 0xff, 0xff,
-    0x40, 0x3, 0xef, 0xe5, 0x0, 0x0, 0x2, 0xdf,
-    0xfd, 0x0, 0x2, 0xa1, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xfd, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x20, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30,
-
-    /* U+0033 "3" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x8, 0x99, 0x99, 0x99, 0x99, 0x9f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfd, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x6e, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
-    0x8, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf8,
-    0x4f, 0xf9, 0x30, 0x0, 0x0, 0x1a, 0xff, 0xf2,
-    0x9f, 0xff, 0xfe, 0xca, 0xac, 0xff, 0xff, 0x70,
-    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x4, 0x9c, 0xef, 0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
-    0x0, 0x0, 0x33, 0x20, 0x0, 0x0, 0x0, 0x7f,
-    0xfd, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x20, 0x0, 0x1, 0xff, 0xb0, 0x0,
-    0x0, 0x1e, 0xff, 0x50, 0x0, 0x0, 0x1f, 0xfb,
-    0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x0, 0x8, 0xff, 0xf9, 0x99, 0x99,
-    0x99, 0xaf, 0xfe, 0x99, 0x96, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x1f, 0xfd, 0x99, 0x99, 0x99, 0x99,
-    0x90, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xfe, 0xc8, 0x30, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x99, 0x99,
-    0x9a, 0xac, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x7f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x5, 0x70, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd,
-    0x0, 0xef, 0xc5, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x60, 0x4f, 0xff, 0xff, 0xcb, 0xac, 0xff, 0xff,
-    0xb0, 0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x2, 0x7b, 0xef, 0xfe, 0xc8,
-    0x20, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x8, 0xff, 0xff, 0xc9, 0x99, 0xcf,
-    0xe0, 0x0, 0x6, 0xff, 0xf9, 0x10, 0x0, 0x0,
-    0x3, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x1, 0x8c,
-    0xff, 0xfc, 0x81, 0x0, 0x8, 0xff, 0x75, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x8f, 0xfc, 0xff,
-    0xe9, 0x77, 0x9e, 0xff, 0xf6, 0x8, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x8, 0xff, 0xf1, 0x7f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x65, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa, 0x2f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0,
-    0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf9,
-    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x50, 0xd, 0xff, 0x90, 0x0, 0x0, 0x9, 0xff,
-    0xe0, 0x0, 0x2e, 0xff, 0xe9, 0x77, 0x9e, 0xff,
-    0xf4, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x0, 0x4, 0xad, 0xff, 0xeb,
-    0x60, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x1f, 0xfe, 0x99, 0x99, 0x99, 0x99, 0x9e,
-    0xff, 0x81, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf1, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xfa, 0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x20, 0x5, 0x54, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x49, 0xdf, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x1, 0xdf, 0xff, 0xb8, 0x77, 0xaf, 0xff,
-    0xf4, 0x0, 0x8f, 0xfd, 0x20, 0x0, 0x0, 0x1a,
-    0xff, 0xd0, 0xd, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x20, 0xef, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf3, 0xd, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x20, 0x7f, 0xfc, 0x10, 0x0,
-    0x0, 0x8, 0xff, 0xc0, 0x0, 0xcf, 0xfe, 0x95,
-    0x45, 0x7d, 0xff, 0xe2, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x8f, 0xff,
-    0x93, 0x10, 0x2, 0x7e, 0xff, 0xc0, 0x3f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x1c, 0xff, 0x78, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfd, 0xaf,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xc1, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x6, 0xff,
-    0xf5, 0x5, 0xff, 0xff, 0xa7, 0x67, 0x9e, 0xff,
-    0xfa, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xff, 0xeb,
-    0x71, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x39, 0xdf, 0xfe, 0xc8, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xb7, 0x68, 0xbf,
-    0xff, 0x90, 0x0, 0x7, 0xff, 0xd2, 0x0, 0x0,
-    0x2, 0xdf, 0xf6, 0x0, 0xe, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x2f, 0xfe, 0x0, 0x1f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x2f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0xc, 0xff, 0x90, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf0, 0x4, 0xff, 0xfb, 0x41, 0x1, 0x4c, 0xff,
-    0xff, 0xf0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xff, 0xf0, 0x0, 0x3, 0xcf, 0xff, 0xff,
-    0xfc, 0x30, 0xff, 0xf0, 0x0, 0x0, 0x1, 0x56,
-    0x65, 0x10, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf9,
-    0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x4d, 0xff,
-    0xd1, 0x0, 0x0, 0x7f, 0xeb, 0x99, 0xae, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x17, 0xbe, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x1c, 0xfa, 0x8, 0xff, 0xf5, 0x8f, 0xff, 0x51,
-    0xdf, 0xb0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2d, 0xfb,
-    0x8, 0xff, 0xf5, 0x8f, 0xff, 0x51, 0xcf, 0xa0,
-
-    /* U+003B ";" */
-    0x1c, 0xfa, 0x8, 0xff, 0xf5, 0x8f, 0xff, 0x51,
-    0xdf, 0xb0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfb,
-    0x7, 0xff, 0xf5, 0x7f, 0xff, 0x51, 0xcf, 0xf2,
-    0x7, 0xfc, 0x0, 0xbf, 0x70, 0xe, 0xf2, 0x2,
-    0xfd, 0x0, 0x28, 0x40, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xa6, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xef, 0xf7, 0x0, 0x0, 0x0,
-    0x4b, 0xff, 0xff, 0xc3, 0x0, 0x2, 0x8e, 0xff,
-    0xfe, 0x93, 0x0, 0x5, 0xbf, 0xff, 0xfb, 0x50,
-    0x0, 0x0, 0xef, 0xff, 0xd7, 0x10, 0x0, 0x0,
-    0x0, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x3,
-    0x9f, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xb7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003D "=" */
-    0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfa,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfe,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xff,
-    0xb4, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff,
-    0xe8, 0x20, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf7,
-    0x0, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xf6, 0x0,
-    0x0, 0x17, 0xdf, 0xff, 0xf9, 0x30, 0x0, 0x5b,
-    0xff, 0xff, 0xc6, 0x0, 0x0, 0x8e, 0xff, 0xfe,
-    0x82, 0x0, 0x0, 0x0, 0xff, 0xfb, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xe8, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x0, 0x2, 0x7b, 0xef, 0xfe, 0xc7, 0x10, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x1d, 0xff, 0xfd, 0xa8, 0x9b, 0xff, 0xff, 0x40,
-    0x6f, 0xfd, 0x30, 0x0, 0x0, 0x2d, 0xff, 0xd0,
-    0x3, 0x90, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x43, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xc7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xf9, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xef, 0xff,
-    0xec, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xfe, 0x94, 0x20, 0x0, 0x13, 0x7c, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xf8,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0x0,
-    0xcf, 0xc0, 0x0, 0x0, 0x39, 0xdf, 0xfd, 0x92,
-    0x9, 0xff, 0x0, 0x7f, 0xe0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf7, 0x9f,
-    0xf0, 0x0, 0xcf, 0x70, 0xb, 0xfa, 0x0, 0x0,
-    0xaf, 0xfe, 0x74, 0x34, 0x9f, 0xfe, 0xff, 0x0,
-    0x5, 0xfd, 0x0, 0xff, 0x40, 0x0, 0x5f, 0xfc,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf0, 0x0, 0xe,
-    0xf2, 0x4f, 0xf0, 0x0, 0xd, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x0, 0x0, 0xbf, 0x67,
-    0xfc, 0x0, 0x2, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf0, 0x0, 0x8, 0xf8, 0x8f, 0xa0,
-    0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x0, 0x0, 0x7f, 0x98, 0xfa, 0x0, 0x6,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0,
-    0x0, 0x7, 0xf9, 0x8f, 0xa0, 0x0, 0x5f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x0, 0x0,
-    0x8f, 0x76, 0xfc, 0x0, 0x2, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0xa, 0xf5,
-    0x4f, 0xf0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x0, 0x0, 0xef, 0x20, 0xff,
-    0x40, 0x0, 0x5f, 0xfd, 0x10, 0x0, 0x0, 0x4f,
-    0xff, 0xf2, 0x0, 0x5f, 0xd0, 0xa, 0xfa, 0x0,
-    0x0, 0x9f, 0xff, 0x95, 0x46, 0xaf, 0xfa, 0xff,
-    0xc5, 0x7f, 0xf5, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf7, 0xc, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x39,
-    0xdf, 0xfd, 0x92, 0x0, 0x1a, 0xef, 0xd6, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xfe, 0x95, 0x20, 0x1, 0x25, 0xaf, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xef,
-    0xff, 0xdb, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xcd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x6f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x0,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x70, 0x8, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf0, 0x0, 0x1f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf8, 0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x3, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xa0,
-    0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf3, 0x0, 0x0, 0x0, 0x5f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf2, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xa6, 0x66, 0x66, 0x66, 0x6b, 0xff, 0x90,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0xf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xe0, 0x0, 0x7, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x60, 0x0,
-    0xef, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfd, 0x0, 0x5f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf4, 0xc, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xc0,
-
-    /* U+0042 "B" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb6, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x30, 0x0, 0xdf, 0xf8, 0x66, 0x66, 0x66,
-    0x7a, 0xff, 0xff, 0x20, 0xd, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xfb, 0x0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0xd,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x10, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0x0, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x14, 0xaf, 0xff, 0x40, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0,
-    0xd, 0xff, 0x86, 0x66, 0x66, 0x67, 0x8b, 0xff,
-    0xf7, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xf6, 0xd, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xe0, 0xdf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x2d, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf3,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x1d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0xc0, 0xdf, 0xf8, 0x66, 0x66, 0x66,
-    0x68, 0xbf, 0xff, 0xf3, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xda, 0x60, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xa6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xe7, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xfe, 0xba, 0xbd, 0xff, 0xff, 0xb0, 0x0, 0xc,
-    0xff, 0xfa, 0x30, 0x0, 0x0, 0x18, 0xff, 0xf3,
-    0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0x40, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0x40, 0x0, 0x1d, 0xff, 0xfa, 0x30, 0x0,
-    0x0, 0x18, 0xff, 0xf3, 0x0, 0x1, 0xcf, 0xff,
-    0xfe, 0xba, 0xbd, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xa5,
-    0x0, 0x0,
-
-    /* U+0044 "D" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x50, 0x0, 0x0, 0xdf, 0xfa, 0x99,
-    0x99, 0x9a, 0xbe, 0xff, 0xff, 0xa0, 0x0, 0xd,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xbf, 0xff,
-    0xc0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x90, 0xd, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfa, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf0, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x2d, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf4, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x5d, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf4, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x2d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfa, 0xd, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x90, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x3, 0xbf, 0xff, 0xb0, 0x0, 0xdf, 0xfa, 0x99,
-    0x99, 0x9a, 0xbe, 0xff, 0xff, 0xa0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xec,
-    0x94, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xdf, 0xfa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0xdf, 0xfa, 0x88, 0x88, 0x88, 0x88, 0x86, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xfa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+0046 "F" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xfa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0xdf, 0xfa, 0x99, 0x99, 0x99, 0x99,
-    0x96, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x5, 0x9d, 0xff, 0xfe, 0xb7,
-    0x10, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x10, 0x0, 0x1, 0xbf, 0xff,
-    0xfe, 0xca, 0xbc, 0xff, 0xff, 0xd2, 0x0, 0xc,
-    0xff, 0xfb, 0x30, 0x0, 0x0, 0x16, 0xef, 0xf6,
-    0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0x70, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xa5, 0x8f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x2f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf9, 0xc, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x4, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0xc, 0xff, 0xfb, 0x30, 0x0,
-    0x0, 0x5, 0xdf, 0xf9, 0x0, 0x1, 0xbf, 0xff,
-    0xfe, 0xca, 0xbc, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x20,
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xfd, 0xb7,
-    0x10, 0x0,
-
-    /* U+0048 "H" */
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x3d,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3d, 0xff, 0xa9, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0xef, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x3d, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x30,
-
-    /* U+0049 "I" */
-    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
-    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
-    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
-    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
-    0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2, 0xdf, 0xf2,
-    0xdf, 0xf2,
-
-    /* U+004A "J" */
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x19,
-    0x99, 0x99, 0x99, 0xdf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5,
-    0x1, 0xb1, 0x0, 0x0, 0x0, 0xef, 0xf2, 0xc,
-    0xfd, 0x30, 0x0, 0x9, 0xff, 0xd0, 0xd, 0xff,
-    0xfc, 0x99, 0xdf, 0xff, 0x50, 0x1, 0xbf, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x4, 0xae, 0xff,
-    0xda, 0x30, 0x0,
-
-    /* U+004B "K" */
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xf7, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xf8, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xf9, 0x0, 0xd, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0xcf, 0xfb, 0x0, 0x0, 0xd,
-    0xff, 0x20, 0x0, 0x0, 0xcf, 0xfb, 0x0, 0x0,
-    0x0, 0xdf, 0xf2, 0x0, 0x0, 0xbf, 0xfc, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0xbf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0xbf,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
-    0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf2, 0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xbf, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x34, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x30, 0x6,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40,
-    0x0, 0x8, 0xff, 0xf3, 0x0, 0x0, 0xd, 0xff,
-    0x50, 0x0, 0x0, 0xb, 0xff, 0xe1, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0xc, 0xff, 0xc0,
-    0x0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xa0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x70, 0xd, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x20,
-
-    /* U+004C "L" */
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xfa, 0x99, 0x99, 0x99, 0x99, 0x99, 0x5d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-
-    /* U+004D "M" */
-    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x7d, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0xdf,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x7d, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf7, 0xdf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x7d, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf7, 0xdf, 0xf9, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf9, 0xff,
-    0x7d, 0xff, 0x1e, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x6f, 0xf8, 0x6f, 0xf7, 0xdf, 0xf0, 0x5f, 0xfa,
-    0x0, 0x0, 0x0, 0xe, 0xfe, 0x6, 0xff, 0x7d,
-    0xff, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x8, 0xff,
-    0x50, 0x6f, 0xf7, 0xdf, 0xf0, 0x2, 0xff, 0xd0,
-    0x0, 0x2, 0xff, 0xb0, 0x6, 0xff, 0x7d, 0xff,
-    0x0, 0x8, 0xff, 0x60, 0x0, 0xbf, 0xf2, 0x0,
-    0x6f, 0xf7, 0xdf, 0xf0, 0x0, 0xe, 0xfe, 0x10,
-    0x5f, 0xf8, 0x0, 0x6, 0xff, 0x7d, 0xff, 0x0,
-    0x0, 0x5f, 0xf9, 0xd, 0xfe, 0x0, 0x0, 0x6f,
-    0xf7, 0xdf, 0xf0, 0x0, 0x0, 0xcf, 0xfa, 0xff,
-    0x50, 0x0, 0x6, 0xff, 0x7d, 0xff, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xf7,
-    0xdf, 0xf0, 0x0, 0x0, 0x8, 0xff, 0xf2, 0x0,
-    0x0, 0x6, 0xff, 0x8d, 0xff, 0x0, 0x0, 0x0,
-    0xe, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0xdf,
-    0xf0, 0x0, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x8d, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x80,
-
-    /* U+004E "N" */
-    0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x3d, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf3, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xc, 0xff, 0x3d,
-    0xff, 0xdf, 0xfe, 0x20, 0x0, 0x0, 0x0, 0xcf,
-    0xf3, 0xdf, 0xf3, 0xef, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x3d, 0xff, 0x23, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x5, 0xff,
-    0xf7, 0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0x20,
-    0x8, 0xff, 0xf4, 0x0, 0x0, 0xcf, 0xf3, 0xdf,
-    0xf2, 0x0, 0xb, 0xff, 0xf2, 0x0, 0xc, 0xff,
-    0x3d, 0xff, 0x20, 0x0, 0x1d, 0xff, 0xd0, 0x0,
-    0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0, 0x0,
-    0x5f, 0xff, 0x80, 0xcf, 0xf3, 0xdf, 0xf2, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x5c, 0xff, 0x3d, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xef, 0xf3,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x3d, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x5, 0x9d, 0xff, 0xfd, 0xa6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfe, 0xba, 0xbd, 0xff, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa3, 0x0,
-    0x0, 0x2, 0x8f, 0xff, 0xe2, 0x0, 0x0, 0xaf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0xd0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0x80, 0xc, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x2, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf5, 0x5f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x98,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfb, 0x8f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xc8, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfb, 0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x92, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf5, 0xc, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x0, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x80,
-    0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xff, 0xd0, 0x0, 0x0, 0xcf, 0xff, 0xa3,
-    0x0, 0x0, 0x1, 0x8f, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfe, 0xba, 0xbd, 0xff, 0xff,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x9d, 0xff, 0xfd, 0xa6, 0x10, 0x0,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x40, 0x0, 0xdf, 0xfa, 0x99, 0x99, 0x9a, 0xdf,
-    0xff, 0xf5, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x2, 0xbf, 0xff, 0x20, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x90, 0xdf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xc0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0x60, 0xdf, 0xf2, 0x0, 0x0, 0x1,
-    0x39, 0xff, 0xfc, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0xdf, 0xfa,
-    0x99, 0x99, 0x98, 0x63, 0x0, 0x0, 0x0, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x5, 0x9d, 0xff, 0xfd, 0xa6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0xba, 0xbd, 0xff,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa,
-    0x30, 0x0, 0x0, 0x28, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xff, 0xd0, 0x0, 0x4, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf8, 0x0,
-    0xc, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x0, 0x2f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x50,
-    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x8f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb0,
-    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x8f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb0,
-    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x2f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x50,
-    0xc, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x0, 0x4, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf8, 0x0,
-    0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xff, 0xd0, 0x0, 0x0, 0xc, 0xff, 0xfa,
-    0x30, 0x0, 0x0, 0x18, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfe, 0xba, 0xbd, 0xff,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x6, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x9d, 0xff, 0xff, 0xe6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf7, 0x0, 0x0, 0x4, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xd7, 0x57, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xbe, 0xfe, 0xb5, 0x0,
-
-    /* U+0052 "R" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x40, 0x0, 0xdf, 0xfa, 0x99, 0x99, 0x9a, 0xdf,
-    0xff, 0xf5, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x2, 0xbf, 0xff, 0x20, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x90, 0xdf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xe0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xc0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0xdf, 0xf2, 0x0, 0x0, 0x1,
-    0x39, 0xff, 0xfc, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0xdf, 0xf9,
-    0x88, 0x88, 0x89, 0xff, 0xd0, 0x0, 0x0, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0xe, 0xff, 0x40,
-    0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xe1, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xfb, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x60, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf2,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x49, 0xdf, 0xff, 0xeb, 0x72, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x20, 0x2, 0xef, 0xff, 0xc9, 0x89, 0xae, 0xff,
-    0xf4, 0x0, 0xbf, 0xfc, 0x20, 0x0, 0x0, 0x3,
-    0x9d, 0x0, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfc, 0x61,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfd, 0x95, 0x10, 0x0, 0x0, 0x0, 0x4, 0xcf,
-    0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xae, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x7d, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf6,
-    0x9, 0x20, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x35, 0xff, 0x92, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xd0, 0x7f, 0xff, 0xfe, 0xa9, 0x89, 0xcf, 0xff,
-    0xf3, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd3, 0x0, 0x0, 0x3, 0x8b, 0xef, 0xff, 0xda,
-    0x50, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x89, 0x99, 0x99, 0x9e, 0xff, 0xb9,
-    0x99, 0x99, 0x94, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x40, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xb0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfb, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xb0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xfb, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xb0, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfb, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xb0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfb, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xb0, 0xef, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfa, 0xc, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x70, 0x8f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf3,
-    0x2, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xfd, 0x0, 0x9, 0xff, 0xf7, 0x0, 0x0, 0x1,
-    0xaf, 0xff, 0x40, 0x0, 0xc, 0xff, 0xff, 0xca,
-    0xbd, 0xff, 0xff, 0x80, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x2, 0x8c, 0xef, 0xfe, 0xb6, 0x10, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0xc, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x20, 0x5f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb0, 0x0,
-    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf4, 0x0, 0x7, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfd, 0x0, 0x0, 0x1f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x60, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xe0, 0x0, 0x0, 0x2, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x10, 0x0, 0x0, 0x0, 0x4f, 0xfe,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0xcf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x30, 0x0, 0xa, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0,
-    0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf2, 0x0, 0x8f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x80, 0xf,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x7, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf7, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xe, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xa0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf5, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0xd, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xa0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xdf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf4, 0x0, 0x3, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x4f, 0xf8, 0xaf, 0xf4, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x0, 0x0, 0xd, 0xff, 0x30, 0x0,
-    0x0, 0x9, 0xff, 0x24, 0xff, 0x90, 0x0, 0x0,
-    0x3, 0xff, 0xa0, 0x0, 0x0, 0x8f, 0xf8, 0x0,
-    0x0, 0x0, 0xef, 0xd0, 0xe, 0xfe, 0x0, 0x0,
-    0x0, 0x8f, 0xf4, 0x0, 0x0, 0x3, 0xff, 0xd0,
-    0x0, 0x0, 0x4f, 0xf7, 0x0, 0x9f, 0xf4, 0x0,
-    0x0, 0xe, 0xff, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x30, 0x0, 0xa, 0xff, 0x20, 0x4, 0xff, 0x90,
-    0x0, 0x3, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x8f,
-    0xf8, 0x0, 0x0, 0xff, 0xc0, 0x0, 0xe, 0xfe,
-    0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xd0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x9f,
-    0xf4, 0x0, 0xe, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x30, 0xa, 0xff, 0x10, 0x0, 0x3,
-    0xff, 0x90, 0x3, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf8, 0x0, 0xff, 0xc0, 0x0, 0x0,
-    0xe, 0xfe, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xd0, 0x6f, 0xf6, 0x0, 0x0,
-    0x0, 0x9f, 0xf4, 0xe, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x3b, 0xff, 0x10, 0x0,
-    0x0, 0x3, 0xff, 0xa4, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf9, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xd, 0xfe, 0x9f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0xc, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xd0, 0x1, 0xef, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x30, 0x0, 0x5f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xcf, 0xf6, 0x0, 0x0, 0x9,
-    0xff, 0xc0, 0x0, 0x0, 0x8, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xdf, 0xf9, 0x0, 0x0, 0x4f, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x40, 0x1,
-    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xe1, 0xb, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfb, 0x7f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfd, 0xdf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf3, 0x2f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x80, 0x6, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfc, 0x0, 0x0, 0xaf, 0xfc, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf2, 0x0, 0x0, 0xd, 0xff,
-    0x80, 0x0, 0x0, 0x1e, 0xff, 0x50, 0x0, 0x0,
-    0x3, 0xff, 0xf3, 0x0, 0x0, 0xcf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x10, 0x8, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x4f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xf6,
-
-    /* U+0059 "Y" */
-    0xc, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x30, 0x3f, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x9f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe1, 0x0,
-    0x1, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf6, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x60, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x10, 0x0, 0x6, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfa, 0x0, 0x1,
-    0xef, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf4, 0x0, 0xaf, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xd0, 0x3f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x7d, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x9d, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xc9, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x98, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+005B "[" */
-    0xdf, 0xff, 0xff, 0x6d, 0xff, 0xff, 0xf6, 0xdf,
-    0xf6, 0x55, 0x2d, 0xff, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0,
-    0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0xd, 0xff,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0xdf, 0xf0, 0x0, 0xd, 0xff, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0xd, 0xff, 0x0, 0x0, 0xdf,
-    0xf0, 0x0, 0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0,
-    0xd, 0xff, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0xd,
-    0xff, 0x65, 0x52, 0xdf, 0xff, 0xff, 0x6d, 0xff,
-    0xff, 0xf6,
-
-    /* U+005C "\\" */
-    0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf3,
-
-    /* U+005D "]" */
-    0x7f, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xfd, 0x25,
-    0x56, 0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0,
-    0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0xff,
-    0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0xff, 0xd0,
-    0x0, 0xf, 0xfd, 0x0, 0x0, 0xff, 0xd0, 0x0,
-    0xf, 0xfd, 0x0, 0x0, 0xff, 0xd0, 0x0, 0xf,
-    0xfd, 0x0, 0x0, 0xff, 0xd0, 0x0, 0xf, 0xfd,
-    0x0, 0x0, 0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0,
-    0x0, 0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0,
-    0xff, 0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0xff,
-    0xd0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0xff, 0xd2,
-    0x55, 0x6f, 0xfd, 0x7f, 0xff, 0xff, 0xd7, 0xff,
-    0xff, 0xfd,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x4, 0x87, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xff, 0x19,
-    0xfa, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x3, 0xff,
-    0x10, 0x0, 0x0, 0xf, 0xf4, 0x0, 0xcf, 0x70,
-    0x0, 0x0, 0x6f, 0xd0, 0x0, 0x5f, 0xe0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0xe, 0xf5, 0x0, 0x4,
-    0xff, 0x10, 0x0, 0x8, 0xfc, 0x0, 0xb, 0xf9,
-    0x0, 0x0, 0x1, 0xff, 0x20, 0x2f, 0xf3, 0x0,
-    0x0, 0x0, 0xbf, 0x90, 0x8f, 0xc0, 0x0, 0x0,
-    0x0, 0x4f, 0xf1,
-
-    /* U+005F "_" */
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x1c, 0xff, 0xa0, 0x0, 0x0, 0x9, 0xff, 0xa0,
-    0x0, 0x0, 0x5, 0xff, 0xb0, 0x0, 0x0, 0x3,
-    0xef, 0xb0,
-
-    /* U+0061 "a" */
-    0x0, 0x5, 0xad, 0xff, 0xfd, 0x92, 0x0, 0x0,
-    0x5e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xc,
-    0xff, 0xea, 0x87, 0x9e, 0xff, 0xf5, 0x0, 0x3e,
-    0x50, 0x0, 0x0, 0x9, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0,
-    0x1, 0x11, 0x19, 0xff, 0x50, 0x2, 0x9d, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x51, 0xff, 0xf7, 0x20, 0x0,
-    0x0, 0x8f, 0xf5, 0x6f, 0xf8, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x57, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xbf, 0xf5, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x50, 0xef, 0xf9, 0x30, 0x14, 0xaf, 0xff,
-    0xf5, 0x3, 0xef, 0xff, 0xff, 0xff, 0xd8, 0xff,
-    0x50, 0x1, 0x7c, 0xff, 0xec, 0x70, 0x6f, 0xf5,
-
-    /* U+0062 "b" */
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9,
-    0x1, 0x8d, 0xff, 0xeb, 0x50, 0x0, 0x0, 0x4f,
-    0xf9, 0x5f, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0,
-    0x4f, 0xfe, 0xff, 0xfb, 0x88, 0xbf, 0xff, 0xf3,
-    0x0, 0x4f, 0xff, 0xfa, 0x10, 0x0, 0x2, 0xcf,
-    0xfe, 0x0, 0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x80, 0x4f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xd0, 0x4f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xf1, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x4f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x4f,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1,
-    0x4f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xd0, 0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x70, 0x4f, 0xff, 0xfa, 0x10, 0x0, 0x2,
-    0xcf, 0xfe, 0x0, 0x4f, 0xfd, 0xff, 0xfa, 0x88,
-    0xbf, 0xff, 0xf3, 0x0, 0x4f, 0xf7, 0x6f, 0xff,
-    0xff, 0xff, 0xfd, 0x30, 0x0, 0x4f, 0xf7, 0x1,
-    0x8d, 0xff, 0xeb, 0x50, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x17, 0xce, 0xff, 0xd8, 0x20, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x9f, 0xff, 0xea, 0x89, 0xdf, 0xff, 0x80,
-    0x6, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff, 0xc0,
-    0xf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x46, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x50, 0x0, 0x0, 0x0, 0x36, 0x0,
-    0x6, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff, 0xc0,
-    0x0, 0x9f, 0xff, 0xe9, 0x89, 0xdf, 0xff, 0x80,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x17, 0xce, 0xff, 0xd8, 0x20, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfb, 0x0, 0x0, 0x28, 0xdf, 0xfe,
-    0xa4, 0x2, 0xff, 0xb0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xfb, 0x3f, 0xfb, 0x0, 0xbf, 0xff, 0xe9,
-    0x89, 0xdf, 0xfe, 0xff, 0xb0, 0x7f, 0xff, 0x60,
-    0x0, 0x0, 0x5f, 0xff, 0xfb, 0x1f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xb6, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfb, 0x9f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xbb, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0xbf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xb9,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xb1, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfb, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xb0, 0xb, 0xff, 0xfd, 0x98, 0x9d, 0xff,
-    0xdf, 0xfb, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0xff, 0xb0, 0x0, 0x2, 0x8d, 0xff, 0xeb,
-    0x50, 0xf, 0xfb,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0xaf, 0xff, 0xb7, 0x79, 0xef, 0xfe,
-    0x20, 0x0, 0x7f, 0xfd, 0x20, 0x0, 0x0, 0x8f,
-    0xfd, 0x0, 0x1f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x9f, 0xf5, 0x6, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfe, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x6, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x9,
-    0xff, 0xfe, 0xa8, 0x8a, 0xff, 0xfd, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x1, 0x7c, 0xef, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x5, 0xcf, 0xfe, 0xa2, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xf6, 0x0, 0x4, 0xff, 0xf8,
-    0x67, 0xc0, 0x0, 0xa, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x36, 0x6e, 0xff, 0x66, 0x66, 0x30, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb6, 0x0, 0xcf,
-    0xf0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xfd, 0x3c,
-    0xff, 0x0, 0xbf, 0xff, 0xc7, 0x67, 0xaf, 0xff,
-    0xef, 0xf0, 0x8f, 0xfe, 0x30, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0x1f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf7, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xaf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfb, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xbf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf8, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x4f, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0xdf, 0xfb,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x3, 0xff,
-    0xfd, 0x61, 0x1, 0x4b, 0xff, 0xff, 0xf0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x0,
-    0x2, 0xaf, 0xff, 0xff, 0xfe, 0x60, 0xff, 0xe0,
-    0x0, 0x0, 0x15, 0x78, 0x63, 0x0, 0xf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xa0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf6, 0x2, 0xfc, 0x50, 0x0, 0x0, 0x1, 0xaf,
-    0xfe, 0x0, 0xbf, 0xff, 0xfb, 0x98, 0x8b, 0xff,
-    0xff, 0x40, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfe,
-    0xb6, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x2, 0x9d, 0xff, 0xeb, 0x40, 0x0,
-    0x4f, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x4f, 0xff, 0xff, 0xea, 0x9a, 0xef, 0xff, 0xa0,
-    0x4f, 0xff, 0xf7, 0x0, 0x0, 0x7, 0xff, 0xf3,
-    0x4f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x4f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
-    0x4f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-
-    /* U+0069 "i" */
-    0x3d, 0xf7, 0xb, 0xff, 0xf1, 0xaf, 0xff, 0x1,
-    0x9b, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf9, 0x4, 0xff, 0x90, 0x4f, 0xf9, 0x4, 0xff,
-    0x90, 0x4f, 0xf9, 0x4, 0xff, 0x90, 0x4f, 0xf9,
-    0x4, 0xff, 0x90, 0x4f, 0xf9, 0x4, 0xff, 0x90,
-    0x4f, 0xf9, 0x4, 0xff, 0x90, 0x4f, 0xf9, 0x4,
-    0xff, 0x90, 0x4f, 0xf9, 0x4, 0xff, 0x90,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x1, 0xcf, 0x90, 0x0, 0x0, 0x9,
-    0xff, 0xf3, 0x0, 0x0, 0x7, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x8b, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xff, 0xc0,
-    0x0, 0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x2,
-    0xff, 0xc0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0,
-    0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xff,
-    0xc0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0, 0x0,
-    0x2, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xff, 0xc0,
-    0x0, 0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x2,
-    0xff, 0xc0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0,
-    0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x2, 0xff,
-    0xc0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x0, 0x0,
-    0x2, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff, 0xb0,
-    0x0, 0x0, 0x8, 0xff, 0x80, 0x2e, 0x87, 0xaf,
-    0xff, 0x20, 0x8f, 0xff, 0xff, 0xf7, 0x0, 0x3a,
-    0xef, 0xfc, 0x50, 0x0,
-
-    /* U+006B "k" */
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf4, 0x4, 0xff, 0x90, 0x0, 0x0,
-    0x5, 0xff, 0xf4, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x7, 0xff, 0xf4, 0x0, 0x4, 0xff, 0x90, 0x0,
-    0x8, 0xff, 0xf4, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x9, 0xff, 0xf4, 0x0, 0x0, 0x4, 0xff, 0x90,
-    0xa, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4f, 0xf9,
-    0xb, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xbc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xc1, 0x5f, 0xff, 0x50, 0x0, 0x0,
-    0x4f, 0xff, 0xc0, 0x0, 0x8f, 0xff, 0x20, 0x0,
-    0x4, 0xff, 0xc0, 0x0, 0x0, 0xbf, 0xfd, 0x0,
-    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x1, 0xdf, 0xfa,
-    0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x2, 0xff,
-    0xf7, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf4, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xe1,
-
-    /* U+006C "l" */
-    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
-    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
-    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
-    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
-    0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9, 0x4f, 0xf9,
-    0x4f, 0xf9, 0x4f, 0xf9,
-
-    /* U+006D "m" */
-    0x4f, 0xf7, 0x3, 0x9d, 0xff, 0xd9, 0x20, 0x0,
-    0x6, 0xce, 0xff, 0xc7, 0x0, 0x0, 0x4f, 0xf7,
-    0x8f, 0xff, 0xff, 0xff, 0xf6, 0x3, 0xef, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x4f, 0xfe, 0xff, 0xea,
-    0x9b, 0xff, 0xff, 0x7f, 0xff, 0xd9, 0x9c, 0xff,
-    0xfe, 0x10, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x1c,
-    0xff, 0xff, 0xe4, 0x0, 0x0, 0x3e, 0xff, 0x80,
-    0x4f, 0xff, 0x70, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x5, 0xff, 0xd0, 0x4f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf0, 0x4f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf1, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf2, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf2, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf2, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2,
-
-    /* U+006E "n" */
-    0x4f, 0xf7, 0x2, 0x9d, 0xff, 0xeb, 0x40, 0x0,
-    0x4f, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x4f, 0xfe, 0xff, 0xea, 0x9a, 0xef, 0xff, 0xa0,
-    0x4f, 0xff, 0xf7, 0x0, 0x0, 0x7, 0xff, 0xf3,
-    0x4f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x4f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
-    0x4f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x18, 0xcf, 0xff, 0xc8, 0x20, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x9f, 0xff, 0xe9, 0x89, 0xdf, 0xff,
-    0xa0, 0x0, 0x6f, 0xff, 0x60, 0x0, 0x0, 0x5f,
-    0xff, 0x70, 0xf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x16, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf7, 0x9f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xab, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfc, 0xbf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xc9, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfa, 0x5f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0xef, 0xf5,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf1, 0x6, 0xff,
-    0xf6, 0x0, 0x0, 0x5, 0xff, 0xf7, 0x0, 0x9,
-    0xff, 0xfd, 0x98, 0x9d, 0xff, 0xfa, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0x8c, 0xff, 0xfc, 0x82, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x4f, 0xf7, 0x2, 0x8d, 0xff, 0xeb, 0x50, 0x0,
-    0x0, 0x4f, 0xf7, 0x6f, 0xff, 0xff, 0xff, 0xfd,
-    0x30, 0x0, 0x4f, 0xfd, 0xff, 0xfb, 0x88, 0xbf,
-    0xff, 0xf3, 0x0, 0x4f, 0xff, 0xfa, 0x10, 0x0,
-    0x2, 0xcf, 0xfe, 0x0, 0x4f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x80, 0x4f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xd0, 0x4f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf1, 0x4f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf2, 0x4f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf1, 0x4f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xd0, 0x4f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x70, 0x4f, 0xff, 0xfa, 0x10,
-    0x0, 0x2, 0xcf, 0xfe, 0x0, 0x4f, 0xfd, 0xff,
-    0xfa, 0x88, 0xbf, 0xff, 0xf3, 0x0, 0x4f, 0xf9,
-    0x5f, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x4f,
-    0xf9, 0x1, 0x8d, 0xff, 0xeb, 0x50, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x28, 0xdf, 0xfe, 0xb5, 0x0, 0xff,
-    0xb0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xfb, 0x0, 0xbf, 0xff, 0xe9, 0x89, 0xdf, 0xfd,
-    0xff, 0xb0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x5f,
-    0xff, 0xfb, 0x1f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xb6, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfb, 0x9f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xbb, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfb, 0xbf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xb9, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfb, 0x6f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xb1, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xfb, 0x7, 0xff,
-    0xf6, 0x0, 0x0, 0x5, 0xff, 0xff, 0xb0, 0xb,
-    0xff, 0xfd, 0x98, 0x9d, 0xff, 0xdf, 0xfb, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb0,
-    0x0, 0x2, 0x8d, 0xff, 0xea, 0x40, 0x2f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfb,
-
-    /* U+0072 "r" */
-    0x4f, 0xf7, 0x2, 0x9d, 0xf4, 0x4f, 0xf7, 0x7f,
-    0xff, 0xf4, 0x4f, 0xfd, 0xff, 0xfb, 0xa2, 0x4f,
-    0xff, 0xf9, 0x0, 0x0, 0x4f, 0xff, 0x90, 0x0,
-    0x0, 0x4f, 0xff, 0x10, 0x0, 0x0, 0x4f, 0xfc,
-    0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4f,
-    0xf9, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0, 0x4f, 0xf9,
-    0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x1, 0x7c, 0xef, 0xfe, 0xb7, 0x20, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x2,
-    0xff, 0xfd, 0x87, 0x79, 0xdf, 0xf1, 0x0, 0x9f,
-    0xf8, 0x0, 0x0, 0x0, 0x35, 0x0, 0xb, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfb,
-    0x63, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xd9, 0x40, 0x0, 0x0, 0x4, 0xae, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x1, 0x47,
-    0xaf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf2, 0x6, 0xc4, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x0, 0xef, 0xfe, 0xa8, 0x78, 0xaf, 0xff,
-    0x80, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xc9, 0x30, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x6, 0x88, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x36, 0x6e, 0xff, 0x66,
-    0x66, 0x30, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x60, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf9, 0x78, 0xe1, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x6, 0xcf, 0xfd, 0x91,
-
-    /* U+0075 "u" */
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8,
-    0x6f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf8,
-    0x2f, 0xff, 0x10, 0x0, 0x0, 0x3, 0xff, 0xf8,
-    0xc, 0xff, 0xc1, 0x0, 0x0, 0x4e, 0xff, 0xf8,
-    0x3, 0xff, 0xff, 0xb9, 0x9d, 0xff, 0xef, 0xf8,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xfb, 0x4f, 0xf8,
-    0x0, 0x1, 0x8c, 0xff, 0xeb, 0x50, 0x3f, 0xf8,
-
-    /* U+0076 "v" */
-    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf9, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf2, 0x0, 0xef, 0xf0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x40, 0x0, 0x1f, 0xfd, 0x0,
-    0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0xa, 0xff,
-    0x40, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x3,
-    0xff, 0xb0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0,
-    0x0, 0xcf, 0xf2, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5f, 0xf9, 0x0, 0xb, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x0, 0x2f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x60, 0x9f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd1,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf1, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x94, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0xe, 0xfd, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xfd,
-    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x1, 0xff, 0x80, 0x2, 0xff,
-    0x80, 0x0, 0x0, 0x5f, 0xf8, 0xff, 0x60, 0x0,
-    0x0, 0x7f, 0xf2, 0x0, 0xc, 0xfe, 0x0, 0x0,
-    0xc, 0xfe, 0xe, 0xfc, 0x0, 0x0, 0xd, 0xfc,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x2, 0xff, 0x80,
-    0x8f, 0xf2, 0x0, 0x3, 0xff, 0x60, 0x0, 0x1,
-    0xff, 0xa0, 0x0, 0x8f, 0xf1, 0x2, 0xff, 0x80,
-    0x0, 0x9f, 0xf0, 0x0, 0x0, 0xa, 0xff, 0x0,
-    0xd, 0xfb, 0x0, 0xc, 0xfe, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x4f, 0xf5, 0x4, 0xff, 0x50,
-    0x0, 0x6f, 0xf4, 0x5, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xef, 0xb0, 0xaf, 0xe0, 0x0, 0x0, 0xff,
-    0xa0, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x2f, 0xf9, 0x0, 0x0, 0x9, 0xff, 0x1f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0xff, 0x30,
-    0x0, 0x0, 0x3f, 0xfc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x10, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0xbf, 0xf6,
-    0x0, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xfa,
-    0x0, 0x0, 0x6f, 0xfc, 0x0, 0x0, 0x3f, 0xfd,
-    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x1e, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xdf, 0xf5, 0xb, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfc, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfe, 0x10, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x40, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0xa,
-    0xff, 0x80, 0x0, 0x1, 0xef, 0xf3, 0x0, 0x6,
-    0xff, 0xc0, 0x0, 0x0, 0x4, 0xff, 0xe1, 0x3,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x8, 0xff, 0xb0,
-
-    /* U+0079 "y" */
-    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf9, 0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf2, 0x0, 0xef, 0xf1, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x8f, 0xf7, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x40, 0x0, 0x1f, 0xfe, 0x0,
-    0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0xa, 0xff,
-    0x50, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x3,
-    0xff, 0xc0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0,
-    0x0, 0xcf, 0xf3, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x5f, 0xfa, 0x0, 0xa, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x2f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x80, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe1,
-    0xef, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xfb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x4, 0x0, 0x0, 0x6f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe9, 0x7a, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbe, 0xfe,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x36, 0x66,
-    0x66, 0x66, 0x6c, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x75, 0x55, 0x55,
-    0x55, 0x52, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x2a, 0xef, 0xf0, 0x0, 0x2e, 0xff,
-    0xff, 0x0, 0x9, 0xff, 0xe7, 0x50, 0x0, 0xdf,
-    0xf3, 0x0, 0x0, 0xe, 0xff, 0x0, 0x0, 0x0,
-    0xef, 0xf0, 0x0, 0x0, 0xe, 0xff, 0x0, 0x0,
-    0x0, 0xef, 0xf0, 0x0, 0x0, 0xe, 0xff, 0x0,
-    0x0, 0x0, 0xef, 0xf0, 0x0, 0x0, 0xe, 0xff,
-    0x0, 0x0, 0x0, 0xef, 0xf0, 0x0, 0x0, 0x3f,
-    0xfd, 0x0, 0x4, 0xff, 0xff, 0x60, 0x0, 0x4f,
-    0xff, 0xd2, 0x0, 0x1, 0x69, 0xff, 0xc0, 0x0,
-    0x0, 0xe, 0xff, 0x0, 0x0, 0x0, 0xef, 0xf0,
-    0x0, 0x0, 0xe, 0xff, 0x0, 0x0, 0x0, 0xef,
-    0xf0, 0x0, 0x0, 0xe, 0xff, 0x0, 0x0, 0x0,
-    0xef, 0xf0, 0x0, 0x0, 0xe, 0xff, 0x0, 0x0,
-    0x0, 0xef, 0xf0, 0x0, 0x0, 0xd, 0xff, 0x30,
-    0x0, 0x0, 0x9f, 0xfe, 0x75, 0x0, 0x2, 0xef,
-    0xff, 0xf0, 0x0, 0x2, 0xae, 0xff,
-
-    /* U+007C "|" */
-    0xdf, 0xdd, 0xfd, 0xdf, 0xdd, 0xfd, 0xdf, 0xdd,
-    0xfd, 0xdf, 0xdd, 0xfd, 0xdf, 0xdd, 0xfd, 0xdf,
-    0xdd, 0xfd, 0xdf, 0xdd, 0xfd, 0xdf, 0xdd, 0xfd,
-    0xdf, 0xdd, 0xfd, 0xdf, 0xdd, 0xfd, 0xdf, 0xdd,
-    0xfd, 0xdf, 0xdd, 0xfd, 0xdf, 0xdd, 0xfd, 0xdf,
-    0xdd, 0xfd,
-
-    /* U+007D "}" */
-    0x7f, 0xfc, 0x60, 0x0, 0x7, 0xff, 0xff, 0x90,
-    0x0, 0x26, 0xaf, 0xff, 0x20, 0x0, 0x0, 0xbf,
-    0xf6, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0,
-    0x7f, 0xf7, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0,
-    0x0, 0x7f, 0xf7, 0x0, 0x0, 0x7, 0xff, 0x70,
-    0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0, 0x7, 0xff,
-    0x70, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x0, 0x5,
-    0xff, 0xc0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x0,
-    0x0, 0x7f, 0xff, 0xc0, 0x0, 0x3f, 0xfe, 0x75,
-    0x0, 0x6, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xf7,
-    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x7f,
-    0xf7, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x0,
-    0x7f, 0xf7, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0,
-    0x0, 0x7f, 0xf7, 0x0, 0x0, 0xa, 0xff, 0x60,
-    0x2, 0x6a, 0xff, 0xf2, 0x0, 0x7f, 0xff, 0xf9,
-    0x0, 0x7, 0xff, 0xd7, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x32, 0x0, 0x0, 0x0, 0x3, 0x20,
-    0x7, 0xff, 0xfc, 0x20, 0x0, 0x4, 0xfa, 0x6,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x8f, 0x80, 0xef,
-    0x90, 0x2b, 0xff, 0x93, 0x7f, 0xf3, 0x1f, 0xe0,
-    0x0, 0x9, 0xff, 0xff, 0xfb, 0x3, 0xfa, 0x0,
-    0x0, 0x4, 0xcf, 0xe9, 0x0,
-
-    /* U+00A0 " " */
-
-    /* U+00B0 "°" */
-    0x0, 0x4, 0x89, 0x71, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xf7, 0x0, 0xc, 0xf8, 0x10, 0x3c, 0xf5,
-    0x5, 0xf8, 0x0, 0x0, 0x1e, 0xe0, 0x9f, 0x10,
-    0x0, 0x0, 0x9f, 0x2a, 0xf0, 0x0, 0x0, 0x8,
-    0xf3, 0x7f, 0x40, 0x0, 0x0, 0xcf, 0x1, 0xfe,
-    0x20, 0x0, 0x8f, 0x90, 0x5, 0xff, 0xba, 0xdf,
-    0xc1, 0x0, 0x3, 0xae, 0xfd, 0x70, 0x0,
-
-    /* U+00D3 "Ó" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9d, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfe, 0xba, 0xbd, 0xff, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xa3, 0x0, 0x0, 0x2, 0x8f,
-    0xff, 0xe2, 0x0, 0x0, 0xaf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0xff, 0xd0, 0x0, 0x4f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0x80, 0xc, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x2, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf5, 0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x98, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
-    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb, 0x5f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x92, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf5, 0xc, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0x80, 0x0, 0xaf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xd0,
-    0x0, 0x0, 0xcf, 0xff, 0xa3, 0x0, 0x0, 0x1,
-    0x8f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfe, 0xba, 0xbd, 0xff, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x9d,
-    0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+00F3 "ó" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xdd, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xcf, 0xff,
-    0xc8, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x9f, 0xff, 0xe9,
-    0x89, 0xdf, 0xff, 0xa0, 0x0, 0x6f, 0xff, 0x60,
-    0x0, 0x0, 0x5f, 0xff, 0x70, 0xf, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x16, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x9f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xab, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0xbf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xc9,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa,
-    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x60, 0xef, 0xf5, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf1, 0x6, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff,
-    0xf7, 0x0, 0x9, 0xff, 0xfd, 0x98, 0x9d, 0xff,
-    0xfa, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x1, 0x8c, 0xff, 0xfc,
-    0x82, 0x0, 0x0,
-
-    /* U+0104 "Ą" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfc, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x6f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xd0, 0xe, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x8, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x0, 0x1, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0xaf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf2, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xa0, 0x0, 0x0, 0xc,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x30, 0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfa,
-    0x66, 0x66, 0x66, 0x66, 0xbf, 0xf9, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0xf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0,
-    0x0, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfd, 0x0, 0x5, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x40,
-    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfc, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x20, 0x31,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x17, 0xaa, 0x61,
-
-    /* U+0105 "ą" */
-    0x0, 0x5, 0xad, 0xff, 0xfd, 0x92, 0x0, 0x0,
-    0x5e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xc,
-    0xff, 0xea, 0x87, 0x9e, 0xff, 0xf5, 0x0, 0x3e,
-    0x50, 0x0, 0x0, 0x9, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0,
-    0x1, 0x11, 0x19, 0xff, 0x50, 0x2, 0x9d, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x51, 0xff, 0xf7, 0x20, 0x0,
-    0x0, 0x8f, 0xf5, 0x6f, 0xf8, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x57, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0xbf, 0xf5, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x50, 0xef, 0xf9, 0x30, 0x14, 0xaf, 0xff,
-    0xf5, 0x3, 0xef, 0xff, 0xff, 0xff, 0xd8, 0xff,
-    0x50, 0x1, 0x7c, 0xff, 0xec, 0x70, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0x2, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x59, 0xa8, 0x30,
-
-    /* U+0106 "Ć" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfd, 0xa6, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0,
-    0x0, 0x1, 0xbf, 0xff, 0xfe, 0xba, 0xbd, 0xff,
-    0xff, 0xb0, 0x0, 0xc, 0xff, 0xfa, 0x30, 0x0,
-    0x0, 0x18, 0xff, 0xf3, 0x0, 0xaf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0x40, 0x4, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0x40, 0x0, 0x1d,
-    0xff, 0xfa, 0x30, 0x0, 0x0, 0x18, 0xff, 0xf3,
-    0x0, 0x1, 0xcf, 0xff, 0xfe, 0xba, 0xbd, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xad, 0xff, 0xfd, 0xa5, 0x0, 0x0,
-
-    /* U+0107 "ć" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9d, 0xc2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xce, 0xff, 0xd8, 0x20, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x9f, 0xff, 0xea, 0x89, 0xdf, 0xff, 0x80,
-    0x6, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff, 0xc0,
-    0xf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x46, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x50, 0x0, 0x0, 0x0, 0x36, 0x0,
-    0x6, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff, 0xc0,
-    0x0, 0x9f, 0xff, 0xe9, 0x89, 0xdf, 0xff, 0x80,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x17, 0xce, 0xff, 0xd8, 0x20, 0x0,
-
-    /* U+0118 "Ę" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0xdf, 0xfa, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x90, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0xd, 0xff, 0xa8,
-    0x88, 0x88, 0x88, 0x88, 0x60, 0x0, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfa, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x93, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf5, 0x1, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x49, 0xa8, 0x30,
-
-    /* U+0119 "ę" */
-    0x0, 0x0, 0x29, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x0, 0x0, 0xaf, 0xff, 0xb7, 0x79, 0xef, 0xfe,
-    0x20, 0x0, 0x7f, 0xfd, 0x20, 0x0, 0x0, 0x8f,
-    0xfd, 0x0, 0x1f, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x9f, 0xf5, 0x6, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfe, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x19, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x6, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x9,
-    0xff, 0xfe, 0xa8, 0x8a, 0xff, 0xfd, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x1, 0x7c, 0xef, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe2,
-    0x3, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6a, 0xa7, 0x10, 0x0,
-
-    /* U+0141 "Ł" */
-    0x0, 0x9, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x60,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x60, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x69, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xdb, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x9, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xc9, 0x99, 0x99,
-    0x99, 0x99, 0x97, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+0142 "ł" */
-    0x0, 0x0, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xf, 0xfd, 0x3, 0x0, 0x0, 0x0, 0xff, 0xd8,
-    0xf7, 0x0, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0x0, 0x8f, 0xff,
-    0x20, 0x0, 0x1, 0xcf, 0xff, 0xd0, 0x0, 0x0,
-    0xef, 0xff, 0xfd, 0x0, 0x0, 0x7, 0xd3, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x0,
-    0x0,
-
-    /* U+0143 "Ń" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x88, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x87, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x3d, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x3d, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x3d, 0xff, 0xdf, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0xcf, 0xf3, 0xdf, 0xf3, 0xef, 0xfd, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0x3d, 0xff, 0x23, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x5,
-    0xff, 0xf7, 0x0, 0x0, 0xc, 0xff, 0x3d, 0xff,
-    0x20, 0x8, 0xff, 0xf4, 0x0, 0x0, 0xcf, 0xf3,
-    0xdf, 0xf2, 0x0, 0xb, 0xff, 0xf2, 0x0, 0xc,
-    0xff, 0x3d, 0xff, 0x20, 0x0, 0x1d, 0xff, 0xd0,
-    0x0, 0xcf, 0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x2f,
-    0xff, 0xb0, 0xc, 0xff, 0x3d, 0xff, 0x20, 0x0,
-    0x0, 0x5f, 0xff, 0x80, 0xcf, 0xf3, 0xdf, 0xf2,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x5c, 0xff, 0x3d,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xef,
-    0xf3, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x3d, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xf3, 0xdf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x3d, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0xdf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x30,
-
-    /* U+0144 "ń" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xd4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf7, 0x2, 0x9d, 0xff, 0xeb, 0x40, 0x0,
-    0x4f, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x4f, 0xfe, 0xff, 0xea, 0x9a, 0xef, 0xff, 0xa0,
-    0x4f, 0xff, 0xf7, 0x0, 0x0, 0x7, 0xff, 0xf3,
-    0x4f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf8,
-    0x4f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfb,
-    0x4f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc,
-    0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-    0x4f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd,
-
-    /* U+015A "Ś" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xdf, 0xff,
-    0xeb, 0x72, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x20, 0x2, 0xef, 0xff, 0xc9,
-    0x89, 0xae, 0xff, 0xf4, 0x0, 0xbf, 0xfc, 0x20,
-    0x0, 0x0, 0x3, 0x9d, 0x0, 0x1f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xfd, 0x95, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xae, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7d, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf6, 0x9, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x35, 0xff, 0x92, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xd0, 0x7f, 0xff, 0xfe, 0xa9,
-    0x89, 0xcf, 0xff, 0xf3, 0x0, 0x4c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x3, 0x8b,
-    0xef, 0xff, 0xda, 0x50, 0x0, 0x0,
-
-    /* U+015B "ś" */
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4d, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7c,
-    0xef, 0xfe, 0xb7, 0x20, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x2, 0xff, 0xfd, 0x87,
-    0x79, 0xdf, 0xf1, 0x0, 0x9f, 0xf8, 0x0, 0x0,
-    0x0, 0x35, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfb, 0x63, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x4, 0xae, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x1, 0x47, 0xaf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x6,
-    0xc4, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x0, 0xef,
-    0xfe, 0xa8, 0x78, 0xaf, 0xff, 0x80, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x1, 0x7b,
-    0xef, 0xff, 0xc9, 0x30, 0x0,
-
-    /* U+0179 "Ź" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x88, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x86, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xc9, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x98, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd,
-
-    /* U+017A "ź" */
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xc9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x36, 0x66, 0x66, 0x66, 0x6c, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x75,
-    0x55, 0x55, 0x55, 0x52, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8,
-
-    /* U+017B "Ż" */
-    0x0, 0x0, 0x0, 0x0, 0x67, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xee,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9d, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xc9, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x98, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd,
-
-    /* U+017C "ż" */
-    0x0, 0x0, 0x5, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x76, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x36, 0x66, 0x66, 0x66, 0x6c, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x75,
-    0x55, 0x55, 0x55, 0x52, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8,
-
-    /* U+2010 "‐" */
-    0x27, 0x77, 0x77, 0x77, 0x64, 0xff, 0xff, 0xff,
-    0xfc, 0x4f, 0xff, 0xff, 0xff, 0xc0,
-
-    /* U+2013 "–" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+2014 "—" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+201D "”" */
-    0x1b, 0xfa, 0x0, 0x4e, 0xf6, 0x7, 0xff, 0xf5,
-    0xc, 0xff, 0xf0, 0x7f, 0xff, 0x60, 0xdf, 0xff,
-    0x1, 0xcf, 0xf2, 0x4, 0xff, 0xd0, 0x7, 0xfd,
-    0x0, 0xc, 0xf8, 0x0, 0xaf, 0x70, 0x0, 0xff,
-    0x20, 0xe, 0xf2, 0x0, 0x4f, 0xd0, 0x2, 0xfd,
-    0x0, 0x7, 0xf8, 0x0, 0x28, 0x40, 0x0, 0x58,
-    0x20, 0x0,
-
-    /* U+201E "„" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xb0,
-    0x4, 0xef, 0x60, 0x7f, 0xff, 0x50, 0xdf, 0xff,
-    0x7, 0xff, 0xf5, 0xd, 0xff, 0xf0, 0x1c, 0xff,
-    0x20, 0x4e, 0xfd, 0x0, 0x7f, 0xc0, 0x0, 0xcf,
-    0x70, 0xb, 0xf7, 0x0, 0xf, 0xf2, 0x0, 0xef,
-    0x20, 0x4, 0xfd, 0x0, 0x2f, 0xd0, 0x0, 0x7f,
-    0x70, 0x2, 0x84, 0x0, 0x5, 0x81, 0x0,
-
-    /* U+2022 "•" */
-    0x0, 0x27, 0x50, 0x0, 0x5f, 0xff, 0xb0, 0xe,
-    0xff, 0xff, 0x40, 0xff, 0xff, 0xf6, 0xb, 0xff,
-    0xff, 0x20, 0x1b, 0xfd, 0x50,
-
-    /* U+2026 "…" */
-    0x0, 0x10, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x10, 0x2, 0xdf, 0xb0, 0x0, 0x2d, 0xfb, 0x0,
-    0x2, 0xef, 0xa0, 0x8f, 0xff, 0x50, 0x9, 0xff,
-    0xf4, 0x0, 0xaf, 0xff, 0x38, 0xff, 0xf5, 0x0,
-    0x8f, 0xff, 0x40, 0x9, 0xff, 0xf3, 0x1c, 0xfa,
-    0x0, 0x1, 0xcf, 0x90, 0x0, 0x1c, 0xf9, 0x0,
-
-    /* U+F001 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xcf, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0xef, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x6b, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0xae, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x72, 0xef, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x51, 0x0,
-    0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xc8, 0x30, 0x0, 0x0, 0x0,
-    0xef, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x35, 0x53, 0xef, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x10, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x16, 0x99,
-    0x8c, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x3, 0xae, 0xff,
-    0xfc, 0x60, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xac, 0xdc, 0x94, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F008 "" */
-    0x26, 0x0, 0x1, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x40, 0x0, 0x62, 0xee,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xee, 0xff, 0xba,
-    0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xea, 0xaa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x48, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xb4, 0x44, 0xff, 0xfe, 0x0, 0x3, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80,
-    0x0, 0xef, 0xfe, 0x0, 0x3, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0xef, 0xff, 0x10, 0x5, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xa0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xee, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xfe, 0xee, 0xff, 0xfe, 0x0,
-    0x4, 0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xad, 0xff, 0x90, 0x0, 0xef, 0xfe, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xef, 0xfe, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xef, 0xff, 0x76, 0x6a, 0xff, 0xc2,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0xff, 0xc6,
-    0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x98, 0x8b, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xd8, 0x88, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0xef, 0xfe,
-    0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x80, 0x0, 0xef, 0xfe, 0x0,
-    0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x80, 0x0, 0xef, 0xff, 0xcc, 0xce,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x32, 0x27, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
-    0x22, 0xff, 0x9d, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xd9,
-
-    /* U+F00B "" */
-    0x26, 0x77, 0x77, 0x76, 0x0, 0x4, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x62, 0xef,
-    0xff, 0xff, 0xff, 0x90, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0xff, 0x50, 0x1e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x50, 0x1d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xff, 0x90, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x27,
-    0x88, 0x88, 0x87, 0x10, 0x5, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x72, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0x88, 0x88,
-    0x87, 0x10, 0x6, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x83, 0xef, 0xff, 0xff, 0xff,
-    0xa0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xfe, 0x40, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8,
-
-    /* U+F00C "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x6e, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x6,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xa3,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xad,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F00D "" */
-    0x0, 0x67, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0x30, 0x0, 0xbf, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x50, 0x9f, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xf9, 0xbf, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0x51, 0xcf, 0xff, 0xff,
-    0xfd, 0x10, 0x5f, 0xff, 0xff, 0xff, 0x70, 0x1,
-    0xcf, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0x71, 0xcf, 0xff, 0xff, 0xfd, 0x10,
-    0x5f, 0xff, 0xff, 0xff, 0x70, 0x1, 0xcf, 0xff,
-    0xff, 0xfd, 0x1e, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xf8, 0xdf, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0x73,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xff, 0xc0, 0x4, 0xef, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F011 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x26, 0x10, 0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0,
-    0x45, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xb0, 0x0, 0x2f, 0xff, 0xf9, 0x0, 0x5, 0xff,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf5,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfa, 0x0,
-    0x2f, 0xff, 0xf9, 0x0, 0x3f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xf4, 0x0, 0x2f,
-    0xff, 0xf9, 0x0, 0xd, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x40, 0x0, 0x2f, 0xff,
-    0xf9, 0x0, 0x1, 0xcf, 0xff, 0xff, 0x10, 0x2,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x2f, 0xff, 0xf9,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x90, 0x8, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x2f, 0xff, 0xf9, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf1, 0xe, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf5, 0x2f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf9, 0x5f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xfc, 0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfe, 0x8f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x7f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfe, 0x6f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x6, 0xbb, 0xa1,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xfd, 0x3f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfb, 0xf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf7, 0xa, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xf2, 0x4, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xb0, 0x0, 0xcf, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x30, 0x0, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xb3, 0x0, 0x0,
-    0x0, 0x17, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xeb, 0x99, 0xad,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5a, 0xef, 0xff, 0xff, 0xc8, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x12, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F013 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xcc, 0xb8,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x0, 0x1,
-    0x8f, 0xff, 0xff, 0xff, 0xf8, 0x10, 0x0, 0x12,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x70, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc5, 0x11, 0x5c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x3, 0xdf, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xfd, 0x30, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x5e,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xe5, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x99, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x8, 0xff, 0xe7, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x7e, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x99, 0x10, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x8a, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F015 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x32, 0x0, 0x0, 0x0, 0x34, 0x44, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3d, 0xff, 0xb1, 0x0, 0x1, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x20, 0x1, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf4, 0x1, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xff, 0xfc, 0x24, 0xef, 0xff,
-    0xfb, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xa0, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf7, 0x0, 0x75,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x50, 0x1b,
-    0xff, 0x80, 0x8, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xe3, 0x2,
-    0xdf, 0xff, 0xfb, 0x0, 0x5f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xfc, 0x10,
-    0x4f, 0xff, 0xff, 0xff, 0xd2, 0x3, 0xef, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xa0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x1c,
-    0xff, 0xff, 0xd2, 0x0, 0x8, 0xff, 0xff, 0xf7,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0xaf, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff,
-    0x40, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x7, 0xff, 0xff, 0xf6, 0xcf, 0xff,
-    0xd2, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x10, 0x5f, 0xff, 0xf8, 0x1e,
-    0xfb, 0x10, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd2, 0x2, 0xef, 0xc0,
-    0x3, 0x70, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x18,
-    0x10, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xa7, 0x77, 0x7d, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0,
-
-    /* U+F019 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x11,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xcd,
-    0xdd, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0xdd, 0xdc,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x26, 0x77, 0x77, 0x77, 0x77,
-    0x10, 0x4f, 0xff, 0xf5, 0x1, 0x77, 0x77, 0x77,
-    0x77, 0x62, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd2,
-    0x4, 0xff, 0x40, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x22, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x8f, 0x60, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8f,
-    0x60, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x5a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xa5,
-
-    /* U+F01C "" */
-    0x0, 0x0, 0x0, 0x2, 0x9b, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xb8, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe1, 0x0,
-    0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfa,
-    0x0, 0x9, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x50, 0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xe1, 0xcf, 0xff, 0xd4, 0x44, 0x44,
-    0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x44,
-    0x44, 0x4f, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x88, 0x88,
-    0x88, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-
-    /* U+F021 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x31, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x26, 0xab, 0xdd, 0xb8,
-    0x40, 0x0, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x92, 0x0, 0x1, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0xff, 0xff, 0x0, 0x0, 0x4, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x30, 0xff, 0xff, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xb8, 0x66, 0x8c, 0xff, 0xff, 0xff, 0xf5,
-    0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff, 0x81,
-    0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xd, 0xff, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x9f, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x1,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x22, 0x10, 0xd, 0xff, 0xff, 0xff, 0x8, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x2e, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x22, 0x10, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xec, 0xcd,
-    0xef, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x50, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfd,
-    0x0, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf5, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0x90, 0x0, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xfa, 0x51, 0x0, 0x14,
-    0x9f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xff, 0xff,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xff, 0xff, 0x10, 0x1,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x10, 0x0, 0x1,
-    0x6b, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x2, 0x43, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F026 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0x8e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x44, 0x44, 0x44, 0x7f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F027 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x8e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x9, 0xc4, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x2, 0xff, 0xf4, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xb, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0xa, 0xff, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x4f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x5, 0xff, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2, 0xef,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1, 0xef, 0xfb, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xfd, 0x10,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x36, 0x0, 0x0, 0x44, 0x44, 0x44, 0x7f,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F028 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xf0, 0x0, 0x0, 0x4,
-    0x92, 0x0, 0xb, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0x50, 0x0, 0xdf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0x3f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x20, 0x9, 0xff,
-    0x70, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xc0, 0x2,
-    0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xad, 0x40, 0x0, 0xef, 0xf4,
-    0x0, 0xcf, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x2, 0xff, 0xf5, 0x0, 0x6f,
-    0xf9, 0x0, 0x7f, 0xf6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0xff, 0x0,
-    0xf, 0xfe, 0x0, 0x4f, 0xf9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xa, 0xff,
-    0x60, 0xc, 0xff, 0x0, 0x2f, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x4,
-    0xff, 0x80, 0xb, 0xff, 0x10, 0x1f, 0xfb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x6, 0xff, 0x70, 0xc, 0xff, 0x10, 0x2f, 0xfb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x3e, 0xff, 0x30, 0xe, 0xff, 0x0, 0x3f,
-    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1, 0xff, 0xfb, 0x0, 0x3f, 0xfc, 0x0,
-    0x6f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x1, 0xff, 0xc1, 0x0, 0xaf, 0xf7,
-    0x0, 0xaf, 0xf4, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x35, 0x0, 0x4, 0xff,
-    0xf1, 0x0, 0xef, 0xf0, 0x4, 0x44, 0x44, 0x47,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x70, 0x6, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x6,
-    0xff, 0xfc, 0x0, 0xd, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0xf, 0xff, 0xc1, 0x0, 0x8f, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0,
-    0x0, 0xc, 0xf9, 0x0, 0x4, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x10, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0x60, 0x0, 0x0, 0x0,
-
-    /* U+F02D "" */
-    0x0, 0x1, 0x56, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x73, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0x92, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x27, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-    0xfb, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x4c, 0xff, 0x90, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf8, 0xf, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0xdf,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf9, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x5, 0x9b,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xb8, 0x0,
-
-    /* U+F039 "" */
-    0x69, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x98, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9c, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x80,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xb1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x10,
-
-    /* U+F03E "" */
-    0x0, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x2,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x1c, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0xcf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90,
-
-    /* U+F043 "" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e,
-    0xff, 0xf9, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xd0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xcf,
-    0xff, 0x10, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x87, 0xff, 0xf8, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xf4, 0x2,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x9f,
-    0xff, 0xf4, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff,
-    0x50, 0x1, 0xef, 0xff, 0xfb, 0x41, 0xc, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x2,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x9a,
-    0xba, 0x84, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F048 "" */
-    0x4, 0x44, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0x10, 0x3f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xf2, 0x4f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xf7, 0x4f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xf8,
-    0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf8, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xf0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff,
-    0xf0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x4f, 0xff, 0xf0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x4f, 0xff, 0xf0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xf0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff,
-    0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x4f, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x4f, 0xff, 0xf0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xf0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff,
-    0xf0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x4f, 0xff, 0xf0, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xf8, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xf8, 0x4f, 0xff, 0xf0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xf8, 0x4f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xf8,
-    0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf8, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf6, 0x2e, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F04B "" */
-    0x0, 0x32, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xfa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb2, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xba, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F04C "" */
-    0x0, 0x34, 0x44, 0x44, 0x41, 0x0, 0x0, 0x0,
-    0x3, 0x44, 0x44, 0x44, 0x10, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x29, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x9,
-    0xef, 0xff, 0xff, 0xeb, 0x20, 0x0, 0x0, 0x9e,
-    0xff, 0xff, 0xfe, 0xb2, 0x0,
-
-    /* U+F04D "" */
-    0x0, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x10, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x9,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xb2, 0x0,
-
-    /* U+F051 "" */
-    0x1, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x44, 0x40, 0x2e, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf4, 0x6f, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf4, 0x7f, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0xe, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0xe, 0xff, 0xf4, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xe, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xe,
-    0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0xe, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xe, 0xff, 0xf4, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e,
-    0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xe, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0xe, 0xff, 0xf4, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0xe, 0xff, 0xf4,
-    0x7f, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0xe,
-    0xff, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0xe, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0xe, 0xff, 0xf4, 0x7f, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf4,
-    0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf4, 0x6f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf4, 0xa, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F052 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x6a,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x78, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x20,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x4, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x70,
-
-    /* U+F053 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x27, 0x10, 0x0,
-
-    /* U+F054 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F060 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xfb, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0x60, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0xcf, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x63, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F067 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x56, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x11, 0x11, 0x11, 0x11, 0xbf, 0xff, 0xff, 0x11,
-    0x11, 0x11, 0x11, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0x17, 0x99, 0x99, 0x99, 0x99, 0xdf, 0xff, 0xff,
-    0x99, 0x99, 0x99, 0x99, 0x82, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xde, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F068 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x17, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x82, 0x0,
-
-    /* U+F06E "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x89,
-    0xaa, 0x87, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xfd, 0x84, 0x23, 0x49, 0xef, 0xff, 0xff,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x5, 0xdd, 0x93,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0x80, 0x0, 0xcf, 0xff, 0xff, 0xf6, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xf6, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x30, 0x1f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x10, 0xf, 0xff, 0xff,
-    0xff, 0xc0, 0xaf, 0xff, 0xff, 0xff, 0x80, 0x5,
-    0x44, 0x9f, 0xff, 0xff, 0xff, 0x50, 0xc, 0xff,
-    0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xb,
-    0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff, 0xff, 0xff,
-    0x80, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xc, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff,
-    0xff, 0xa0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0xe, 0xff, 0xff, 0xff, 0xe1, 0x9, 0xff,
-    0xff, 0xff, 0xe0, 0x1, 0xef, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0xdf, 0xff, 0xff, 0xf5, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x9f, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xfd, 0x0, 0x3, 0xdf,
-    0xff, 0xfb, 0x10, 0x3, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x2, 0x55, 0x10, 0x0, 0x1e, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf8, 0x20, 0x0, 0x3, 0xaf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x7a, 0xde, 0xff, 0xec,
-    0x96, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F070 "" */
-    0x3, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x4, 0x79, 0xa9, 0x87, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xb1, 0x2, 0x8c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xfd, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x94, 0x23, 0x59,
-    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xe3, 0x6, 0xdc,
-    0x92, 0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x54, 0xff, 0xff, 0x60, 0x0, 0xef, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf5,
-    0x0, 0x6f, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x2f, 0xff, 0x90, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x20, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x30, 0xe,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0xd, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0x40, 0xe, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0x40,
-    0xf, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf6, 0x5f, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xe7, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
-    0xfe, 0xde, 0xc1, 0x0, 0x0, 0x2d, 0xff, 0xff,
-    0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x7b, 0xde, 0xff,
-    0xec, 0x80, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4a, 0x20,
-
-    /* U+F071 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf7, 0x11, 0x11,
-    0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xdc, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb5, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x81, 0x2a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x7c, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xc5, 0x0,
-
-    /* U+F074 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf6, 0x0, 0x8a, 0xaa, 0xaa, 0xa7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xaa, 0xdf,
-    0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xf5, 0x2, 0xef, 0xff,
-    0xff, 0x40, 0x8f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0x70, 0x1e, 0xff, 0xff, 0xf4,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xe8, 0x1, 0xdf, 0xff, 0xff, 0x50, 0x0,
-    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x1d, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x1a,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x90, 0x1a, 0x10, 0x0, 0x5f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfa, 0x0,
-    0xcf, 0xd1, 0x0, 0x7f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0xb, 0xff,
-    0xfc, 0x0, 0x8f, 0xff, 0xf6, 0x0, 0x8a, 0xaa,
-    0xab, 0xff, 0xff, 0xfb, 0x0, 0x5f, 0xff, 0xff,
-    0xca, 0xdf, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xef, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F077 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xde, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0xa6, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xfa, 0x0, 0x6f,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xa0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf3, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x30, 0x1d, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xf3, 0x9f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xfd, 0x6f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xfa, 0x8, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0,
-    0x0, 0x56, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x46, 0x0,
-
-    /* U+F078 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xde, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xce, 0x40, 0x1e, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf4, 0x9f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xf9, 0x7, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xa0, 0x0, 0x7f,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf3, 0x0, 0x1d,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x31, 0xdf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F079 "" */
-    0x0, 0x0, 0x0, 0x2a, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0xff, 0x90, 0x0, 0x5, 0xab, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xf9, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x3f, 0xff, 0xfe, 0xff, 0xfe, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x10, 0x0, 0x0, 0x8f, 0xff, 0xe4,
-    0xff, 0xf9, 0x9f, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0,
-    0x3f, 0xfe, 0x22, 0xff, 0xf9, 0xa, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x10, 0x0, 0x0, 0x3, 0x82, 0x2, 0xff, 0xf9,
-    0x0, 0x76, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x0, 0xaf, 0xff, 0x10,
-    0x2, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x40,
-    0xaf, 0xff, 0x10, 0xcf, 0xb0, 0x0, 0x0, 0x2,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf3, 0xaf, 0xff, 0x1c, 0xff, 0xf7,
-    0x0, 0x0, 0x2, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xdf, 0xff,
-    0xcf, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xff, 0xfe,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb5, 0x2, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x2, 0xef, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x2e, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F07B "" */
-    0x2, 0x68, 0x88, 0x88, 0x88, 0x88, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xca, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90,
-
-    /* U+F093 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xec, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x33,
-    0x33, 0x3e, 0xff, 0xff, 0xff, 0xa3, 0x33, 0x32,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x26, 0x77, 0x77, 0x77, 0x72,
-    0xe, 0xff, 0xff, 0xff, 0x90, 0x27, 0x77, 0x77,
-    0x77, 0x62, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0xb,
-    0xff, 0xff, 0xff, 0x60, 0x7f, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x45,
-    0x55, 0x53, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x8f, 0x60, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8f,
-    0x60, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x5a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xa5,
-
-    /* U+F095 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xc8, 0x51, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7d, 0xd1, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x5, 0xbf,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x5e, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x73, 0xbf, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfe, 0xb6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2a, 0xba, 0x98, 0x52, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F0A8 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0xac, 0xdd,
-    0xca, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xe, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf,
-    0xff, 0xff, 0xf3, 0x7f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xf5, 0x8f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xf6, 0x8f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf5,
-    0x6f, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x36, 0x66,
-    0x66, 0x66, 0x66, 0x6a, 0xff, 0xff, 0xf4, 0x4f,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x1f, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xc, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x33, 0xef, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x9d, 0xff, 0xff, 0xff, 0xd8, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x13, 0x33, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+F0C4 "" */
-    0x0, 0x2, 0x79, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8a, 0x83, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf9,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf2, 0xcf, 0xff,
-    0xa3, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf5, 0xf, 0xff, 0xe0, 0x0, 0xaf,
-    0xff, 0x20, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0xff, 0xfd, 0x0, 0x9, 0xff, 0xf3, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xf5, 0x0, 0xd, 0xff,
-    0xf5, 0x2, 0xff, 0xff, 0x10, 0x7, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff, 0xfe, 0xff,
-    0xff, 0xf2, 0x7, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe8,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7b, 0xde,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x27, 0x9b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0xb, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0xc, 0xff, 0xfa, 0x37, 0xff, 0xff, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0xff, 0xfe,
-    0x0, 0xa, 0xff, 0xf2, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xe2, 0x0, 0xf, 0xff, 0xd0, 0x0, 0x9f,
-    0xff, 0x30, 0x0, 0xb, 0xff, 0xff, 0xff, 0xe2,
-    0x0, 0xdf, 0xff, 0x50, 0x2f, 0xff, 0xf1, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xe2, 0x7, 0xff,
-    0xff, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xe1, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xfd, 0x10, 0x2d, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xce, 0xd8, 0x0, 0x0,
-    0x7, 0xbd, 0xc8, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0C5 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x8,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x8f, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x8, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x8f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x8, 0xff, 0xff,
-    0xd0, 0x16, 0x66, 0x64, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x59, 0x99, 0x99, 0xd, 0xff,
-    0xff, 0xa0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdd,
-    0xdd, 0x1f, 0xff, 0xff, 0xa0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff,
-    0xff, 0xfa, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xa0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xff, 0xff, 0xfa, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-    0xff, 0xff, 0xa0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xfa,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1f, 0xff, 0xff, 0xa0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0xff, 0xff, 0xfa, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff,
-    0xa0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0xff, 0xff, 0xfa, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xa0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xfa, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xa0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0xfa, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xa0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc, 0x1,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xe6, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb, 0x40, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+F0C7 "" */
-    0x3, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x96, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xff, 0xfe,
-    0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x7f,
-    0xff, 0xfd, 0x10, 0xf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfd,
-    0x10, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf4, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf6, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x9,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x0,
-
-    /* U+F0C9 "" */
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x24, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x20,
-
-    /* U+F0E0 "" */
-    0x0, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0xc3, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x5f, 0xff,
-    0x70, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x9, 0xff, 0xff, 0xfb,
-    0x10, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe3, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xe4,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x1a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x2d, 0xff, 0xff, 0xff, 0xd2, 0x3, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x9f, 0xff, 0xf9, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x3,
-    0x99, 0x30, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
-    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbb, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90,
-
-    /* U+F0E7 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xaa, 0xaa, 0xaa, 0x92, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x6, 0xcd, 0xdd, 0xdd, 0xdf, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F0EA "" */
-    0x0, 0x0, 0x0, 0x0, 0x13, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x15, 0x66, 0x66, 0xcf, 0xff,
-    0xff, 0xb6, 0x66, 0x65, 0x10, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xf8, 0x29, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x29, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x54, 0x44, 0x44, 0x44, 0x30, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfb, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0xe0, 0x8b, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x80, 0x6f, 0xff, 0xff, 0xff, 0xfe, 0x8, 0xfc,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x8f, 0xfc, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff,
-    0xfe, 0x8, 0xff, 0xfc, 0x0, 0xff, 0xff, 0xff,
-    0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x8f,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0x80, 0x7f,
-    0xff, 0xff, 0xff, 0xfe, 0x5, 0xaa, 0xaa, 0xa0,
-    0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x82,
-    0x22, 0x22, 0x20, 0xff, 0xff, 0xff, 0xf8, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1f, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-    0xff, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x80,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff,
-    0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xff, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x11, 0x55, 0x55, 0x55, 0x20, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0,
-
-    /* U+F0F3 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x29, 0xef, 0xff, 0xff, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xab, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+F11C "" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9,
-    0x30, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0x10, 0x1d,
-    0xf5, 0x0, 0x1f, 0xf2, 0x0, 0x4f, 0xe1, 0x1,
-    0xef, 0x40, 0x2, 0xff, 0xfc, 0xff, 0xfc, 0x0,
-    0xb, 0xf2, 0x0, 0xe, 0xf0, 0x0, 0x1f, 0xc0,
-    0x0, 0xcf, 0x10, 0x0, 0xff, 0xfc, 0xff, 0xfc,
-    0x0, 0xb, 0xf2, 0x0, 0xe, 0xf0, 0x0, 0x1f,
-    0xc0, 0x0, 0xcf, 0x10, 0x0, 0xff, 0xfc, 0xff,
-    0xfd, 0x0, 0xd, 0xf4, 0x0, 0x1f, 0xf2, 0x0,
-    0x3f, 0xe0, 0x0, 0xef, 0x30, 0x2, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xff, 0xfe,
-    0xef, 0xff, 0xee, 0xef, 0xff, 0xee, 0xef, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xdf,
-    0x20, 0x1, 0xff, 0x0, 0x6, 0xf6, 0x0, 0xd,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0xcf, 0x10, 0x0, 0xff, 0x0, 0x5, 0xf5, 0x0,
-    0xd, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0xcf, 0x10, 0x0, 0xff, 0x0, 0x5, 0xf5,
-    0x0, 0xd, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xb2, 0x23, 0xef, 0x52, 0x24, 0xff, 0x32, 0x29,
-    0xf9, 0x22, 0x3e, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xbb, 0xbf, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbc, 0xff, 0xdb, 0xbd, 0xff, 0xfc,
-    0xff, 0xfc, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0xff,
-    0xfc, 0xff, 0xfc, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0,
-    0xff, 0xfc, 0xff, 0xfc, 0x0, 0xb, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0xff, 0xfc, 0xff, 0xff, 0xcc, 0xcf, 0xfd,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff,
-    0xdc, 0xcd, 0xff, 0xfc, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-
-    /* U+F124 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x59, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xaa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F15B "" */
-    0x26, 0x77, 0x77, 0x77, 0x77, 0x77, 0x70, 0x6,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0xfc, 0x10, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf, 0xfc,
-    0x10, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0xff, 0xfc, 0x10, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xf, 0xff, 0xfc,
-    0x10, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0xff, 0xff, 0xfc, 0x10, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0xf, 0xff, 0xff, 0xfc,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x4a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xa9, 0x0,
-
-    /* U+F1EB "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x45, 0x65, 0x43, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x92,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1,
-    0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xb8, 0x65, 0x55, 0x67, 0x9c, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x50, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0xff, 0xd7, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xaf, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7f, 0xff,
-    0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xff, 0xf7, 0x6f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0xc1, 0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0x8b, 0xdf, 0xff, 0xec, 0x96, 0x10, 0x0, 0x0,
-    0x0, 0x1c, 0xfc, 0x10, 0x0, 0x43, 0x0, 0x0,
-    0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x61, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xff, 0xff, 0xec, 0xbc, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfc, 0x61,
-    0x0, 0x0, 0x0, 0x48, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xfd, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x98, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2a, 0xdc, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F240 "" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xb9, 0x30, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe4, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0xcd, 0xff, 0xfa,
-    0xff, 0xfc, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x1, 0xff, 0xfa, 0xff, 0xfc, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x1, 0xff, 0xfa, 0xff, 0xfc,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1, 0xff,
-    0xfa, 0xff, 0xfc, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x67, 0xff, 0xfa, 0xff, 0xfc, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xfa, 0xff,
-    0xfc, 0x3, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xfd, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F241 "" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xb9, 0x30, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe4, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0xcd, 0xff, 0xfa,
-    0xff, 0xfc, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0xff, 0xfc, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0xff, 0xfc,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfa, 0xff, 0xfc, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x67, 0xff, 0xfa, 0xff, 0xfc, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0xff,
-    0xfc, 0x1, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x40, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xfd, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F242 "" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xb9, 0x30, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe4, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xff, 0xfa,
-    0xff, 0xfc, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0xff, 0xfc, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0xff, 0xfc,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfa, 0xff, 0xfc, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x67, 0xff, 0xfa, 0xff, 0xfc, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0xff,
-    0xfc, 0x1, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xfd, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F243 "" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xb9, 0x30, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe4, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x6, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0x6,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xff, 0xfa,
-    0xff, 0xfc, 0x6, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0xff, 0xfc, 0x6, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0xff, 0xfc,
-    0x6, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfa, 0xff, 0xfc, 0x6, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x67, 0xff, 0xfa, 0xff, 0xfc, 0x6, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0xff,
-    0xfc, 0x3, 0x88, 0x88, 0x88, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xfd, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F244 "" */
-    0x5, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xb9, 0x30, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe4, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0xff, 0xfa,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x67, 0xff, 0xfa, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfa, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff, 0xfd, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+F287 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0xc5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xac, 0xcf,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xa5, 0x5e, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x3, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf3, 0x0, 0x0, 0x15, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x30,
-    0x0, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xdf, 0xff, 0x70, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x60, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0,
-    0x7, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xfc, 0x30, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0x32, 0x5f, 0xf7, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0xff, 0xf9,
-    0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xaf,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1c, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf7, 0x0, 0x2e, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfa, 0x10, 0x0, 0x2, 0xbf, 0xfc,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0xf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x60, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xef, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x33, 0x33, 0x30, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F293 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x9d, 0xff, 0xff, 0xfd, 0x93, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf9, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xf7, 0x2e, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xf7, 0x2, 0xef, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x3, 0xff, 0xff, 0xff, 0x80,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x1, 0x20,
-    0x4f, 0xff, 0xff, 0xd0, 0x6, 0xff, 0xff, 0xa7,
-    0xff, 0xf7, 0x2, 0xe2, 0x5, 0xff, 0xff, 0xf0,
-    0xa, 0xff, 0xfc, 0x0, 0x6f, 0xf7, 0x1, 0xfe,
-    0x20, 0x5f, 0xff, 0xf3, 0xc, 0xff, 0xff, 0x70,
-    0x6, 0xf7, 0x1, 0xfc, 0x0, 0x8f, 0xff, 0xf6,
-    0xe, 0xff, 0xff, 0xf7, 0x0, 0x67, 0x1, 0xc0,
-    0x7, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xf9, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfa,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xf9,
-    0xf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf9, 0xe, 0xff, 0xff, 0xf8,
-    0x0, 0x47, 0x1, 0xa0, 0x6, 0xff, 0xff, 0xf7,
-    0xc, 0xff, 0xff, 0x80, 0x4, 0xf7, 0x1, 0xfa,
-    0x0, 0x7f, 0xff, 0xf6, 0xa, 0xff, 0xfc, 0x0,
-    0x4f, 0xf8, 0x1, 0xfe, 0x20, 0x2e, 0xff, 0xf4,
-    0x7, 0xff, 0xff, 0x95, 0xff, 0xf8, 0x2, 0xe3,
-    0x2, 0xef, 0xff, 0xf1, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x1, 0x30, 0x2e, 0xff, 0xff, 0xd0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0x80, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x2e, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xf9, 0x3, 0xef,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf9, 0x3e, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xfc, 0xef, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x58, 0xbc, 0xdd, 0xca,
-    0x61, 0x0, 0x0, 0x0,
-
-    /* U+F2ED "" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x77, 0x77, 0x77,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x69, 0x99, 0x99, 0x99, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa9, 0x99, 0x99, 0x98,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xcc, 0xcc, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x40, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x2, 0xff, 0xff, 0xb0, 0xbf, 0xff,
-    0x62, 0xff, 0xfe, 0x18, 0xff, 0xff, 0x60, 0x0,
-    0x2f, 0xff, 0xf9, 0x9, 0xff, 0xf3, 0xf, 0xff,
-    0xd0, 0x5f, 0xff, 0xf6, 0x0, 0x2, 0xff, 0xff,
-    0x90, 0x9f, 0xff, 0x30, 0xff, 0xfd, 0x5, 0xff,
-    0xff, 0x60, 0x0, 0x2f, 0xff, 0xf9, 0x9, 0xff,
-    0xf3, 0xf, 0xff, 0xd0, 0x5f, 0xff, 0xf6, 0x0,
-    0x2, 0xff, 0xff, 0x90, 0x9f, 0xff, 0x30, 0xff,
-    0xfd, 0x5, 0xff, 0xff, 0x60, 0x0, 0x2f, 0xff,
-    0xf9, 0x9, 0xff, 0xf3, 0xf, 0xff, 0xd0, 0x5f,
-    0xff, 0xf6, 0x0, 0x2, 0xff, 0xff, 0x90, 0x9f,
-    0xff, 0x30, 0xff, 0xfd, 0x5, 0xff, 0xff, 0x60,
-    0x0, 0x2f, 0xff, 0xf9, 0x9, 0xff, 0xf3, 0xf,
-    0xff, 0xd0, 0x5f, 0xff, 0xf6, 0x0, 0x2, 0xff,
-    0xff, 0x90, 0x9f, 0xff, 0x30, 0xff, 0xfd, 0x5,
-    0xff, 0xff, 0x60, 0x0, 0x2f, 0xff, 0xf9, 0x9,
-    0xff, 0xf3, 0xf, 0xff, 0xd0, 0x5f, 0xff, 0xf6,
-    0x0, 0x2, 0xff, 0xff, 0x90, 0x9f, 0xff, 0x30,
-    0xff, 0xfd, 0x5, 0xff, 0xff, 0x60, 0x0, 0x2f,
-    0xff, 0xf9, 0x9, 0xff, 0xf3, 0xf, 0xff, 0xd0,
-    0x5f, 0xff, 0xf6, 0x0, 0x2, 0xff, 0xff, 0x90,
-    0x9f, 0xff, 0x30, 0xff, 0xfd, 0x5, 0xff, 0xff,
-    0x60, 0x0, 0x2f, 0xff, 0xf9, 0x9, 0xff, 0xf3,
-    0xf, 0xff, 0xd0, 0x5f, 0xff, 0xf6, 0x0, 0x2,
-    0xff, 0xff, 0xb0, 0xbf, 0xff, 0x62, 0xff, 0xfe,
-    0x18, 0xff, 0xff, 0x60, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x7, 0xbc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcb,
-    0x81, 0x0, 0x0,
-
-    /* U+F304 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x50, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x2e,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x2e,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x50, 0x2e,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x50, 0x2e,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x2e,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xba, 0x86, 0x43, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+F30A "" */
-    0x0, 0x0, 0x5, 0xb3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa9, 0x16, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0xc, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+F359 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xac, 0xde,
-    0xdb, 0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xd1, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0xf, 0xff, 0xff,
-    0xff, 0xfd, 0x10, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf9, 0x4f, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfb, 0x4f, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xfb, 0x4f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb,
-    0x2f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf9, 0xf,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xb, 0xee,
-    0xee, 0xee, 0xff, 0xff, 0xff, 0xf7, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x49, 0xdf, 0xff, 0xfe, 0xb7, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+F518 "" */
-    0x4, 0x54, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x45,
-    0x40, 0xaf, 0xff, 0xff, 0xec, 0x95, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x69, 0xcf, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x71, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa2, 0x0, 0x3b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
-    0x0, 0x12, 0x45, 0x7a, 0xdf, 0xff, 0xff, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xfc, 0xa7, 0x53, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xef,
-    0xff, 0x1, 0xff, 0xfd, 0x84, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xb9, 0x0, 0xba, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+F55A "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0x78, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x87, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x4e, 0xff, 0xff, 0xfe, 0x48, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x3, 0xef, 0xff, 0xe3, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3e,
-    0xfe, 0x30, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x3, 0xd3, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xf8, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x50, 0x0, 0x3,
-    0xef, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x2e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x9,
-    0xf9, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x9f, 0xff, 0x90, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd1, 0x9, 0xff, 0xff, 0xf9,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xcf,
-    0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe9, 0x0,
-
-    /* U+F7C2 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x3,
-    0xff, 0xdb, 0xbf, 0xfb, 0xbb, 0xff, 0xbb, 0xbf,
-    0xff, 0xa0, 0x3, 0xff, 0xf9, 0x0, 0xcf, 0x10,
-    0xf, 0xf0, 0x1, 0xff, 0xfa, 0x3, 0xff, 0xff,
-    0x90, 0xc, 0xf1, 0x0, 0xff, 0x0, 0x1f, 0xff,
-    0xa4, 0xff, 0xff, 0xf9, 0x0, 0xcf, 0x10, 0xf,
-    0xf0, 0x1, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x90,
-    0xc, 0xf1, 0x0, 0xff, 0x0, 0x1f, 0xff, 0xaf,
-    0xff, 0xff, 0xf9, 0x0, 0xcf, 0x10, 0xf, 0xf0,
-    0x1, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa9, 0x40, 0x0,
-
-    /* U+F8A2 "" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x1b, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x2d, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf1, 0x0, 0x0, 0x2e,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x10, 0x0, 0x3e, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf1, 0x0, 0x4f, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x10, 0x5f, 0xff, 0xff, 0xff,
-    0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xef, 0xff, 0xf1, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x7f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 129, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 129, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 42, .adv_w = 188, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 83, .adv_w = 337, .box_w = 21, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 304, .adv_w = 298, .box_w = 17, .box_h = 29, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 551, .adv_w = 405, .box_w = 24, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 803, .adv_w = 329, .box_w = 20, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1023, .adv_w = 101, .box_w = 4, .box_h = 9, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 1041, .adv_w = 162, .box_w = 8, .box_h = 28, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 1153, .adv_w = 162, .box_w = 8, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 1265, .adv_w = 192, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 1337, .adv_w = 279, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 1435, .adv_w = 109, .box_w = 5, .box_h = 10, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1460, .adv_w = 184, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 1474, .adv_w = 109, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1487, .adv_w = 169, .box_w = 13, .box_h = 28, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 1669, .adv_w = 320, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1858, .adv_w = 178, .box_w = 8, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1942, .adv_w = 276, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2121, .adv_w = 275, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2289, .adv_w = 321, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2489, .adv_w = 276, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2668, .adv_w = 296, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2847, .adv_w = 287, .box_w = 17, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3026, .adv_w = 309, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3205, .adv_w = 296, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3394, .adv_w = 109, .box_w = 5, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3434, .adv_w = 109, .box_w = 5, .box_h = 21, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3487, .adv_w = 279, .box_w = 14, .box_h = 15, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 3592, .adv_w = 279, .box_w = 14, .box_h = 10, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 3662, .adv_w = 279, .box_w = 14, .box_h = 15, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 3767, .adv_w = 275, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3935, .adv_w = 496, .box_w = 29, .box_h = 27, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 4327, .adv_w = 351, .box_w = 23, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 4569, .adv_w = 363, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 4769, .adv_w = 347, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4979, .adv_w = 396, .box_w = 21, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5200, .adv_w = 322, .box_w = 16, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5368, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5526, .adv_w = 371, .box_w = 20, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5736, .adv_w = 390, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5936, .adv_w = 149, .box_w = 4, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 5978, .adv_w = 246, .box_w = 14, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6125, .adv_w = 345, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6325, .adv_w = 285, .box_w = 15, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6483, .adv_w = 458, .box_w = 23, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6725, .adv_w = 390, .box_w = 19, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6925, .adv_w = 403, .box_w = 23, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7167, .adv_w = 347, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7356, .adv_w = 403, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 7656, .adv_w = 349, .box_w = 18, .box_h = 21, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7845, .adv_w = 298, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8024, .adv_w = 282, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8213, .adv_w = 380, .box_w = 19, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8413, .adv_w = 342, .box_w = 23, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8655, .adv_w = 540, .box_w = 33, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9002, .adv_w = 323, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9212, .adv_w = 311, .box_w = 21, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 9433, .adv_w = 315, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9622, .adv_w = 160, .box_w = 7, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 9720, .adv_w = 169, .box_w = 14, .box_h = 28, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 9916, .adv_w = 160, .box_w = 7, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 10014, .adv_w = 280, .box_w = 14, .box_h = 13, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 10105, .adv_w = 240, .box_w = 15, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 10120, .adv_w = 288, .box_w = 9, .box_h = 4, .ofs_x = 3, .ofs_y = 18},
-    {.bitmap_index = 10138, .adv_w = 287, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10258, .adv_w = 327, .box_w = 18, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10456, .adv_w = 274, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10584, .adv_w = 327, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10771, .adv_w = 294, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10907, .adv_w = 169, .box_w = 12, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11039, .adv_w = 331, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 11226, .adv_w = 327, .box_w = 16, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11402, .adv_w = 134, .box_w = 5, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11457, .adv_w = 136, .box_w = 10, .box_h = 28, .ofs_x = -3, .ofs_y = -6},
-    {.bitmap_index = 11597, .adv_w = 296, .box_w = 17, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11784, .adv_w = 134, .box_w = 4, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11828, .adv_w = 507, .box_w = 28, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12052, .adv_w = 327, .box_w = 16, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12180, .adv_w = 305, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12316, .adv_w = 327, .box_w = 18, .box_h = 22, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 12514, .adv_w = 327, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 12701, .adv_w = 197, .box_w = 10, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 12781, .adv_w = 240, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12901, .adv_w = 199, .box_w = 12, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13021, .adv_w = 325, .box_w = 16, .box_h = 16, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13149, .adv_w = 268, .box_w = 18, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 13293, .adv_w = 432, .box_w = 27, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13509, .adv_w = 265, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13645, .adv_w = 268, .box_w = 18, .box_h = 22, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 13843, .adv_w = 250, .box_w = 14, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13955, .adv_w = 168, .box_w = 9, .box_h = 28, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 14081, .adv_w = 144, .box_w = 3, .box_h = 28, .ofs_x = 3, .ofs_y = -6},
-    {.bitmap_index = 14123, .adv_w = 168, .box_w = 9, .box_h = 28, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 14249, .adv_w = 279, .box_w = 15, .box_h = 6, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 14294, .adv_w = 129, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 14294, .adv_w = 201, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 11},
-    {.bitmap_index = 14349, .adv_w = 403, .box_w = 23, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14660, .adv_w = 305, .box_w = 17, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14847, .adv_w = 351, .box_w = 24, .box_h = 28, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 15183, .adv_w = 287, .box_w = 15, .box_h = 23, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 15356, .adv_w = 347, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15626, .adv_w = 274, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15802, .adv_w = 322, .box_w = 17, .box_h = 28, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 16040, .adv_w = 294, .box_w = 17, .box_h = 23, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 16236, .adv_w = 288, .box_w = 18, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16425, .adv_w = 141, .box_w = 11, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 16546, .adv_w = 390, .box_w = 19, .box_h = 27, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16803, .adv_w = 327, .box_w = 16, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16979, .adv_w = 298, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17209, .adv_w = 240, .box_w = 15, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17374, .adv_w = 315, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17617, .adv_w = 250, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17771, .adv_w = 315, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18014, .adv_w = 250, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18168, .adv_w = 184, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 18182, .adv_w = 240, .box_w = 15, .box_h = 3, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 18205, .adv_w = 480, .box_w = 30, .box_h = 3, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 18250, .adv_w = 200, .box_w = 11, .box_h = 9, .ofs_x = 1, .ofs_y = 13},
-    {.bitmap_index = 18300, .adv_w = 200, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 18355, .adv_w = 151, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 18376, .adv_w = 332, .box_w = 19, .box_h = 5, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18424, .adv_w = 480, .box_w = 31, .box_h = 31, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 18905, .adv_w = 480, .box_w = 30, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19250, .adv_w = 480, .box_w = 30, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 19655, .adv_w = 480, .box_w = 30, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20000, .adv_w = 330, .box_w = 21, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20231, .adv_w = 480, .box_w = 30, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 20696, .adv_w = 480, .box_w = 30, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 21161, .adv_w = 540, .box_w = 34, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 21620, .adv_w = 480, .box_w = 30, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 22085, .adv_w = 540, .box_w = 34, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22476, .adv_w = 480, .box_w = 30, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 22941, .adv_w = 240, .box_w = 15, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 23121, .adv_w = 360, .box_w = 23, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 23397, .adv_w = 540, .box_w = 34, .box_h = 29, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 23890, .adv_w = 420, .box_w = 27, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 24309, .adv_w = 420, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 24674, .adv_w = 480, .box_w = 30, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25019, .adv_w = 330, .box_w = 21, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 25345, .adv_w = 420, .box_w = 20, .box_h = 28, .ofs_x = 3, .ofs_y = -3},
-    {.bitmap_index = 25625, .adv_w = 420, .box_w = 27, .box_h = 32, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 26057, .adv_w = 420, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 26422, .adv_w = 420, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 26787, .adv_w = 420, .box_w = 20, .box_h = 28, .ofs_x = 3, .ofs_y = -3},
-    {.bitmap_index = 27067, .adv_w = 420, .box_w = 28, .box_h = 27, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 27445, .adv_w = 300, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 27675, .adv_w = 300, .box_w = 17, .box_h = 27, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 27905, .adv_w = 420, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28270, .adv_w = 420, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 28635, .adv_w = 420, .box_w = 27, .box_h = 7, .ofs_x = 0, .ofs_y = 8},
-    {.bitmap_index = 28730, .adv_w = 540, .box_w = 34, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 29121, .adv_w = 600, .box_w = 38, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 29710, .adv_w = 540, .box_w = 36, .box_h = 31, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 30268, .adv_w = 480, .box_w = 30, .box_h = 28, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 30688, .adv_w = 420, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 30909, .adv_w = 420, .box_w = 26, .box_h = 17, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 31130, .adv_w = 600, .box_w = 38, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 31586, .adv_w = 480, .box_w = 30, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31931, .adv_w = 480, .box_w = 30, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 32396, .adv_w = 480, .box_w = 31, .box_h = 31, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 32877, .adv_w = 480, .box_w = 30, .box_h = 30, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 33327, .adv_w = 420, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 33692, .adv_w = 420, .box_w = 27, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 34111, .adv_w = 420, .box_w = 27, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 34476, .adv_w = 420, .box_w = 27, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 34800, .adv_w = 480, .box_w = 30, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 35145, .adv_w = 300, .box_w = 20, .box_h = 31, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 35455, .adv_w = 420, .box_w = 27, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 35874, .adv_w = 420, .box_w = 27, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 36293, .adv_w = 540, .box_w = 34, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 36684, .adv_w = 480, .box_w = 32, .box_h = 31, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 37180, .adv_w = 360, .box_w = 23, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 37537, .adv_w = 600, .box_w = 38, .box_h = 28, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 38069, .adv_w = 600, .box_w = 38, .box_h = 20, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 38449, .adv_w = 600, .box_w = 38, .box_h = 20, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 38829, .adv_w = 600, .box_w = 38, .box_h = 20, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 39209, .adv_w = 600, .box_w = 38, .box_h = 20, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 39589, .adv_w = 600, .box_w = 38, .box_h = 20, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 39969, .adv_w = 600, .box_w = 38, .box_h = 24, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 40425, .adv_w = 420, .box_w = 24, .box_h = 31, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 40797, .adv_w = 420, .box_w = 27, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 41216, .adv_w = 480, .box_w = 31, .box_h = 31, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 41697, .adv_w = 420, .box_w = 27, .box_h = 14, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 41886, .adv_w = 480, .box_w = 30, .box_h = 30, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 42336, .adv_w = 540, .box_w = 34, .box_h = 27, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 42795, .adv_w = 600, .box_w = 38, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 43232, .adv_w = 360, .box_w = 23, .box_h = 31, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 43589, .adv_w = 483, .box_w = 31, .box_h = 20, .ofs_x = 0, .ofs_y = 1}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x10, 0x33, 0x53, 0x64, 0x65, 0x66, 0x67,
-    0x78, 0x79, 0xa1, 0xa2, 0xa3, 0xa4, 0xba, 0xbb,
-    0xd9, 0xda, 0xdb, 0xdc, 0x1f70, 0x1f73, 0x1f74, 0x1f7d,
-    0x1f7e, 0x1f82, 0x1f86, 0xef61, 0xef68, 0xef6b, 0xef6c, 0xef6d,
-    0xef71, 0xef73, 0xef75, 0xef79, 0xef7c, 0xef81, 0xef86, 0xef87,
-    0xef88, 0xef8d, 0xef99, 0xef9e, 0xefa3, 0xefa8, 0xefab, 0xefac,
-    0xefad, 0xefb1, 0xefb2, 0xefb3, 0xefb4, 0xefc0, 0xefc7, 0xefc8,
-    0xefce, 0xefd0, 0xefd1, 0xefd4, 0xefd7, 0xefd8, 0xefd9, 0xefdb,
-    0xeff3, 0xeff5, 0xf008, 0xf024, 0xf025, 0xf027, 0xf029, 0xf040,
-    0xf047, 0xf04a, 0xf053, 0xf07c, 0xf084, 0xf0bb, 0xf14b, 0xf1a0,
-    0xf1a1, 0xf1a2, 0xf1a3, 0xf1a4, 0xf1e7, 0xf1f3, 0xf24d, 0xf264,
-    0xf26a, 0xf2b9, 0xf478, 0xf4ba, 0xf722, 0xf802
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 160, .range_length = 63491, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 94, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LVGL_VERSION_MAJOR >= 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = NULL,
-    .kern_scale = 0,
-    .cmap_num = 2,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR >= 8
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
-const lv_font_t gui_montserrat_medium_30 = {
-#else
-lv_font_t gui_montserrat_medium_30 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 34,          /*The maximum line height required by the font*/
-    .base_line = 7,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -3,
-    .underline_thickness = 2,
-#endif
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-    .fallback = NULL,
-    .user_data = NULL
-};
-
-
-
-#endif /*#if GUI_MONTSERRAT_MEDIUM_30*/
-
@@ -0,0 +1,133 @@
+/* Host benchmark of AdvanceCache, counts font queries and time per page of text measured the way TextLayout
+ * does, once directly through the font and once through the cache. Not a part of the firmware, build and run
+ * on the host with:
+ *
+ *   L=../../../third_party/lvgl
+ *   cc -O2 -DLV_CONF_SKIP -DLV_LVGL_H_INCLUDE_SIMPLE -I$L -c ../gui_montserrat_medium_28.c $L/src/font/lv_font.c $L/src/font/lv_font_fmt_txt.c $L/src/misc/lv_utils.c
+ *   c++ -std=gnu++20 -O2 -DLV_CONF_SKIP -Wno-deprecated-enum-enum-conversion -I.. -I$L -o advance_cache_bench \
+ *       advance_cache_bench.cpp ../AdvanceCache.cpp *.o && ./advance_cache_bench
+ *
+ * Each letter of a page is measured with the next one twice, when the page is laid out and when its letters
+ * are placed for drawing. A built-in face stands for the reading fonts, on the device each query also goes
+ * through the synthetic style and the fallback faces, so the direct lookups cost more there. */
+
+#include "AdvanceCache.hpp"
+#include <lvgl.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+extern "C" const lv_font_t gui_montserrat_medium_28;
+
+namespace
+{
+    constexpr auto pagesCount = 200;
+    constexpr auto pageLetters = 1400; // About 30 lines of 45 letters
+    constexpr auto seed = 12345U;
+
+    /* Mostly Latin words, some of them Polish, Cyrillic and with typographic punctuation kept in the hash table */
+    const std::vector<std::u32string> words = {
+        U"the", U"of", U"and", U"a", U"to", U"in", U"was", U"he", U"that", U"it", U"his", U"her", U"with",
+        U"as", U"had", U"for", U"you", U"not", U"be", U"at", U"on", U"which", U"from", U"said", U"by",
+        U"Voyage", U"Tawny", U"AVATAR", U"evening", U"window", U"remembered", U"nothing", U"whispered",
+        U"znaleźć", U"łódź", U"gęś", U"żółw", U"Дом", U"книга", U"время", U"“Yes,”", U"well—",
+        U"it’s", U"…"
+    };
+
+    struct Counter
+    {
+        lv_font_t font;
+        bool (*getGlyphDsc)(const lv_font_t *, lv_font_glyph_dsc_t *, std::uint32_t, std::uint32_t);
+        std::uint64_t queries;
+    } counter;
+
+    /* Counts every query reaching the font and forwards it */
+    auto countingGetGlyphDsc(const lv_font_t *font, lv_font_glyph_dsc_t *dsc, std::uint32_t letter, std::uint32_t letterNext) -> bool
+    {
+        counter.queries++;
+        return counter.getGlyphDsc(font, dsc, letter, letterNext);
+    }
+
+    auto makePage(std::mt19937 &random) -> std::u32string
+    {
+        std::u32string page;
+        std::uniform_int_distribution<std::size_t> wordIndex{0, words.size() - 1};
+        while (page.size() < pageLetters) {
+            page += words[wordIndex(random)];
+            page += U' ';
+        }
+        return page;
+    }
+
+    template<typename GetWidth>
+    auto measurePage(const std::u32string &page, GetWidth getWidth) -> std::int64_t
+    {
+        std::int64_t width = 0;
+        for (auto pass = 0; pass < 2; ++pass) {
+            for (std::size_t i = 0; i < page.size(); ++i) {
+                const auto letterNext = (i + 1 < page.size()) ? page[i + 1] : 0;
+                width += getWidth(page[i], letterNext);
+            }
+        }
+        return width;
+    }
+
+    struct Result
+    {
+        std::uint64_t firstPageQueries;
+        std::uint64_t queries;
+        double microseconds;
+        std::int64_t width;
+    };
+
+    template<typename GetWidth>
+    auto run(const std::vector<std::u32string> &pages, GetWidth getWidth) -> Result
+    {
+        Result result{0, 0, 0.0, 0};
+        counter.queries = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < pages.size(); ++i) {
+            result.width += measurePage(pages[i], getWidth);
+            if (i == 0) {
+                result.firstPageQueries = counter.queries;
+            }
+        }
+        result.microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        result.queries = counter.queries;
+        return result;
+    }
+}
+
+int main()
+{
+    counter.font = gui_montserrat_medium_28;
+    counter.getGlyphDsc = counter.font.get_glyph_dsc;
+    counter.font.get_glyph_dsc = countingGetGlyphDsc;
+
+    std::mt19937 random{seed};
+    std::vector<std::u32string> pages;
+    for (auto i = 0; i < pagesCount; ++i) {
+        pages.push_back(makePage(random));
+    }
+
+    const auto direct = run(pages, [](std::uint32_t letter, std::uint32_t letterNext) {
+        return lv_font_get_glyph_width(&counter.font, letter, letterNext);
+    });
+    gui::AdvanceCache cache{&counter.font};
+    const auto cached = run(pages, [&cache](std::uint32_t letter, std::uint32_t letterNext) {
+        return cache.getWidth(letter, letterNext);
+    });
+
+    const auto statistics = cache.getStatistics();
+    std::printf("%d pages of %d letters, each letter measured twice\n", pagesCount, pageLetters);
+    std::printf("%-8s %14s %16s %14s\n", "", "queries/page", "first page", "us/page");
+    std::printf("%-8s %14.1f %16llu %14.2f\n", "direct", static_cast<double>(direct.queries) / pagesCount,
+                static_cast<unsigned long long>(direct.firstPageQueries), direct.microseconds / pagesCount);
+    std::printf("%-8s %14.1f %16llu %14.2f\n", "cached", static_cast<double>(cached.queries - cached.firstPageQueries) / (pagesCount - 1),
+                static_cast<unsigned long long>(cached.firstPageQueries), cached.microseconds / pagesCount);
+    std::printf("cache: %u hits, %u misses, %zu bytes, widths %s\n", statistics.hits, statistics.misses, statistics.size,
+                (direct.width == cached.width) ? "match" : "DIFFER");
+    return (direct.width == cached.width) ? 0 : 1;
+}
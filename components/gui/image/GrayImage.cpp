@@ -0,0 +1,56 @@
+#include "GrayImage.hpp"
+#include <eink_worker.h>
+
+namespace gui
+{
+    static_assert(GrayImage::levelsCount == EINK_WORKER_GRAY_LEVELS);
+
+    GrayImage::GrayImage(std::uint16_t width, std::uint16_t height) : data(paletteSize + getStride(width) * height, 0), descriptor{}
+    {
+        auto palette = reinterpret_cast<lv_color32_t *>(data.data());
+        for (auto level = 0; level < levelsCount; ++level) {
+            palette[level].full = lv_color_to32(eink_worker_gray_color(level));
+        }
+
+        descriptor.header.cf = LV_IMG_CF_INDEXED_4BIT;
+        descriptor.header.w = width;
+        descriptor.header.h = height;
+        descriptor.data_size = data.size();
+        descriptor.data = data.data();
+    }
+
+    auto GrayImage::getWidth() const -> std::uint16_t
+    {
+        return descriptor.header.w;
+    }
+
+    auto GrayImage::getHeight() const -> std::uint16_t
+    {
+        return descriptor.header.h;
+    }
+
+    auto GrayImage::getRow(std::uint16_t y) -> std::uint8_t *
+    {
+        return getPixels() + (getStride(getWidth()) * y);
+    }
+
+    auto GrayImage::getPixels() -> std::uint8_t *
+    {
+        return data.data() + paletteSize;
+    }
+
+    auto GrayImage::getPixelsSize() const -> std::size_t
+    {
+        return data.size() - paletteSize;
+    }
+
+    auto GrayImage::getDescriptor() const -> const lv_img_dsc_t *
+    {
+        return &descriptor;
+    }
+
+    auto GrayImage::getStride(std::uint16_t width) -> std::size_t
+    {
+        return (width + 1) / 2;
+    }
+}
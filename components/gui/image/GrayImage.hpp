@@ -0,0 +1,38 @@
+#pragma once
+
+#include <lvgl.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace gui
+{
+    /* Greyscale picture stored as LVGL indexed 4bpp image - palette with the colors the display
+     * shows as its gray levels, followed by rows of pixels, two per byte with the left one in the
+     * high nibble. Drawn only with the display in grayscale mode. */
+    class GrayImage
+    {
+        public:
+            static constexpr auto levelsCount = 16;
+
+            GrayImage(std::uint16_t width, std::uint16_t height);
+
+            GrayImage(const GrayImage &) = delete;
+            auto operator=(const GrayImage &) -> GrayImage & = delete;
+
+            [[nodiscard]] auto getWidth() const -> std::uint16_t;
+            [[nodiscard]] auto getHeight() const -> std::uint16_t;
+            [[nodiscard]] auto getRow(std::uint16_t y) -> std::uint8_t *;
+            [[nodiscard]] auto getPixels() -> std::uint8_t *;
+            [[nodiscard]] auto getPixelsSize() const -> std::size_t;
+            [[nodiscard]] auto getDescriptor() const -> const lv_img_dsc_t *;
+
+            [[nodiscard]] static auto getStride(std::uint16_t width) -> std::size_t;
+
+        private:
+            static constexpr auto paletteSize = levelsCount * sizeof(lv_color32_t);
+
+            std::vector<std::uint8_t> data;
+            lv_img_dsc_t descriptor;
+    };
+}
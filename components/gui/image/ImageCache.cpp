@@ -0,0 +1,200 @@
+#include "ImageCache.hpp"
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <sys/stat.h>
+#include <cstdio>
+#include <cerrno>
+#include <mutex>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        constexpr auto cacheDirectorySuffix = ".images";
+        constexpr auto cacheFileExtension = ".gray";
+        constexpr auto cacheFileMagic = std::uint32_t{0x59415247}; // "GRAY"
+        constexpr auto cacheFileVersion = std::uint32_t{1};
+
+        struct CacheFileHeader
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t bookSize;
+            std::uint16_t maxWidth;
+            std::uint16_t maxHeight;
+            std::uint16_t width;
+            std::uint16_t height;
+            std::uint16_t pathLength; // Path of the picture follows the header, file names are only hashes of it
+        };
+
+        std::mutex writeMutex; // The same picture can be decoded by both tasks at once
+
+        auto getCacheDirectory(const std::filesystem::path &bookPath) -> std::filesystem::path
+        {
+            /* Hidden directory next to the book, files list does not show it */
+            return bookPath.parent_path() / ("." + bookPath.filename().string() + cacheDirectorySuffix);
+        }
+
+        auto getCachePath(const std::filesystem::path &bookPath, const std::string &imagePath) -> std::filesystem::path
+        {
+            /* FNV-1a of the path in the archive */
+            std::uint32_t hash = 2166136261;
+            for (const auto c : imagePath) {
+                hash ^= static_cast<std::uint8_t>(c);
+                hash *= 16777619;
+            }
+
+            char filename[16];
+            std::snprintf(filename, sizeof(filename), "%08lx%s", static_cast<unsigned long>(hash), cacheFileExtension);
+            return getCacheDirectory(bookPath) / filename;
+        }
+
+        auto getFileSize(const std::filesystem::path &path) -> std::uint32_t
+        {
+            struct stat fileStat;
+            if (stat(path.c_str(), &fileStat) != 0) {
+                return 0;
+            }
+            return fileStat.st_size;
+        }
+
+        /* Returns the file positioned at pixels if it holds the picture decoded for given size */
+        auto openCacheFile(const std::filesystem::path &cachePath, const std::string &imagePath, const ImageSize &maxSize, std::uint32_t bookSize, CacheFileHeader &header) -> std::FILE *
+        {
+            auto file = std::fopen(cachePath.c_str(), "rb");
+            if (file == nullptr) {
+                return nullptr;
+            }
+
+            const auto headerValid = (std::fread(&header, sizeof(header), 1, file) == 1) && (header.magic == cacheFileMagic) &&
+                                     (header.version == cacheFileVersion) && (header.bookSize == bookSize) &&
+                                     (header.maxWidth == maxSize.width) && (header.maxHeight == maxSize.height) && (header.pathLength == imagePath.size());
+            std::string path(headerValid ? header.pathLength : 0, '\0');
+            if (!headerValid || (std::fread(path.data(), 1, path.size(), file) != path.size()) || (path != imagePath)) {
+                std::fclose(file);
+                return nullptr;
+            }
+            return file;
+        }
+
+        auto saveCacheFile(const std::filesystem::path &cachePath, const CacheFileHeader &header, const std::string &imagePath, GrayImage &image) -> bool
+        {
+            std::lock_guard lock{writeMutex};
+
+            const auto directory = cachePath.parent_path();
+            if ((mkdir(directory.c_str(), 0777) != 0) && (errno != EEXIST)) {
+                return false;
+            }
+
+            /* Write to temporary file first, so that power loss never leaves half-written picture */
+            auto tempPath = cachePath;
+            tempPath += ".tmp";
+            auto file = std::fopen(tempPath.c_str(), "wb");
+            if (file == nullptr) {
+                return false;
+            }
+
+            const auto written = (std::fwrite(&header, sizeof(header), 1, file) == 1) &&
+                                 (std::fwrite(imagePath.data(), 1, imagePath.size(), file) == imagePath.size()) &&
+                                 (std::fwrite(image.getPixels(), 1, image.getPixelsSize(), file) == image.getPixelsSize());
+            std::fclose(file);
+            if (!written) {
+                std::remove(tempPath.c_str());
+                return false;
+            }
+
+            /* FAT can't rename over existing file */
+            std::remove(cachePath.c_str());
+            return std::rename(tempPath.c_str(), cachePath.c_str()) == 0;
+        }
+
+        auto decodeImage(const Epub &epub, const std::string &imagePath, const ImageSize &maxSize) -> std::unique_ptr<GrayImage>
+        {
+            auto stream = epub.openEntryStream(imagePath);
+            if (stream == nullptr) {
+                return nullptr;
+            }
+
+            ImageDecoder decoder{[&stream](std::uint8_t *buffer, std::size_t size) {
+                return stream->read(reinterpret_cast<char *>(buffer), size);
+            }};
+            return decoder.decode(maxSize);
+        }
+    }
+
+    auto imageCacheGetSize(const Epub &epub, const std::string &imagePath, const ImageSize &maxSize) -> std::optional<ImageSize>
+    {
+        if (imagePath.empty()) {
+            return std::nullopt;
+        }
+
+        CacheFileHeader header;
+        const auto cachePath = getCachePath(epub.getPath(), imagePath);
+        auto file = openCacheFile(cachePath, imagePath, maxSize, getFileSize(epub.getPath()), header);
+        if (file != nullptr) {
+            std::fclose(file);
+            return ImageSize{header.width, header.height};
+        }
+
+        /* Not decoded yet, only the header of the picture is read */
+        auto stream = epub.openEntryStream(imagePath);
+        if (stream == nullptr) {
+            return std::nullopt;
+        }
+        ImageDecoder decoder{[&stream](std::uint8_t *buffer, std::size_t size) {
+            return stream->read(reinterpret_cast<char *>(buffer), size);
+        }};
+        const auto size = decoder.getSize();
+        if (!size.has_value()) {
+            return std::nullopt;
+        }
+        return ImageDecoder::fitSize(*size, maxSize);
+    }
+
+    auto imageCacheLoad(const Epub &epub, const std::string &imagePath, const ImageSize &maxSize) -> std::unique_ptr<GrayImage>
+    {
+        if (imagePath.empty()) {
+            return nullptr;
+        }
+
+        CacheFileHeader header;
+        const auto bookSize = getFileSize(epub.getPath());
+        const auto cachePath = getCachePath(epub.getPath(), imagePath);
+        auto file = openCacheFile(cachePath, imagePath, maxSize, bookSize, header);
+        if (file != nullptr) {
+            auto image = std::make_unique<GrayImage>(header.width, header.height);
+            const auto isRead = std::fread(image->getPixels(), 1, image->getPixelsSize(), file) == image->getPixelsSize();
+            std::fclose(file);
+            if (isRead) {
+                return image;
+            }
+            ESP_LOGW(TAG, "Cached picture '%s' damaged", cachePath.c_str());
+        }
+
+        const auto start = xTaskGetTickCount();
+        auto image = decodeImage(epub, imagePath, maxSize);
+        if (image == nullptr) {
+            ESP_LOGW(TAG, "Failed to decode picture '%s'", imagePath.c_str());
+            return nullptr;
+        }
+        ESP_LOGI(TAG, "Picture '%s' decoded in %lums", imagePath.c_str(), pdTICKS_TO_MS(xTaskGetTickCount() - start));
+
+        header = {
+            .magic = cacheFileMagic,
+            .version = cacheFileVersion,
+            .bookSize = bookSize,
+            .maxWidth = maxSize.width,
+            .maxHeight = maxSize.height,
+            .width = image->getWidth(),
+            .height = image->getHeight(),
+            .pathLength = static_cast<std::uint16_t>(imagePath.size())
+        };
+        if (!saveCacheFile(cachePath, header, imagePath, *image)) {
+            ESP_LOGW(TAG, "Failed to save picture to '%s'", cachePath.c_str());
+        }
+        return image;
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "GrayImage.hpp"
+#include "ImageDecoder.hpp"
+#include <Epub.hpp>
+#include <optional>
+#include <memory>
+#include <string>
+
+namespace gui
+{
+    /* Pictures of a book decoded to the size they are shown at are stored in a hidden directory
+     * next to the book, one file per picture named after its path in the archive, so that each
+     * picture is decoded only once. Both functions are safe to call from the UI and indexer tasks. */
+
+    /* Size of the picture fitted in maxSize, read from the cache or from the header of the picture */
+    auto imageCacheGetSize(const Epub &epub, const std::string &imagePath, const ImageSize &maxSize) -> std::optional<ImageSize>;
+
+    /* Loads the picture from the cache, decoding and storing it there first if needed */
+    auto imageCacheLoad(const Epub &epub, const std::string &imagePath, const ImageSize &maxSize) -> std::unique_ptr<GrayImage>;
+}
@@ -0,0 +1,593 @@
+#include "ImageDecoder.hpp"
+#include <src/extra/libs/sjpg/tjpgd.h>
+#include <miniz/miniz.h>
+#include <esp_log.h>
+#include <algorithm>
+#include <cstring>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        constexpr std::uint8_t jpegSignature[] = {0xFF, 0xD8, 0xFF};
+        constexpr std::uint8_t pngSignature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+        constexpr auto jpegPoolSize = 4096; // TJpgDec needs about 3.1kB without fast decoding
+        constexpr auto jpegMaxScale = 3; // 1/8
+        constexpr auto maxSourceDimension = 8192; // Row buffers of larger pictures would not fit in memory
+
+        constexpr auto pngChunkHeaderSize = 8;
+        constexpr auto pngChunkCrcSize = 4;
+        constexpr auto pngHeaderSize = 13;
+        constexpr auto pngInputChunkSize = 1024;
+        constexpr auto pngMaxPaletteEntries = 256;
+        constexpr auto pngFilterNone = 0;
+        constexpr auto pngFilterSub = 1;
+        constexpr auto pngFilterUp = 2;
+        constexpr auto pngFilterAverage = 3;
+        constexpr auto pngFilterPaeth = 4;
+
+        enum PngColorType : std::uint8_t
+        {
+            Gray = 0,
+            Rgb = 2,
+            Palette = 3,
+            GrayAlpha = 4,
+            RgbAlpha = 6
+        };
+
+        auto getLuma(std::uint32_t red, std::uint32_t green, std::uint32_t blue) -> std::uint8_t
+        {
+            return ((red * 77) + (green * 150) + (blue * 29)) >> 8;
+        }
+
+        /* Transparent pixels are shown on white page */
+        auto blendOnWhite(std::uint32_t luma, std::uint32_t alpha) -> std::uint8_t
+        {
+            return ((luma * alpha) + (255 * (255 - alpha)) + 127) / 255;
+        }
+
+        auto readBigEndian32(const std::uint8_t *bytes) -> std::uint32_t
+        {
+            return (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+        }
+
+        /* Averages source pixels falling into each output pixel and dithers the result to
+         * gray levels with Floyd-Steinberg error diffusion. Source rows are fed one by one,
+         * only sums of the output row being built are kept. */
+        class RowScaler
+        {
+            public:
+                RowScaler(std::uint16_t sourceWidth, std::uint16_t sourceHeight, GrayImage &image)
+                    : sourceHeight{sourceHeight}, sourceRow{0}, rowsInSums{0}, image{image},
+                      columnMap(sourceWidth), columnWeights(image.getWidth(), 0), sums(image.getWidth(), 0),
+                      errors(2 * (image.getWidth() + 2), 0)
+                {
+                    for (std::uint32_t x = 0; x < sourceWidth; ++x) {
+                        columnMap[x] = (x * image.getWidth()) / sourceWidth;
+                        columnWeights[columnMap[x]]++;
+                    }
+                }
+
+                auto addRow(const std::uint8_t *luma) -> void
+                {
+                    if (isComplete()) {
+                        return;
+                    }
+
+                    for (std::size_t x = 0; x < columnMap.size(); ++x) {
+                        sums[columnMap[x]] += luma[x];
+                    }
+                    rowsInSums++;
+
+                    const auto outputRow = (sourceRow * image.getHeight()) / sourceHeight;
+                    const auto nextOutputRow = ((sourceRow + 1) * image.getHeight()) / sourceHeight;
+                    sourceRow++;
+                    if (nextOutputRow != outputRow) {
+                        emitRow(outputRow);
+                    }
+                }
+
+                [[nodiscard]] auto isComplete() const -> bool
+                {
+                    return sourceRow >= sourceHeight;
+                }
+
+            private:
+                static constexpr auto maxLevel = GrayImage::levelsCount - 1;
+
+                std::uint32_t sourceHeight;
+                std::uint32_t sourceRow;
+                std::uint32_t rowsInSums;
+                GrayImage &image;
+                std::vector<std::uint16_t> columnMap;
+                std::vector<std::uint16_t> columnWeights;
+                std::vector<std::uint32_t> sums;
+                std::vector<std::int32_t> errors; // Two rows with a guard column on both sides
+
+                auto emitRow(std::uint32_t y) -> void
+                {
+                    const auto width = image.getWidth();
+                    const auto errorsStride = width + 2;
+                    auto currentErrors = errors.data() + ((y % 2) * errorsStride) + 1;
+                    auto nextErrors = errors.data() + (((y + 1) % 2) * errorsStride) + 1;
+                    std::fill(nextErrors - 1, nextErrors - 1 + errorsStride, 0);
+
+                    auto row = image.getRow(y);
+                    for (std::int32_t x = 0; x < width; ++x) {
+                        const auto value = static_cast<std::int32_t>(sums[x] / (rowsInSums * columnWeights[x])) + currentErrors[x];
+                        const auto level = ((std::clamp(value, 0, 255) * maxLevel) + 127) / 255;
+                        const auto error = value - ((level * 255) / maxLevel);
+
+                        currentErrors[x + 1] += (error * 7) / 16;
+                        nextErrors[x - 1] += (error * 3) / 16;
+                        nextErrors[x] += (error * 5) / 16;
+                        nextErrors[x + 1] += error / 16;
+
+                        if ((x % 2) == 0) {
+                            row[x / 2] = level << 4;
+                        }
+                        else {
+                            row[x / 2] |= level;
+                        }
+                    }
+
+                    std::fill(sums.begin(), sums.end(), 0);
+                    rowsInSums = 0;
+                }
+        };
+
+        /* TJpgDec outputs MCUs left to right, a row of MCUs is gathered before it's passed to the scaler */
+        struct JpegBand
+        {
+            std::vector<std::uint8_t> luma;
+            std::uint16_t width;
+            RowScaler *scaler;
+        };
+
+        struct JpegSession
+        {
+            ImageDecoder *decoder;
+            JpegBand *band;
+        };
+
+        auto jpegOutput(JDEC *decoder, void *bitmap, JRECT *rect) -> int
+        {
+            auto &band = *static_cast<JpegSession *>(decoder->device)->band;
+            const auto rgb = static_cast<const std::uint8_t *>(bitmap);
+            const auto rectWidth = rect->right - rect->left + 1;
+            const auto rectHeight = rect->bottom - rect->top + 1;
+
+            for (auto y = 0; y < rectHeight; ++y) {
+                auto pixel = rgb + (y * rectWidth * 3);
+                auto luma = band.luma.data() + (y * band.width) + rect->left;
+                for (auto x = 0; x < rectWidth; ++x) {
+                    luma[x] = getLuma(pixel[0], pixel[1], pixel[2]);
+                    pixel += 3;
+                }
+            }
+
+            if ((rect->right + 1) == band.width) {
+                for (auto y = 0; y < rectHeight; ++y) {
+                    band.scaler->addRow(band.luma.data() + (y * band.width));
+                }
+            }
+            return 1;
+        }
+
+        auto paethPredictor(std::int32_t left, std::int32_t up, std::int32_t upLeft) -> std::uint8_t
+        {
+            const auto estimate = left + up - upLeft;
+            const auto leftDistance = std::abs(estimate - left);
+            const auto upDistance = std::abs(estimate - up);
+            const auto upLeftDistance = std::abs(estimate - upLeft);
+            if ((leftDistance <= upDistance) && (leftDistance <= upLeftDistance)) {
+                return left;
+            }
+            return (upDistance <= upLeftDistance) ? up : upLeft;
+        }
+
+        auto unfilterPngRow(std::uint8_t filter, std::uint8_t *row, const std::uint8_t *previousRow, std::size_t size, std::size_t bytesPerPixel) -> bool
+        {
+            for (std::size_t i = 0; i < size; ++i) {
+                const std::uint8_t left = (i >= bytesPerPixel) ? row[i - bytesPerPixel] : 0;
+                const std::uint8_t upLeft = (i >= bytesPerPixel) ? previousRow[i - bytesPerPixel] : 0;
+                switch (filter) {
+                    case pngFilterNone:
+                        return true;
+                    case pngFilterSub:
+                        row[i] += left;
+                        break;
+                    case pngFilterUp:
+                        row[i] += previousRow[i];
+                        break;
+                    case pngFilterAverage:
+                        row[i] += (left + previousRow[i]) / 2;
+                        break;
+                    case pngFilterPaeth:
+                        row[i] += paethPredictor(left, previousRow[i], upLeft);
+                        break;
+                    default:
+                        return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    ImageDecoder::ImageDecoder(Reader reader)
+        : reader{std::move(reader)}, signature{}, signatureBytesRead{0}, isHeaderRead{false}, format{Format::Unknown}, size{0, 0}, pngHeader{} {}
+
+    ImageDecoder::~ImageDecoder() = default;
+
+    auto ImageDecoder::getSize() -> std::optional<ImageSize>
+    {
+        if (!readHeader()) {
+            return std::nullopt;
+        }
+        return size;
+    }
+
+    auto ImageDecoder::decode(const ImageSize &maxSize) -> std::unique_ptr<GrayImage>
+    {
+        if (!readHeader() || (maxSize.width == 0) || (maxSize.height == 0)) {
+            return nullptr;
+        }
+
+        const auto targetSize = fitSize(size, maxSize);
+        switch (format) {
+            case Format::Jpeg:
+                return decodeJpeg(targetSize);
+            case Format::Png:
+                return decodePng(targetSize);
+            default:
+                return nullptr;
+        }
+    }
+
+    auto ImageDecoder::fitSize(const ImageSize &size, const ImageSize &maxSize) -> ImageSize
+    {
+        /* Pictures are only scaled down, small ones are shown as they are */
+        if ((size.width <= maxSize.width) && (size.height <= maxSize.height)) {
+            return size;
+        }
+
+        const auto isWidthLimited = (static_cast<std::uint32_t>(size.width) * maxSize.height) >= (static_cast<std::uint32_t>(size.height) * maxSize.width);
+        if (isWidthLimited) {
+            const auto height = (static_cast<std::uint32_t>(size.height) * maxSize.width) / size.width;
+            return {maxSize.width, static_cast<std::uint16_t>(std::max<std::uint32_t>(height, 1))};
+        }
+        const auto width = (static_cast<std::uint32_t>(size.width) * maxSize.height) / size.height;
+        return {static_cast<std::uint16_t>(std::max<std::uint32_t>(width, 1)), maxSize.height};
+    }
+
+    auto ImageDecoder::readHeader() -> bool
+    {
+        if (isHeaderRead) {
+            return format != Format::Unknown;
+        }
+        isHeaderRead = true;
+
+        /* Signature is kept, JPEG decoder reads the stream from its very beginning */
+        signatureBytesRead = signature.size(); // Avoid serving the signature to itself
+        std::size_t bytesRead = 0;
+        while (bytesRead < signature.size()) {
+            const auto chunkSize = reader(signature.data() + bytesRead, signature.size() - bytesRead);
+            if (chunkSize == 0) {
+                break;
+            }
+            bytesRead += chunkSize;
+        }
+        signatureBytesRead = 0;
+
+        auto isValid = false;
+        if ((bytesRead >= sizeof(jpegSignature)) && std::equal(std::begin(jpegSignature), std::end(jpegSignature), signature.begin())) {
+            format = Format::Jpeg;
+            isValid = readJpegHeader();
+        }
+        else if ((bytesRead == sizeof(pngSignature)) && std::equal(std::begin(pngSignature), std::end(pngSignature), signature.begin())) {
+            format = Format::Png;
+            signatureBytesRead = signature.size();
+            isValid = readPngHeader();
+        }
+        else {
+            ESP_LOGW(TAG, "Unsupported picture format");
+        }
+
+        if (isValid && ((size.width == 0) || (size.height == 0) || (size.width > maxSourceDimension) || (size.height > maxSourceDimension))) {
+            ESP_LOGW(TAG, "Unsupported picture size %ux%u", size.width, size.height);
+            isValid = false;
+        }
+        if (!isValid) {
+            format = Format::Unknown;
+        }
+        return isValid;
+    }
+
+    auto ImageDecoder::readJpegHeader() -> bool
+    {
+        jpegDecoder = std::make_unique<JDEC>();
+        jpegPool = std::make_unique<std::uint8_t[]>(jpegPoolSize);
+
+        JpegSession session{this, nullptr};
+        const auto result = jd_prepare(jpegDecoder.get(), jpegInput, jpegPool.get(), jpegPoolSize, &session);
+        if (result != JDR_OK) {
+            ESP_LOGW(TAG, "Failed to read JPEG header, error %d", result); // E.g. progressive JPEG is not supported
+            return false;
+        }
+
+        size = {jpegDecoder->width, jpegDecoder->height};
+        return true;
+    }
+
+    auto ImageDecoder::readPngHeader() -> bool
+    {
+        /* Header is always the first chunk */
+        std::uint8_t chunk[pngChunkHeaderSize + pngHeaderSize + pngChunkCrcSize];
+        if ((read(chunk, sizeof(chunk)) != sizeof(chunk)) || (readBigEndian32(chunk) != pngHeaderSize) || (std::memcmp(chunk + 4, "IHDR", 4) != 0)) {
+            ESP_LOGW(TAG, "Invalid PNG header");
+            return false;
+        }
+
+        const auto header = chunk + pngChunkHeaderSize;
+        const auto width = readBigEndian32(header);
+        const auto height = readBigEndian32(header + 4);
+        pngHeader = {header[8], header[9], header[12]};
+        if ((width > maxSourceDimension) || (height > maxSourceDimension)) {
+            ESP_LOGW(TAG, "Unsupported picture size %lux%lu", width, height);
+            return false;
+        }
+        size = {static_cast<std::uint16_t>(width), static_cast<std::uint16_t>(height)};
+
+        const auto isBitDepthValid = (pngHeader.bitDepth == 8) || (pngHeader.bitDepth == 16) ||
+                                     (((pngHeader.colorType == Gray) || (pngHeader.colorType == Palette)) && (pngHeader.bitDepth < 8) &&
+                                      ((pngHeader.bitDepth == 1) || (pngHeader.bitDepth == 2) || (pngHeader.bitDepth == 4)));
+        const auto isColorTypeValid = (pngHeader.colorType == Gray) || (pngHeader.colorType == Rgb) || (pngHeader.colorType == Palette) ||
+                                      (pngHeader.colorType == GrayAlpha) || (pngHeader.colorType == RgbAlpha);
+        if (!isBitDepthValid || !isColorTypeValid || (pngHeader.interlaceMethod != 0)) {
+            ESP_LOGW(TAG, "Unsupported PNG, bit depth %u, color type %u, interlace %u", pngHeader.bitDepth, pngHeader.colorType, pngHeader.interlaceMethod);
+            return false;
+        }
+        return true;
+    }
+
+    auto ImageDecoder::decodeJpeg(const ImageSize &targetSize) -> std::unique_ptr<GrayImage>
+    {
+        /* Largest DCT scaling that still leaves at least target resolution, the rest is done by averaging */
+        std::uint8_t scale = 0;
+        while ((scale < jpegMaxScale) && ((size.width >> (scale + 1)) >= targetSize.width) && ((size.height >> (scale + 1)) >= targetSize.height)) {
+            scale++;
+        }
+
+        const auto scaledWidth = static_cast<std::uint16_t>(size.width >> scale);
+        const auto scaledHeight = static_cast<std::uint16_t>(size.height >> scale);
+        const auto bandHeight = std::max((jpegDecoder->msy * 8) >> scale, 1);
+
+        auto image = std::make_unique<GrayImage>(targetSize.width, targetSize.height);
+        RowScaler scaler{scaledWidth, scaledHeight, *image};
+        JpegBand band{std::vector<std::uint8_t>(scaledWidth * bandHeight), scaledWidth, &scaler};
+        JpegSession session{this, &band};
+        jpegDecoder->device = &session;
+
+        const auto result = jd_decomp(jpegDecoder.get(), jpegOutput, scale);
+        jpegDecoder.reset();
+        jpegPool.reset();
+        if ((result != JDR_OK) || !scaler.isComplete()) {
+            ESP_LOGW(TAG, "Failed to decode JPEG, error %d", result);
+            return nullptr;
+        }
+        return image;
+    }
+
+    auto ImageDecoder::decodePng(const ImageSize &targetSize) -> std::unique_ptr<GrayImage>
+    {
+        const auto channelsCount = (pngHeader.colorType == Rgb) ? 3 : (pngHeader.colorType == GrayAlpha) ? 2 : (pngHeader.colorType == RgbAlpha) ? 4 : 1;
+        const auto bitsPerPixel = channelsCount * pngHeader.bitDepth;
+        const auto bytesPerPixel = std::max(bitsPerPixel / 8, 1);
+        const auto rowSize = ((static_cast<std::size_t>(size.width) * bitsPerPixel) + 7) / 8;
+        const auto sampleMask = (1U << std::min<std::uint8_t>(pngHeader.bitDepth, 8)) - 1;
+
+        /* Palette entries are converted to luma and alpha right away */
+        std::vector<std::uint8_t> paletteLuma(pngMaxPaletteEntries, 0);
+        std::vector<std::uint8_t> paletteAlpha(pngMaxPaletteEntries, 255);
+
+        auto image = std::make_unique<GrayImage>(targetSize.width, targetSize.height);
+        RowScaler scaler{size.width, size.height, *image};
+        std::vector<std::uint8_t> row(rowSize + 1); // Filter type byte precedes the pixels
+        std::vector<std::uint8_t> previousRow(rowSize, 0);
+        std::vector<std::uint8_t> luma(size.width);
+        std::size_t rowFill = 0;
+
+        /* Sample at given index scaled to 8 bits, of 16-bit samples only the high byte is taken */
+        const auto getSample = [&](std::size_t index) -> std::uint32_t {
+            const auto pixels = row.data() + 1;
+            switch (pngHeader.bitDepth) {
+                case 8:
+                    return pixels[index];
+                case 16:
+                    return pixels[index * 2];
+                default:
+                    const auto bitOffset = index * pngHeader.bitDepth;
+                    const auto value = (pixels[bitOffset / 8] >> (8 - pngHeader.bitDepth - (bitOffset % 8))) & sampleMask;
+                    return (pngHeader.colorType == Palette) ? value : ((value * 255) / sampleMask);
+            }
+        };
+
+        const auto convertRow = [&]() {
+            for (std::size_t x = 0; x < size.width; ++x) {
+                switch (pngHeader.colorType) {
+                    case Gray:
+                        luma[x] = getSample(x);
+                        break;
+                    case Rgb:
+                        luma[x] = getLuma(getSample(x * 3), getSample((x * 3) + 1), getSample((x * 3) + 2));
+                        break;
+                    case Palette: {
+                        const auto index = getSample(x);
+                        luma[x] = blendOnWhite(paletteLuma[index], paletteAlpha[index]);
+                        break;
+                    }
+                    case GrayAlpha:
+                        luma[x] = blendOnWhite(getSample(x * 2), getSample((x * 2) + 1));
+                        break;
+                    case RgbAlpha:
+                        luma[x] = blendOnWhite(getLuma(getSample(x * 4), getSample((x * 4) + 1), getSample((x * 4) + 2)), getSample((x * 4) + 3));
+                        break;
+                    default:
+                        break;
+                }
+            }
+        };
+
+        /* Rows are assembled from the inflated stream, each one unfiltered using the previous one */
+        const auto consumeInflated = [&](const std::uint8_t *data, std::size_t dataSize) -> bool {
+            while ((dataSize > 0) && !scaler.isComplete()) {
+                const auto bytesToCopy = std::min(dataSize, row.size() - rowFill);
+                std::memcpy(row.data() + rowFill, data, bytesToCopy);
+                rowFill += bytesToCopy;
+                data += bytesToCopy;
+                dataSize -= bytesToCopy;
+                if (rowFill < row.size()) {
+                    break;
+                }
+
+                if (!unfilterPngRow(row[0], row.data() + 1, previousRow.data(), rowSize, bytesPerPixel)) {
+                    ESP_LOGW(TAG, "Invalid PNG filter %u", row[0]);
+                    return false;
+                }
+                convertRow();
+                scaler.addRow(luma.data());
+                std::memcpy(previousRow.data(), row.data() + 1, rowSize);
+                rowFill = 0;
+            }
+            return true;
+        };
+
+        /* Dictionary is the output buffer, inflated data is consumed before it wraps around */
+        auto inflator = std::make_unique<tinfl_decompressor>();
+        auto dictionary = std::make_unique<std::uint8_t[]>(TINFL_LZ_DICT_SIZE);
+        auto input = std::make_unique<std::uint8_t[]>(pngInputChunkSize);
+        std::size_t dictionaryOffset = 0;
+        auto isInflateDone = false;
+        tinfl_init(inflator.get());
+
+        while (!scaler.isComplete() && !isInflateDone) {
+            std::uint8_t chunkHeader[pngChunkHeaderSize];
+            if (read(chunkHeader, sizeof(chunkHeader)) != sizeof(chunkHeader)) {
+                break;
+            }
+            const auto chunkSize = readBigEndian32(chunkHeader);
+            const auto chunkType = std::string_view{reinterpret_cast<const char *>(chunkHeader + 4), 4};
+
+            if (chunkType == "IEND") {
+                break;
+            }
+            if ((chunkType == "PLTE") && (chunkSize <= (pngMaxPaletteEntries * 3))) {
+                std::uint8_t palette[pngMaxPaletteEntries * 3];
+                if (read(palette, chunkSize) != chunkSize) {
+                    break;
+                }
+                for (std::size_t i = 0; i < (chunkSize / 3); ++i) {
+                    paletteLuma[i] = getLuma(palette[i * 3], palette[(i * 3) + 1], palette[(i * 3) + 2]);
+                }
+            }
+            else if ((chunkType == "tRNS") && (pngHeader.colorType == Palette) && (chunkSize <= pngMaxPaletteEntries)) {
+                if (read(paletteAlpha.data(), chunkSize) != chunkSize) {
+                    break;
+                }
+            }
+            else if (chunkType == "IDAT") {
+                auto chunkRemaining = chunkSize;
+                while ((chunkRemaining > 0) && !isInflateDone) {
+                    auto inputSize = read(input.get(), std::min<std::size_t>(chunkRemaining, pngInputChunkSize));
+                    if (inputSize == 0) {
+                        return nullptr;
+                    }
+                    chunkRemaining -= inputSize;
+
+                    auto inputData = input.get();
+                    while (true) {
+                        auto inputConsumed = inputSize;
+                        auto outputSize = TINFL_LZ_DICT_SIZE - dictionaryOffset;
+                        const auto status = tinfl_decompress(inflator.get(), inputData, &inputConsumed, dictionary.get(), dictionary.get() + dictionaryOffset, &outputSize,
+                                                             TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+                        inputData += inputConsumed;
+                        inputSize -= inputConsumed;
+
+                        if (!consumeInflated(dictionary.get() + dictionaryOffset, outputSize)) {
+                            return nullptr;
+                        }
+                        dictionaryOffset = (dictionaryOffset + outputSize) & (TINFL_LZ_DICT_SIZE - 1);
+
+                        if (status < TINFL_STATUS_DONE) {
+                            ESP_LOGW(TAG, "Failed to inflate PNG data, status %d", status);
+                            return nullptr;
+                        }
+                        if (status == TINFL_STATUS_DONE) {
+                            isInflateDone = true;
+                            break;
+                        }
+                        if ((status == TINFL_STATUS_NEEDS_MORE_INPUT) && (inputSize == 0)) {
+                            break;
+                        }
+                    }
+                }
+                skip(chunkRemaining);
+            }
+            else {
+                skip(chunkSize);
+                skip(pngChunkCrcSize);
+                continue;
+            }
+            skip(pngChunkCrcSize);
+        }
+
+        if (!scaler.isComplete()) {
+            ESP_LOGW(TAG, "PNG data incomplete");
+            return nullptr;
+        }
+        return image;
+    }
+
+    auto ImageDecoder::read(std::uint8_t *buffer, std::size_t size) -> std::size_t
+    {
+        std::size_t bytesRead = 0;
+
+        /* Signature sniffed when reading the header comes first */
+        while ((bytesRead < size) && (signatureBytesRead < signature.size())) {
+            buffer[bytesRead++] = signature[signatureBytesRead++];
+        }
+
+        while (bytesRead < size) {
+            const auto chunkSize = reader(buffer + bytesRead, size - bytesRead);
+            if (chunkSize == 0) {
+                break;
+            }
+            bytesRead += chunkSize;
+        }
+        return bytesRead;
+    }
+
+    auto ImageDecoder::skip(std::size_t size) -> std::size_t
+    {
+        std::uint8_t buffer[64];
+        std::size_t bytesSkipped = 0;
+        while (bytesSkipped < size) {
+            const auto chunkSize = read(buffer, std::min(sizeof(buffer), size - bytesSkipped));
+            if (chunkSize == 0) {
+                break;
+            }
+            bytesSkipped += chunkSize;
+        }
+        return bytesSkipped;
+    }
+
+    auto ImageDecoder::jpegInput(JDEC *decoder, std::uint8_t *buffer, std::size_t size) -> std::size_t
+    {
+        /* Null buffer means the data is to be skipped */
+        auto imageDecoder = static_cast<JpegSession *>(decoder->device)->decoder;
+        return (buffer != nullptr) ? imageDecoder->read(buffer, size) : imageDecoder->skip(size);
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "GrayImage.hpp"
+#include <functional>
+#include <optional>
+#include <memory>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+struct JDEC;
+
+namespace gui
+{
+    struct ImageSize
+    {
+        std::uint16_t width;
+        std::uint16_t height;
+    };
+
+    /* Decodes baseline JPEG and non-interlaced PNG pictures read sequentially from a stream,
+     * e.g. inflated straight from the book archive. Pictures are downscaled while decoding -
+     * JPEG by skipping DCT coefficients, then both by averaging source rows as they come - so
+     * only a band of source rows is ever in memory. Output is dithered to display gray levels. */
+    class ImageDecoder
+    {
+        public:
+            /* Returns number of bytes read, 0 at the end of the stream */
+            using Reader = std::function<std::size_t(std::uint8_t *buffer, std::size_t size)>;
+
+            explicit ImageDecoder(Reader reader);
+            ~ImageDecoder();
+
+            ImageDecoder(const ImageDecoder &) = delete;
+            auto operator=(const ImageDecoder &) -> ImageDecoder & = delete;
+
+            /* Reads only the header of the picture */
+            [[nodiscard]] auto getSize() -> std::optional<ImageSize>;
+            /* Decodes the picture scaled down to fit in maxSize, can be called once */
+            [[nodiscard]] auto decode(const ImageSize &maxSize) -> std::unique_ptr<GrayImage>;
+
+            [[nodiscard]] static auto fitSize(const ImageSize &size, const ImageSize &maxSize) -> ImageSize;
+
+        private:
+            enum class Format
+            {
+                Unknown,
+                Jpeg,
+                Png
+            };
+
+            struct PngHeader
+            {
+                std::uint8_t bitDepth;
+                std::uint8_t colorType;
+                std::uint8_t interlaceMethod;
+            };
+
+            static constexpr auto signatureLength = 8;
+
+            Reader reader;
+            std::array<std::uint8_t, signatureLength> signature;
+            std::size_t signatureBytesRead;
+            bool isHeaderRead;
+            Format format;
+            ImageSize size;
+
+            std::unique_ptr<JDEC> jpegDecoder;
+            std::unique_ptr<std::uint8_t[]> jpegPool;
+            PngHeader pngHeader;
+
+            auto readHeader() -> bool;
+            auto readJpegHeader() -> bool;
+            auto readPngHeader() -> bool;
+            auto decodeJpeg(const ImageSize &targetSize) -> std::unique_ptr<GrayImage>;
+            auto decodePng(const ImageSize &targetSize) -> std::unique_ptr<GrayImage>;
+
+            auto read(std::uint8_t *buffer, std::size_t size) -> std::size_t;
+            auto skip(std::size_t size) -> std::size_t;
+
+            static auto jpegInput(JDEC *decoder, std::uint8_t *buffer, std::size_t size) -> std::size_t;
+    };
+}
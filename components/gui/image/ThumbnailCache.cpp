@@ -0,0 +1,503 @@
+#include "ThumbnailCache.hpp"
+#include "GrayImage.hpp"
+#include <Epub.hpp>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <deque>
+#include <list>
+#include <set>
+#include <map>
+#include <algorithm>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        constexpr auto taskName = "thumbnails";
+        constexpr auto taskStackSize = 1024 * 10; // bytes, OPF and TOC of the book are parsed
+        constexpr auto taskCoreAffinity = 1; // UI runs on core 0
+        constexpr auto taskPriority = tskIDLE_PRIORITY;
+
+        constexpr auto cacheFileName = ".thumbnails";
+        constexpr auto cacheFileMagic = std::uint32_t{0x424D4854}; // "THMB"
+        constexpr auto cacheFileVersion = std::uint32_t{1};
+
+        /* List rows are rebound only when their items change, so a shown thumbnail can't be evicted
+         * as long as this is at least twice the number of rows of the list */
+        constexpr auto maxLoadedThumbnails = 64;
+
+        constexpr auto whitePixels = std::uint8_t{0xFF};
+
+        struct CacheFileHeader
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint16_t width;
+            std::uint16_t height;
+        };
+
+        /* Followed by the path of the book and pixels, book without a cover has thumbnail of zero size */
+        struct RecordHeader
+        {
+            std::uint32_t bookSize;
+            std::uint16_t pathLength;
+            std::uint16_t width;
+            std::uint16_t height;
+        };
+
+        struct Record
+        {
+            long pixelsOffset;
+            std::uint32_t bookSize;
+            std::uint16_t width;
+            std::uint16_t height;
+        };
+
+        struct Thumbnail
+        {
+            std::filesystem::path bookPath;
+            std::unique_ptr<GrayImage> image; // Empty if the book has no cover
+        };
+
+        /* Shared with the task */
+        TaskHandle_t taskHandle;
+        std::mutex mutex;
+        std::filesystem::path cachePath;
+        ImageSize thumbnailSize;
+        std::deque<std::filesystem::path> requests;
+        std::vector<Thumbnail> results;
+        bool isBusy;
+
+        /* Used by the UI task only, the most recently requested thumbnails first */
+        std::list<Thumbnail> thumbnails;
+        std::set<std::filesystem::path> pendingBooks;
+
+        /* Used by the task only, records of the cache file, later records of the same book replace earlier ones */
+        std::filesystem::path indexedCachePath;
+        std::map<std::string, Record> records;
+        long cacheFileSize; // Bytes
+        long liveRecordsSize; // Bytes of the records above, headers and paths included
+
+        auto getTempPath(const std::filesystem::path &path) -> std::filesystem::path
+        {
+            auto tempPath = path;
+            tempPath += ".tmp";
+            return tempPath;
+        }
+
+        auto getFileSize(const std::filesystem::path &path) -> std::uint32_t
+        {
+            struct stat fileStat;
+            if (stat(path.c_str(), &fileStat) != 0) {
+                return 0;
+            }
+            return fileStat.st_size;
+        }
+
+        auto createCacheFile(const std::filesystem::path &path, const ImageSize &size) -> bool
+        {
+            auto file = std::fopen(path.c_str(), "wb");
+            if (file == nullptr) {
+                return false;
+            }
+
+            const auto header = CacheFileHeader{cacheFileMagic, cacheFileVersion, size.width, size.height};
+            const auto written = std::fwrite(&header, sizeof(header), 1, file) == 1;
+            std::fclose(file);
+            return written;
+        }
+
+        auto getRecordSize(const std::string &bookPath, const Record &record) -> long
+        {
+            return static_cast<long>(sizeof(RecordHeader) + bookPath.size() + (GrayImage::getStride(record.width) * record.height));
+        }
+
+        auto setRecord(const std::string &bookPath, const Record &record) -> void
+        {
+            const auto [it, isInserted] = records.try_emplace(bookPath, record);
+            if (!isInserted) {
+                liveRecordsSize -= getRecordSize(bookPath, it->second);
+                it->second = record;
+            }
+            liveRecordsSize += getRecordSize(bookPath, record);
+        }
+
+        /* Replaced records stay in the file until they take more of it than the live ones */
+        auto isCacheFileSparse() -> bool
+        {
+            const auto replacedRecordsSize = cacheFileSize - static_cast<long>(sizeof(CacheFileHeader)) - liveRecordsSize;
+            return replacedRecordsSize > liveRecordsSize;
+        }
+
+        /* Rewrites the file with the live records only, e.g. after covers of many books changed. On failure
+         * the file is left as it was, unless it could not be renamed - then it's indexed again next time. */
+        auto compactCacheFile(const std::filesystem::path &path, const ImageSize &size) -> bool
+        {
+            auto source = std::fopen(path.c_str(), "rb");
+            if (source == nullptr) {
+                return false;
+            }
+
+            /* Write to temporary file first, so that power loss never leaves half-written cache */
+            const auto tempPath = getTempPath(path);
+            auto file = std::fopen(tempPath.c_str(), "wb");
+            if (file == nullptr) {
+                std::fclose(source);
+                return false;
+            }
+
+            const auto header = CacheFileHeader{cacheFileMagic, cacheFileVersion, size.width, size.height};
+            auto written = std::fwrite(&header, sizeof(header), 1, file) == 1;
+            std::map<std::string, Record> compactedRecords;
+            std::vector<std::uint8_t> pixels;
+            for (auto it = records.begin(); written && (it != records.end()); ++it) {
+                const auto &[bookPath, record] = *it;
+                pixels.resize(GrayImage::getStride(record.width) * record.height);
+                const auto recordHeader = RecordHeader{
+                    .bookSize = record.bookSize,
+                    .pathLength = static_cast<std::uint16_t>(bookPath.size()),
+                    .width = record.width,
+                    .height = record.height
+                };
+                written = (std::fseek(source, record.pixelsOffset, SEEK_SET) == 0) &&
+                          (std::fread(pixels.data(), 1, pixels.size(), source) == pixels.size()) &&
+                          (std::fwrite(&recordHeader, sizeof(recordHeader), 1, file) == 1) &&
+                          (std::fwrite(bookPath.data(), 1, bookPath.size(), file) == bookPath.size());
+                const auto pixelsOffset = std::ftell(file);
+                written = written && (std::fwrite(pixels.data(), 1, pixels.size(), file) == pixels.size());
+                compactedRecords[bookPath] = {pixelsOffset, record.bookSize, record.width, record.height};
+            }
+            const auto compactedSize = std::ftell(file);
+            std::fclose(file);
+            std::fclose(source);
+            if (!written) {
+                std::remove(tempPath.c_str());
+                return false;
+            }
+
+            /* FAT can't rename over existing file */
+            std::remove(path.c_str());
+            if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+                indexedCachePath.clear();
+                return false;
+            }
+
+            ESP_LOGI(TAG, "Thumbnails cache '%s' compacted from %ld to %ld bytes", path.c_str(), cacheFileSize, compactedSize);
+            records.swap(compactedRecords);
+            cacheFileSize = compactedSize;
+            return true;
+        }
+
+        auto compactCacheFileIfSparse(const std::filesystem::path &path, const ImageSize &size) -> void
+        {
+            if (isCacheFileSparse() && !compactCacheFile(path, size)) {
+                ESP_LOGW(TAG, "Failed to compact thumbnails cache '%s'", path.c_str());
+            }
+        }
+
+        auto indexCacheFile(const std::filesystem::path &path, const ImageSize &size) -> void
+        {
+            indexedCachePath = path;
+            records.clear();
+            cacheFileSize = sizeof(CacheFileHeader);
+            liveRecordsSize = 0;
+
+            auto file = std::fopen(path.c_str(), "rb");
+            CacheFileHeader header;
+            const auto headerValid = (file != nullptr) && (std::fread(&header, sizeof(header), 1, file) == 1) && (header.magic == cacheFileMagic) &&
+                                     (header.version == cacheFileVersion) && (header.width == size.width) && (header.height == size.height);
+            if (!headerValid) {
+                if (file != nullptr) {
+                    std::fclose(file);
+                }
+                if (!createCacheFile(path, size)) {
+                    ESP_LOGW(TAG, "Failed to create thumbnails cache '%s'", path.c_str());
+                }
+                return;
+            }
+
+            /* Only headers of the records are read, pixels are skipped */
+            const auto fileSize = static_cast<long>(getFileSize(path));
+            auto validSize = std::ftell(file);
+            RecordHeader recordHeader;
+            while (std::fread(&recordHeader, sizeof(recordHeader), 1, file) == 1) {
+                std::string bookPath(recordHeader.pathLength, '\0');
+                if (std::fread(bookPath.data(), 1, bookPath.size(), file) != bookPath.size()) {
+                    break;
+                }
+
+                const auto pixelsOffset = std::ftell(file);
+                const auto recordEnd = pixelsOffset + static_cast<long>(GrayImage::getStride(recordHeader.width) * recordHeader.height);
+                if ((recordEnd > fileSize) || (std::fseek(file, recordEnd, SEEK_SET) != 0)) {
+                    break;
+                }
+
+                setRecord(bookPath, {pixelsOffset, recordHeader.bookSize, recordHeader.width, recordHeader.height});
+                validSize = recordEnd;
+            }
+            std::fclose(file);
+
+            /* Record cut by power loss would break the ones appended after it */
+            if ((validSize < fileSize) && (truncate(path.c_str(), validSize) != 0)) {
+                ESP_LOGW(TAG, "Failed to truncate damaged thumbnails cache '%s'", path.c_str());
+            }
+            cacheFileSize = validSize;
+            ESP_LOGI(TAG, "Thumbnails cache '%s' holds %zu books", path.c_str(), records.size());
+            compactCacheFileIfSparse(path, size);
+        }
+
+        auto readThumbnail(const std::filesystem::path &path, const Record &record) -> std::unique_ptr<GrayImage>
+        {
+            auto file = std::fopen(path.c_str(), "rb");
+            if (file == nullptr) {
+                return nullptr;
+            }
+
+            auto image = std::make_unique<GrayImage>(record.width, record.height);
+            const auto isRead = (std::fseek(file, record.pixelsOffset, SEEK_SET) == 0) &&
+                                (std::fread(image->getPixels(), 1, image->getPixelsSize(), file) == image->getPixelsSize());
+            std::fclose(file);
+            if (!isRead) {
+                return nullptr;
+            }
+            return image;
+        }
+
+        auto appendThumbnail(const std::filesystem::path &path, const std::string &bookPath, std::uint32_t bookSize, GrayImage *image) -> bool
+        {
+            auto file = std::fopen(path.c_str(), "ab");
+            if (file == nullptr) {
+                return false;
+            }
+
+            const auto recordHeader = RecordHeader{
+                .bookSize = bookSize,
+                .pathLength = static_cast<std::uint16_t>(bookPath.size()),
+                .width = (image != nullptr) ? image->getWidth() : std::uint16_t{0},
+                .height = (image != nullptr) ? image->getHeight() : std::uint16_t{0}
+            };
+            auto written = (std::fwrite(&recordHeader, sizeof(recordHeader), 1, file) == 1) &&
+                           (std::fwrite(bookPath.data(), 1, bookPath.size(), file) == bookPath.size());
+            const auto pixelsOffset = std::ftell(file);
+            if (written && (image != nullptr)) {
+                written = std::fwrite(image->getPixels(), 1, image->getPixelsSize(), file) == image->getPixelsSize();
+            }
+            const auto fileSize = std::ftell(file);
+            std::fclose(file);
+            if (!written) {
+                return false;
+            }
+
+            setRecord(bookPath, {pixelsOffset, recordHeader.bookSize, recordHeader.width, recordHeader.height});
+            cacheFileSize = fileSize;
+            return true;
+        }
+
+        /* Pads the picture with white to the full width, so that titles next to the thumbnails are aligned */
+        auto padToWidth(std::unique_ptr<GrayImage> image, std::uint16_t width) -> std::unique_ptr<GrayImage>
+        {
+            if (image->getWidth() >= width) {
+                return image;
+            }
+
+            auto padded = std::make_unique<GrayImage>(width, image->getHeight());
+            std::memset(padded->getPixels(), whitePixels, padded->getPixelsSize());
+
+            const auto offset = (width - image->getWidth()) / 2;
+            for (std::uint16_t y = 0; y < image->getHeight(); ++y) {
+                const auto source = image->getRow(y);
+                auto destination = padded->getRow(y);
+                for (std::uint16_t x = 0; x < image->getWidth(); ++x) {
+                    const auto level = (x % 2 == 0) ? (source[x / 2] >> 4) : (source[x / 2] & 0x0F);
+                    const auto destinationX = x + offset;
+                    auto &pixels = destination[destinationX / 2];
+                    pixels = (destinationX % 2 == 0) ? ((pixels & 0x0F) | (level << 4)) : ((pixels & 0xF0) | level);
+                }
+            }
+            return padded;
+        }
+
+        auto extractThumbnail(const std::filesystem::path &bookPath, const ImageSize &size) -> std::unique_ptr<GrayImage>
+        {
+            std::unique_ptr<Epub> epub;
+            try {
+                epub = std::make_unique<Epub>(bookPath);
+            }
+            catch (const std::runtime_error &e) {
+                ESP_LOGW(TAG, "Failed to open epub file '%s', error: %s", bookPath.c_str(), e.what());
+                return nullptr;
+            }
+
+            if (epub->getCoverPath().empty()) {
+                ESP_LOGI(TAG, "Book '%s' has no cover", bookPath.c_str());
+                return nullptr;
+            }
+
+            auto stream = epub->openEntryStream(epub->getCoverPath());
+            if (stream == nullptr) {
+                return nullptr;
+            }
+            ImageDecoder decoder{[&stream](std::uint8_t *buffer, std::size_t size) {
+                return stream->read(reinterpret_cast<char *>(buffer), size);
+            }};
+            auto image = decoder.decode(size);
+            if (image == nullptr) {
+                ESP_LOGW(TAG, "Failed to decode cover '%s' of '%s'", epub->getCoverPath().c_str(), bookPath.c_str());
+                return nullptr;
+            }
+            return padToWidth(std::move(image), size.width);
+        }
+
+        auto loadThumbnail(const std::filesystem::path &path, const ImageSize &size, const std::filesystem::path &bookPath) -> std::unique_ptr<GrayImage>
+        {
+            if (path != indexedCachePath) {
+                indexCacheFile(path, size);
+            }
+
+            const auto bookSize = getFileSize(bookPath);
+            const auto it = records.find(bookPath.string());
+            if ((it != records.end()) && (it->second.bookSize == bookSize)) {
+                if ((it->second.width == 0) || (it->second.height == 0)) {
+                    return nullptr;
+                }
+                if (auto image = readThumbnail(path, it->second)) {
+                    return image;
+                }
+                ESP_LOGW(TAG, "Cached thumbnail of '%s' damaged", bookPath.c_str());
+            }
+
+            /* Books without a usable cover are stored too, so that they are not opened again */
+            const auto start = xTaskGetTickCount();
+            auto image = extractThumbnail(bookPath, size);
+            ESP_LOGI(TAG, "Thumbnail of '%s' extracted in %lums", bookPath.c_str(), pdTICKS_TO_MS(xTaskGetTickCount() - start));
+            if (appendThumbnail(path, bookPath.string(), bookSize, image.get())) {
+                compactCacheFileIfSparse(path, size);
+            }
+            else {
+                ESP_LOGW(TAG, "Failed to save thumbnail to '%s'", path.c_str());
+            }
+            return image;
+        }
+
+        auto thumbnailsTask(void *arg) -> void
+        {
+            while (true) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+                while (true) {
+                    std::filesystem::path bookPath;
+                    std::filesystem::path path;
+                    ImageSize size;
+                    {
+                        std::lock_guard lock{mutex};
+                        if (requests.empty()) {
+                            isBusy = false;
+                            break;
+                        }
+                        bookPath = std::move(requests.front());
+                        requests.pop_front();
+                        path = cachePath;
+                        size = thumbnailSize;
+                    }
+
+                    auto image = loadThumbnail(path, size, bookPath);
+
+                    std::lock_guard lock{mutex};
+                    results.push_back({std::move(bookPath), std::move(image)});
+                }
+            }
+        }
+
+        auto requestThumbnail(const std::filesystem::path &bookPath) -> void
+        {
+            {
+                std::lock_guard lock{mutex};
+                requests.push_back(bookPath);
+                isBusy = true; // Keep the device awake until the thumbnails are done
+            }
+
+            if (taskHandle == nullptr) {
+                xTaskCreatePinnedToCore(thumbnailsTask, taskName, taskStackSize / sizeof(StackType_t), nullptr, taskPriority, &taskHandle, taskCoreAffinity);
+            }
+            xTaskNotifyGive(taskHandle);
+        }
+    }
+
+    auto thumbnailCacheOpen(const std::filesystem::path &rootPath, const ImageSize &size) -> void
+    {
+        thumbnailCacheCancel();
+        thumbnails.clear();
+
+        std::lock_guard lock{mutex};
+        cachePath = rootPath / cacheFileName; // Hidden file, files list does not show it
+        thumbnailSize = size;
+    }
+
+    auto thumbnailCacheGet(const std::filesystem::path &bookPath) -> const lv_img_dsc_t *
+    {
+        const auto it = std::find_if(thumbnails.begin(), thumbnails.end(), [&](const auto &thumbnail) {
+            return thumbnail.bookPath == bookPath;
+        });
+        if (it != thumbnails.end()) {
+            thumbnails.splice(thumbnails.begin(), thumbnails, it);
+            return (it->image != nullptr) ? it->image->getDescriptor() : nullptr;
+        }
+
+        if (pendingBooks.insert(bookPath).second) {
+            requestThumbnail(bookPath);
+        }
+        return nullptr;
+    }
+
+    auto thumbnailCachePoll() -> std::vector<std::filesystem::path>
+    {
+        std::vector<Thumbnail> loaded;
+        {
+            std::lock_guard lock{mutex};
+            loaded.swap(results);
+        }
+
+        std::vector<std::filesystem::path> books;
+        for (auto &thumbnail : loaded) {
+            pendingBooks.erase(thumbnail.bookPath);
+
+            /* Cancelled request could have been made again and loaded twice */
+            const auto isLoaded = std::any_of(thumbnails.begin(), thumbnails.end(), [&](const auto &loadedThumbnail) {
+                return loadedThumbnail.bookPath == thumbnail.bookPath;
+            });
+            if (isLoaded) {
+                continue;
+            }
+
+            books.push_back(thumbnail.bookPath);
+            thumbnails.push_front(std::move(thumbnail));
+        }
+
+        while (thumbnails.size() > maxLoadedThumbnails) {
+            thumbnails.pop_back();
+        }
+        return books;
+    }
+
+    auto thumbnailCacheCancel() -> void
+    {
+        pendingBooks.clear();
+
+        std::lock_guard lock{mutex};
+        requests.clear();
+    }
+
+    auto thumbnailCacheIsIdle() -> bool
+    {
+        std::lock_guard lock{mutex};
+        return !isBusy && results.empty(); // Loaded thumbnails have to be shown before sleep too
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "ImageDecoder.hpp"
+#include <lvgl.h>
+#include <filesystem>
+#include <vector>
+
+namespace gui
+{
+    /* Cover thumbnails of the books in the library. They are extracted from the books in a low
+     * priority background task and stored in a single hidden file in the library root, as
+     * bitmaps ready to be drawn, so each cover is decoded only once. Books are only opened
+     * when their thumbnails are requested, listing a directory does not read them at all.
+     *
+     * All functions except thumbnailCacheIsIdle are meant to be called from the UI task only. */
+    auto thumbnailCacheOpen(const std::filesystem::path &rootPath, const ImageSize &size) -> void;
+
+    /* Returns the thumbnail if it's already loaded, otherwise requests it and returns nullptr.
+     * Returned image is valid until the thumbnail is evicted, only the least recently requested
+     * thumbnails are evicted, when many more than fit on screen were requested after them. */
+    auto thumbnailCacheGet(const std::filesystem::path &bookPath) -> const lv_img_dsc_t *;
+
+    /* Returns books whose requested thumbnails have been loaded since the last call, it has to be
+     * called periodically even when the thumbnails are not shown, so that the cache gets idle */
+    auto thumbnailCachePoll() -> std::vector<std::filesystem::path>;
+
+    /* Drops requests that are not processed yet, e.g. when the library gets covered by a book */
+    auto thumbnailCacheCancel() -> void;
+
+    auto thumbnailCacheIsIdle() -> bool;
+}
@@ -0,0 +1,7 @@
+#include "ThumbnailCacheCWrapper.h"
+#include "ThumbnailCache.hpp"
+
+bool thumbnailCacheIsIdle(void)
+{
+    return gui::thumbnailCacheIsIdle();
+}
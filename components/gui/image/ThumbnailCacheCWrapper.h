@@ -0,0 +1,13 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+bool thumbnailCacheIsIdle(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,381 @@
+#include "BookIndexer.hpp"
+#include "ImageCache.hpp"
+#include "Hyphenator.hpp"
+#include <Epub.hpp>
+#include <SearchIndex.hpp>
+#include <eink_worker.h>
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <sys/stat.h>
+#include <cstdio>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <limits>
+#include <cerrno>
+#include <cstring>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        constexpr auto taskName = "book_indexer";
+        constexpr auto taskStackSize = 1024 * 14; // bytes, section parsing needs as much as on the UI task
+        constexpr auto taskCoreAffinity = 1; // UI runs on core 0
+        constexpr auto taskPriority = tskIDLE_PRIORITY;
+        constexpr auto userActivityHoldoffMs = 2000;
+        constexpr auto idlePollPeriodMs = 200;
+
+        constexpr auto pagesCacheExtension = ".pages";
+        constexpr auto searchIndexExtension = ".search";
+
+        constexpr auto cacheFileMagic = std::uint32_t{0x58444950}; // "PIDX"
+        constexpr auto cacheFileVersion = std::uint32_t{1};
+        constexpr auto notIndexed = std::numeric_limits<std::uint32_t>::max();
+
+        struct CacheFileHeader
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t layoutHash;
+            std::uint32_t bookSize;
+            std::uint32_t sectionsCount;
+        };
+
+        struct Job
+        {
+            std::filesystem::path bookPath;
+            Paginator::Layout layout;
+        };
+
+        TaskHandle_t taskHandle;
+        std::mutex mutex;
+        std::mutex layoutMutex; // Held while the indexer measures text, fonts can't be replaced meanwhile
+        std::uint32_t jobGeneration; // Incremented on each start/stop, indexing of stale job is abandoned
+        Job pendingJob;
+        std::vector<std::uint32_t> pageCounts;
+        bool isBusy;
+        std::atomic<TickType_t> lastActivityTick;
+
+        auto getCachePath(const std::filesystem::path &bookPath, const char *extension) -> std::filesystem::path
+        {
+            /* Hidden file next to the book, files list does not show it */
+            return bookPath.parent_path() / ("." + bookPath.filename().string() + extension);
+        }
+
+        auto getTempPath(const std::filesystem::path &path) -> std::filesystem::path
+        {
+            auto tempPath = path;
+            tempPath += ".tmp";
+            return tempPath;
+        }
+
+        auto replaceFile(const std::filesystem::path &tempPath, const std::filesystem::path &path) -> bool
+        {
+            /* FAT can't rename over existing file */
+            std::remove(path.c_str());
+            return std::rename(tempPath.c_str(), path.c_str()) == 0;
+        }
+
+        auto getFileSize(const std::filesystem::path &path) -> std::uint32_t
+        {
+            struct stat fileStat;
+            if (stat(path.c_str(), &fileStat) != 0) {
+                return 0;
+            }
+            return fileStat.st_size;
+        }
+
+        auto loadCache(const std::filesystem::path &cachePath, const CacheFileHeader &expectedHeader) -> std::vector<std::uint32_t>
+        {
+            std::vector<std::uint32_t> counts(expectedHeader.sectionsCount, notIndexed);
+
+            auto file = std::fopen(cachePath.c_str(), "rb");
+            if (file == nullptr) {
+                if (errno != ENOENT) {
+                    ESP_LOGE(TAG, "Failed to open page counts cache '%s': %s", cachePath.c_str(), std::strerror(errno));
+                }
+                return counts;
+            }
+
+            CacheFileHeader header;
+            const auto headerRead = std::fread(&header, sizeof(header), 1, file) == 1;
+            const auto headerValid = headerRead && (header.magic == expectedHeader.magic) && (header.version == expectedHeader.version) && 
+                                     (header.layoutHash == expectedHeader.layoutHash) && (header.bookSize == expectedHeader.bookSize) && 
+                                     (header.sectionsCount == expectedHeader.sectionsCount);
+            if (!headerValid || (std::fread(counts.data(), sizeof(std::uint32_t), counts.size(), file) != counts.size())) {
+                ESP_LOGI(TAG, "Page counts cache '%s' outdated or damaged", cachePath.c_str());
+                counts.assign(expectedHeader.sectionsCount, notIndexed);
+            }
+
+            std::fclose(file);
+            return counts;
+        }
+
+        auto saveCache(const std::filesystem::path &cachePath, const CacheFileHeader &header, const std::vector<std::uint32_t> &counts) -> bool
+        {
+            /* Write to temporary file first, so that power loss never leaves half-written cache */
+            const auto tempPath = getTempPath(cachePath);
+            auto file = std::fopen(tempPath.c_str(), "wb");
+            if (file == nullptr) {
+                ESP_LOGE(TAG, "Failed to create '%s': %s", tempPath.c_str(), std::strerror(errno));
+                return false;
+            }
+
+            const auto written = (std::fwrite(&header, sizeof(header), 1, file) == 1) && 
+                                 (std::fwrite(counts.data(), sizeof(std::uint32_t), counts.size(), file) == counts.size());
+            std::fclose(file);
+            if (!written) {
+                std::remove(tempPath.c_str());
+                return false;
+            }
+
+            return replaceFile(tempPath, cachePath);
+        }
+
+        auto saveSearchIndex(const SearchIndexBuilder &builder, const std::filesystem::path &path, std::uint32_t bookSize) -> bool
+        {
+            const auto tempPath = getTempPath(path);
+            if (!builder.write(tempPath, bookSize)) {
+                std::remove(tempPath.c_str());
+                return false;
+            }
+
+            return replaceFile(tempPath, path);
+        }
+
+        auto isJobStale(std::uint32_t generation) -> bool
+        {
+            std::lock_guard lock{mutex};
+            return generation != jobGeneration;
+        }
+
+        auto waitForUserInactivity(std::uint32_t generation) -> void
+        {
+            /* Page turns and display refreshes read the SD card and use the CPU too, don't compete with them */
+            while (!isJobStale(generation)) {
+                const auto ticksSinceActivity = xTaskGetTickCount() - lastActivityTick.load();
+                if ((ticksSinceActivity >= pdMS_TO_TICKS(userActivityHoldoffMs)) && eink_worker_idle()) {
+                    break;
+                }
+                vTaskDelay(pdMS_TO_TICKS(idlePollPeriodMs));
+            }
+        }
+
+        auto runJob(const Job &job, std::uint32_t generation) -> void
+        {
+            std::unique_ptr<Epub> epub;
+            try {
+                epub = std::make_unique<Epub>(job.bookPath);
+            }
+            catch (const std::runtime_error &e) {
+                ESP_LOGE(TAG, "Failed to open epub file '%s', error: %s", job.bookPath.c_str(), e.what());
+                return;
+            }
+
+            /* Pictures are decoded while measured, so that they are in the cache before they are shown */
+            Paginator paginator{job.layout};
+            paginator.setImageHeightGetter([&epub](const std::string &imagePath, lv_coord_t maxWidth, lv_coord_t maxHeight) -> lv_coord_t {
+                const auto maxSize = ImageSize{static_cast<std::uint16_t>(maxWidth), static_cast<std::uint16_t>(maxHeight)};
+                if (const auto image = imageCacheLoad(*epub, imagePath, maxSize)) {
+                    return image->getHeight();
+                }
+                const auto size = imageCacheGetSize(*epub, imagePath, maxSize); // Same height as the UI gets for the picture
+                return size.has_value() ? size->height : 0;
+            });
+            paginator.setHyphenator(Hyphenator::forLanguage(epub->getLanguage()));
+            const auto cachePath = getCachePath(job.bookPath, pagesCacheExtension);
+            const auto searchIndexPath = getCachePath(job.bookPath, searchIndexExtension);
+            std::unique_lock layoutLock{layoutMutex};
+            if (isJobStale(generation)) {
+                return;
+            }
+            const auto header = CacheFileHeader{
+                .magic = cacheFileMagic,
+                .version = cacheFileVersion,
+                .layoutHash = paginator.getLayoutHash(),
+                .bookSize = getFileSize(job.bookPath),
+                .sectionsCount = static_cast<std::uint32_t>(epub->getSpineItemsCount())
+            };
+            layoutLock.unlock();
+
+            auto counts = loadCache(cachePath, header);
+            const auto needsSearchIndex = !SearchIndex::isValid(searchIndexPath, header.bookSize);
+            SearchIndexBuilder searchIndexBuilder;
+            {
+                std::lock_guard lock{mutex};
+                if (generation != jobGeneration) {
+                    return;
+                }
+                pageCounts = counts;
+            }
+
+            const auto start = xTaskGetTickCount();
+            for (std::size_t spineIndex = 0; spineIndex < counts.size(); ++spineIndex) {
+                const auto needsPagesCount = (counts[spineIndex] == notIndexed);
+                if (!needsPagesCount && !needsSearchIndex) {
+                    continue;
+                }
+
+                /* Job is checked under the lock, stopped one must not touch the fonts anymore */
+                waitForUserInactivity(generation);
+                layoutLock.lock();
+                if (isJobStale(generation)) {
+                    ESP_LOGI(TAG, "Indexing of '%s' abandoned", job.bookPath.c_str());
+                    return;
+                }
+
+                /* Section is parsed once for both page count and search index */
+                try {
+                    const auto section = epub->getSection(spineIndex);
+                    if (needsPagesCount) {
+                        paginator.paginate(section, spineIndex);
+                        counts[spineIndex] = paginator.getPagesCount();
+                    }
+                    if (needsSearchIndex) {
+                        const auto &blocks = section.getBlocks();
+                        for (std::size_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex) {
+                            if (!section.getBlockStyle(blocks[blockIndex]).isHidden) { // Text that is not shown is not searched for
+                                searchIndexBuilder.addBlock(spineIndex, blockIndex, blocks[blockIndex].text);
+                            }
+                        }
+                    }
+                }
+                catch (const std::exception &e) {
+                    ESP_LOGE(TAG, "Exception for section@%zu: '%s'", spineIndex, e.what());
+                    if (needsPagesCount) {
+                        counts[spineIndex] = 0;
+                    }
+                }
+                layoutLock.unlock();
+
+                if (!needsPagesCount) {
+                    continue;
+                }
+
+                {
+                    std::lock_guard lock{mutex};
+                    if (generation != jobGeneration) {
+                        return;
+                    }
+                    pageCounts[spineIndex] = counts[spineIndex];
+                }
+
+                if (!saveCache(cachePath, header, counts)) {
+                    ESP_LOGW(TAG, "Failed to save page counts to '%s'", cachePath.c_str());
+                }
+            }
+
+            if (needsSearchIndex && !saveSearchIndex(searchIndexBuilder, searchIndexPath, header.bookSize)) {
+                ESP_LOGW(TAG, "Failed to save search index to '%s'", searchIndexPath.c_str());
+            }
+
+            ESP_LOGI(TAG, "Indexing of '%s' done in %lums", job.bookPath.c_str(), pdTICKS_TO_MS(xTaskGetTickCount() - start));
+        }
+
+        auto indexerTask(void *arg) -> void
+        {
+            std::uint32_t lastGeneration = 0;
+
+            while (true) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+                /* Start/stop requests could have been coalesced, handle only the latest one */
+                Job job;
+                std::uint32_t generation;
+                {
+                    std::lock_guard lock{mutex};
+                    generation = jobGeneration;
+                    job = pendingJob;
+                }
+                if ((generation != lastGeneration) && !job.bookPath.empty()) {
+                    runJob(job, generation);
+                }
+                lastGeneration = generation;
+
+                /* Newer job could have been submitted in the meantime, it keeps the indexer busy then */
+                std::lock_guard lock{mutex};
+                if (generation == jobGeneration) {
+                    isBusy = false;
+                }
+            }
+        }
+
+        auto submitJob(const Job &job) -> void
+        {
+            {
+                std::lock_guard lock{mutex};
+                jobGeneration++;
+                pendingJob = job;
+                pageCounts.clear();
+                isBusy = !job.bookPath.empty(); // Keep the device awake until the job is done
+            }
+
+            if (taskHandle == nullptr) {
+                xTaskCreatePinnedToCore(indexerTask, taskName, taskStackSize / sizeof(StackType_t), nullptr, taskPriority, &taskHandle, taskCoreAffinity);
+            }
+            xTaskNotifyGive(taskHandle);
+        }
+    }
+
+    auto bookIndexerStart(const std::filesystem::path &bookPath, const Paginator::Layout &layout) -> void
+    {
+        submitJob({bookPath, layout});
+    }
+
+    auto bookIndexerStop() -> void
+    {
+        submitJob({});
+    }
+
+    auto bookIndexerWaitForStop() -> void
+    {
+        /* Section being measured is finished, the next one sees the job is stale */
+        std::lock_guard layoutLock{layoutMutex};
+    }
+
+    auto bookIndexerDefer() -> void
+    {
+        lastActivityTick = xTaskGetTickCount();
+    }
+
+    auto bookIndexerIsIdle() -> bool
+    {
+        std::lock_guard lock{mutex};
+        return !isBusy;
+    }
+
+    auto bookIndexerOpenSearchIndex(const std::filesystem::path &bookPath) -> std::unique_ptr<SearchIndex>
+    {
+        try {
+            return std::make_unique<SearchIndex>(getCachePath(bookPath, searchIndexExtension), getFileSize(bookPath));
+        }
+        catch (const std::runtime_error &e) {
+            ESP_LOGI(TAG, "Search index of '%s' not available: %s", bookPath.c_str(), e.what());
+            return nullptr;
+        }
+    }
+
+    auto bookIndexerGetProgress(std::size_t spineIndex) -> BookProgress
+    {
+        std::lock_guard lock{mutex};
+
+        BookProgress progress{0, pageCounts.size(), 0, 0, false};
+        for (std::size_t index = 0; index < pageCounts.size(); ++index) {
+            if (pageCounts[index] == notIndexed) {
+                continue;
+            }
+            progress.sectionsIndexed++;
+            progress.pagesTotal += pageCounts[index];
+            if (index < spineIndex) {
+                progress.pagesBefore += pageCounts[index];
+            }
+        }
+        progress.complete = (progress.sectionsCount > 0) && (progress.sectionsIndexed == progress.sectionsCount);
+
+        return progress;
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Paginator.hpp"
+#include <SearchIndex.hpp>
+#include <filesystem>
+#include <memory>
+
+namespace gui
+{
+    struct BookProgress
+    {
+        std::size_t sectionsIndexed;
+        std::size_t sectionsCount;
+        std::size_t pagesBefore; // Pages in sections preceding the requested one, valid when complete
+        std::size_t pagesTotal; // Valid when complete
+        bool complete;
+    };
+
+    /* Counts pages of all sections of a book in a low priority background task, using its own
+     * Epub instance, so the UI task never waits for it. Page counts are saved next to the book
+     * after each section, indexing continues where it stopped after restart and is redone only
+     * when the layout or the book changes. In the same pass full-text search index of the book
+     * is built, unless it already exists - it does not depend on the layout. */
+    auto bookIndexerStart(const std::filesystem::path &bookPath, const Paginator::Layout &layout) -> void;
+    auto bookIndexerStop() -> void;
+    auto bookIndexerWaitForStop() -> void; // Returns once the stopped indexer doesn't use the reading fonts
+    auto bookIndexerDefer() -> void;
+    auto bookIndexerIsIdle() -> bool;
+    auto bookIndexerGetProgress(std::size_t spineIndex) -> BookProgress;
+    auto bookIndexerOpenSearchIndex(const std::filesystem::path &bookPath) -> std::unique_ptr<SearchIndex>;
+}
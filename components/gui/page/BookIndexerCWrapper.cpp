@@ -0,0 +1,7 @@
+#include "BookIndexerCWrapper.h"
+#include "BookIndexer.hpp"
+
+bool bookIndexerIsIdle(void)
+{
+    return gui::bookIndexerIsIdle();
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+bool bookIndexerIsIdle(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,244 @@
+#include "Hyphenator.hpp"
+#include <lvgl.h>
+#include <esp_log.h>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <cctype>
+#include <cstring>
+
+#define TAG __FILENAME__
+
+/* Pattern files embedded by the build system */
+extern const std::uint8_t hyphEnUsStart[] asm("_binary_hyph_en_us_hyb_start");
+extern const std::uint8_t hyphEnUsEnd[] asm("_binary_hyph_en_us_hyb_end");
+extern const std::uint8_t hyphFrStart[] asm("_binary_hyph_fr_hyb_start");
+extern const std::uint8_t hyphFrEnd[] asm("_binary_hyph_fr_hyb_end");
+extern const std::uint8_t hyphEsStart[] asm("_binary_hyph_es_hyb_start");
+extern const std::uint8_t hyphEsEnd[] asm("_binary_hyph_es_hyb_end");
+extern const std::uint8_t hyphItStart[] asm("_binary_hyph_it_hyb_start");
+extern const std::uint8_t hyphItEnd[] asm("_binary_hyph_it_hyb_end");
+extern const std::uint8_t hyphPtStart[] asm("_binary_hyph_pt_hyb_start");
+extern const std::uint8_t hyphPtEnd[] asm("_binary_hyph_pt_hyb_end");
+extern const std::uint8_t hyphRuStart[] asm("_binary_hyph_ru_hyb_start");
+extern const std::uint8_t hyphRuEnd[] asm("_binary_hyph_ru_hyb_end");
+extern const std::uint8_t hyphUkStart[] asm("_binary_hyph_uk_hyb_start");
+extern const std::uint8_t hyphUkEnd[] asm("_binary_hyph_uk_hyb_end");
+
+namespace gui
+{
+    namespace
+    {
+        /* Layout of the .hyb file, all fields are little endian 32-bit words */
+        namespace hyb
+        {
+            constexpr std::uint32_t magic = 0x62AD7968;
+
+            constexpr auto headerAlphabetOffset = 8;
+            constexpr auto headerTrieOffset = 12;
+            constexpr auto headerPatternOffset = 16;
+            constexpr auto headerSize = 24;
+
+            /* Version 0 is a direct map of a codepoint range, version 1 a sorted list of (codepoint << 11 | code) */
+            constexpr auto alphabetDirectMinCodepoint = 4;
+            constexpr auto alphabetDirectMaxCodepoint = 8;
+            constexpr auto alphabetDirectData = 12;
+            constexpr auto alphabetListCount = 4;
+            constexpr auto alphabetListData = 8;
+            constexpr auto alphabetListCodeBits = 11;
+
+            constexpr auto trieCharMask = 4;
+            constexpr auto trieLinkShift = 8;
+            constexpr auto trieLinkMask = 12;
+            constexpr auto triePatternShift = 16;
+            constexpr auto trieCount = 20;
+            constexpr auto trieData = 24;
+
+            constexpr auto patternCount = 4;
+            constexpr auto patternBufferOffset = 8;
+            constexpr auto patternData = 16;
+        }
+    }
+
+    auto Hyphenator::forLanguage(std::string_view language) -> const Hyphenator *
+    {
+        /* Minimal lengths of word parts are the ones TeX uses for the language */
+        static const std::array<Hyphenator, 7> hyphenators = {
+            Hyphenator{"en-us", hyphEnUsStart, static_cast<std::size_t>(hyphEnUsEnd - hyphEnUsStart), 2, 3},
+            Hyphenator{"fr", hyphFrStart, static_cast<std::size_t>(hyphFrEnd - hyphFrStart), 2, 3},
+            Hyphenator{"es", hyphEsStart, static_cast<std::size_t>(hyphEsEnd - hyphEsStart), 2, 2},
+            Hyphenator{"it", hyphItStart, static_cast<std::size_t>(hyphItEnd - hyphItStart), 2, 2},
+            Hyphenator{"pt", hyphPtStart, static_cast<std::size_t>(hyphPtEnd - hyphPtStart), 2, 3},
+            Hyphenator{"ru", hyphRuStart, static_cast<std::size_t>(hyphRuEnd - hyphRuStart), 2, 2},
+            Hyphenator{"uk", hyphUkStart, static_cast<std::size_t>(hyphUkEnd - hyphUkStart), 2, 2}
+        };
+
+        /* Only the primary subtag is matched, all variants of English use US patterns */
+        auto primary = std::string{language.substr(0, language.find_first_of("-_"))};
+        std::transform(primary.begin(), primary.end(), primary.begin(), [](char c) {
+            return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        });
+        if (primary.empty()) {
+            return nullptr;
+        }
+
+        const auto it = std::find_if(hyphenators.begin(), hyphenators.end(), [&primary](const auto &hyphenator) {
+            const auto hyphenatorLanguage = hyphenator.getLanguage();
+            return hyphenatorLanguage.substr(0, hyphenatorLanguage.find('-')) == primary;
+        });
+        return ((it != hyphenators.end()) && it->isValid) ? &*it : nullptr;
+    }
+
+    Hyphenator::Hyphenator(std::string_view language, const std::uint8_t *data, std::size_t size, std::uint8_t minPrefix, std::uint8_t minSuffix)
+        : language{language}, data{data}, size{size}, minPrefix{minPrefix}, minSuffix{minSuffix}
+    {
+        isValid = (size >= hyb::headerSize) && (readWord(0) == hyb::magic);
+        alphabetOffset = readWord(hyb::headerAlphabetOffset);
+        trieOffset = readWord(hyb::headerTrieOffset);
+        patternOffset = readWord(hyb::headerPatternOffset);
+        if (!isValid) {
+            ESP_LOGE(TAG, "Invalid hyphenation patterns for '%.*s'", static_cast<int>(language.size()), language.data());
+        }
+    }
+
+    auto Hyphenator::hyphenate(std::string_view word, std::vector<std::size_t> &points) const -> void
+    {
+        points.clear();
+        if (!isValid) {
+            return;
+        }
+
+        /* Word is enclosed in boundary markers, which have code 0 */
+        std::array<std::uint16_t, maxWordLength + 2> codes;
+        std::array<std::uint32_t, maxWordLength + 1> offsets;
+        std::size_t length = 0;
+        std::uint32_t i = 0;
+        while (i < word.size()) {
+            const auto offset = i;
+            const auto code = getCode(_lv_txt_encoded_next(word.data(), &i));
+            if ((code == 0) && (length == 0)) { // Leading punctuation
+                continue;
+            }
+            if (length >= maxWordLength) {
+                return;
+            }
+            codes[length + 1] = code;
+            offsets[length] = offset;
+            length++;
+        }
+
+        /* Trailing punctuation is dropped, anything else that is not a letter makes the word unbreakable */
+        while ((length > 0) && (codes[length] == 0)) {
+            length--;
+        }
+        if ((length < static_cast<std::size_t>(minPrefix + minSuffix)) || (std::find(&codes[1], &codes[length + 1], 0) != &codes[length + 1])) {
+            return;
+        }
+        codes[0] = 0;
+        codes[length + 1] = 0;
+
+        const auto charMask = readWord(trieOffset + hyb::trieCharMask);
+        const auto linkShift = readWord(trieOffset + hyb::trieLinkShift);
+        const auto linkMask = readWord(trieOffset + hyb::trieLinkMask);
+        const auto patternShift = readWord(trieOffset + hyb::triePatternShift);
+        const auto trieCount = readWord(trieOffset + hyb::trieCount);
+        const auto patternCount = readWord(patternOffset + hyb::patternCount);
+        const auto patternBuffer = patternOffset + readWord(patternOffset + hyb::patternBufferOffset);
+
+        /* Every substring found in the trie has a pattern of values between its letters, the maximum
+         * value wins, odd values mean the word can be broken there. Value at index k is before letter k. */
+        std::array<std::uint8_t, maxWordLength + 1> values{};
+        const auto maxPoint = static_cast<int>(length) - minSuffix + 1;
+        for (std::size_t start = 0; start < (length + 1); ++start) {
+            std::uint32_t node = 0;
+            for (auto end = start; end < (length + 2); ++end) {
+                const auto code = codes[end];
+                if ((node + code) >= trieCount) {
+                    break;
+                }
+                const auto entry = readWord(trieOffset + hyb::trieData + (node + code) * 4);
+                if ((entry & charMask) != code) {
+                    break;
+                }
+                node = (entry & linkMask) >> linkShift;
+                if (node >= trieCount) {
+                    break;
+                }
+
+                const auto patternIndex = readWord(trieOffset + hyb::trieData + node * 4) >> patternShift;
+                if ((patternIndex == 0) || (patternIndex >= patternCount)) {
+                    continue;
+                }
+
+                /* Pattern entry holds its length, number of trailing zeros dropped from it and offset of its values */
+                const auto pattern = readWord(patternOffset + hyb::patternData + patternIndex * 4);
+                const auto patternLength = static_cast<int>(pattern >> 26);
+                const auto patternTrailingZeros = static_cast<int>((pattern >> 20) & 0x3F);
+                const auto patternValues = patternBuffer + (pattern & 0xFFFFF);
+                const auto patternStart = static_cast<int>(end) + 1 - (patternLength + patternTrailingZeros);
+                const auto first = std::max(minPrefix - patternStart, 0);
+                const auto last = std::min(patternLength, maxPoint - patternStart);
+                if ((patternValues + patternLength) > size) {
+                    continue;
+                }
+                for (auto k = first; k < last; ++k) {
+                    values[patternStart + k] = std::max(values[patternStart + k], data[patternValues + k]);
+                }
+            }
+        }
+
+        for (auto point = static_cast<int>(minPrefix); point < maxPoint; ++point) {
+            if ((values[point] & 1) != 0) {
+                points.push_back(offsets[point]);
+            }
+        }
+    }
+
+    auto Hyphenator::getLanguage() const -> std::string_view
+    {
+        return language;
+    }
+
+    auto Hyphenator::readWord(std::uint32_t offset) const -> std::uint32_t
+    {
+        /* Embedded files are not guaranteed to be aligned */
+        if ((static_cast<std::size_t>(offset) + sizeof(std::uint32_t)) > size) {
+            return 0;
+        }
+        std::uint32_t word;
+        std::memcpy(&word, &data[offset], sizeof(word));
+        return word;
+    }
+
+    auto Hyphenator::getCode(std::uint32_t codepoint) const -> std::uint16_t
+    {
+        if (readWord(alphabetOffset) == 0) {
+            const auto minCodepoint = readWord(alphabetOffset + hyb::alphabetDirectMinCodepoint);
+            const auto maxCodepoint = readWord(alphabetOffset + hyb::alphabetDirectMaxCodepoint);
+            const auto index = static_cast<std::size_t>(alphabetOffset) + hyb::alphabetDirectData + (codepoint - minCodepoint);
+            if ((codepoint < minCodepoint) || (codepoint >= maxCodepoint) || (index >= size)) {
+                return 0;
+            }
+            return data[index];
+        }
+
+        /* Binary search in the list sorted by codepoint */
+        std::uint32_t low = 0;
+        std::uint32_t high = readWord(alphabetOffset + hyb::alphabetListCount);
+        while (low < high) {
+            const auto middle = low + (high - low) / 2;
+            const auto entry = readWord(alphabetOffset + hyb::alphabetListData + middle * 4);
+            const auto entryCodepoint = entry >> hyb::alphabetListCodeBits;
+            if (entryCodepoint == codepoint) {
+                return static_cast<std::uint16_t>(entry & ((1 << hyb::alphabetListCodeBits) - 1));
+            }
+            if (entryCodepoint < codepoint) {
+                low = middle + 1;
+            }
+            else {
+                high = middle;
+            }
+        }
+        return 0;
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace gui
+{
+    /* Liang's hyphenation with TeX patterns. Patterns are compiled into the packed trie format
+     * of Android's minikin (.hyb), which is used directly from flash, without parsing or copying. */
+    class Hyphenator
+    {
+        public:
+            /* Returns hyphenator for language tag like "en-GB", nullptr if there are no patterns for the language */
+            [[nodiscard]] static auto forLanguage(std::string_view language) -> const Hyphenator *;
+
+            Hyphenator(std::string_view language, const std::uint8_t *data, std::size_t size, std::uint8_t minPrefix, std::uint8_t minSuffix);
+
+            /* Fills points with ascending byte offsets in the word, before which it can be broken with a hyphen.
+             * Characters that are not letters of the language (quotes, digits) are skipped at both ends of the word,
+             * word containing them anywhere else is not hyphenated. */
+            auto hyphenate(std::string_view word, std::vector<std::size_t> &points) const -> void;
+
+            [[nodiscard]] auto getLanguage() const -> std::string_view;
+
+        private:
+            static constexpr auto maxWordLength = 64; // In characters, longer words are not hyphenated
+
+            std::string_view language;
+            const std::uint8_t *data;
+            std::size_t size;
+            std::uint8_t minPrefix;
+            std::uint8_t minSuffix;
+            bool isValid;
+
+            /* Offsets in data, read from the header */
+            std::uint32_t alphabetOffset;
+            std::uint32_t trieOffset;
+            std::uint32_t patternOffset;
+
+            [[nodiscard]] auto readWord(std::uint32_t offset) const -> std::uint32_t;
+            [[nodiscard]] auto getCode(std::uint32_t codepoint) const -> std::uint16_t;
+    };
+}
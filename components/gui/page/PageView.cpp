@@ -1,6 +1,17 @@
 #include "PageView.hpp"
+#include "Paginator.hpp"
+#include "TextLayout.hpp"
+#include "Hyphenator.hpp"
+#include "BookIndexer.hpp"
+#include "StatusBar.hpp"
+#include "Settings.hpp"
+#include "SettingsView.hpp"
+#include "ImageCache.hpp"
+#include "ReadingFonts.hpp"
+#include "CompressedFonts.hpp"
 #include "style/Style.hpp"
-#include "Fonts.h"
+#include <reading_state.h>
+#include <eink_worker.h>
 #include <lvgl.h>
 #include <utils.h>
 #include <esp_log.h>
@@ -13,117 +24,281 @@ namespace gui
     {
         enum class PageDirection
         {
-            First,
             Previous,
             Next
         };
 
-        constexpr auto noExcessChar = std::numeric_limits<std::size_t>::max();
+        struct PageImage
+        {
+            std::size_t blockIndex;
+            std::unique_ptr<GrayImage> image;
+        };
 
         const Epub *currentEpub;
-        std::size_t pageIndex;
+        EpubSection section;
         std::size_t spineIndex;
-        std::vector<lv_obj_t *> pages;
-
-        auto renderNextSection(PageDirection direction) -> void;
+        std::size_t pageIndex;
+        lv_obj_t *page;
+        lv_timer_t *progressTimer;
+        Paginator paginator{{style::width, style::height, 0, false}}; // Layout of the settings is set on create
+        std::vector<Paginator::Line> pageLines;
+        std::vector<PageImage> pageImages;
 
-        auto isAtFirstPage() -> bool
+        auto isBookBeginning() -> bool
         {
-            return pageIndex == 0;
+            /* TODO this is probably bad idea */
+            if (currentEpub->getTableOfContent().empty()) {
+                return spineIndex == 0;
+            }
+            const auto &firstTocItem = currentEpub->getTableOfContent().front();
+            const auto firstTocSpineIndex = currentEpub->getSpineEntryIndex(currentEpub->getTocHref(firstTocItem));
+            return (spineIndex == 0) || (spineIndex == firstTocSpineIndex);
         }
 
-        auto getLastPageIndex() -> std::size_t
+        auto isBookEnd() -> bool
         {
-            return pages.size() - 1;
+            return spineIndex == (currentEpub->getSpineItemsCount() - 1);
         }
 
-        auto isAtLastPage() -> bool
+        auto getCurrentPosition() -> const EpubPosition &
         {
-            return pageIndex >= getLastPageIndex();
+            return paginator.getPageStart(pageIndex);
         }
 
-        auto isSectionEnd(const EpubSection &section, std::size_t blockIndex) -> bool
+        auto saveReadingState() -> void
         {
-            return blockIndex >= section.getBlocks().size();
+            const auto &bookPath = currentEpub->getPath().native();
+            if (bookPath.size() >= READING_STATE_BOOK_PATH_MAX_LENGTH) {
+                ESP_LOGW(TAG, "Book path too long to save reading state: '%s'", bookPath.c_str());
+                return;
+            }
+
+            const auto &position = getCurrentPosition();
+            reading_state_t state{};
+            bookPath.copy(state.book_path, bookPath.size());
+            state.spine_index = position.spineIndex;
+            state.block_index = position.blockIndex;
+            state.byte_offset = position.blockOffsetBytes;
+
+            const auto err = reading_state_save(&state);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to save reading state, error: %s", esp_err_to_name(err));
+            }
         }
 
-        auto isBookBeginning() -> bool
+        auto updateProgress() -> void
         {
-            /* TODO this is probably bad idea */
-            const auto &firstTocItem = currentEpub->getTableOfContent().at(0);
-            return spineIndex == currentEpub->getSpineEntryIndex(firstTocItem.contentPath);
+            /* Global page number is known only after all sections before the current one are indexed */
+            const auto progress = bookIndexerGetProgress(spineIndex);
+            char buffer[32];
+            if (progress.complete) {
+                snprintf(buffer, sizeof(buffer), "%zu / %zu", progress.pagesBefore + pageIndex + 1, progress.pagesTotal);
+            }
+            else if (progress.sectionsCount > 0) {
+                snprintf(buffer, sizeof(buffer), "Indexing %zu%%", (progress.sectionsIndexed * 100) / progress.sectionsCount);
+            }
+            else {
+                buffer[0] = '\0';
+            }
+            statusBarSetProgress(buffer);
         }
 
-        auto isBookEnd() -> bool
+        auto progressTimerCallback(lv_timer_t *timer) -> void
         {
-            return spineIndex == (currentEpub->getSpineItemsCount() - 1);
+            updateProgress();
+            if (bookIndexerIsIdle()) {
+                lv_timer_pause(timer);
+            }
         }
 
-        auto cleanupSection() -> void
+        auto drawPageCallback(lv_event_t *event) -> void
         {
-            for (auto page : pages) {
-                lv_obj_del_async(page);
+            const auto drawCtx = lv_event_get_draw_ctx(event);
+            const auto &blocks = section.getBlocks();
+
+            lv_draw_label_dsc_t labelDsc;
+            lv_draw_label_dsc_init(&labelDsc);
+            lv_obj_init_draw_label_dsc(page, LV_PART_MAIN, &labelDsc);
+
+            lv_area_t coords;
+            lv_obj_get_content_coords(page, &coords);
+
+            lv_draw_img_dsc_t imageDsc;
+            lv_draw_img_dsc_init(&imageDsc);
+
+            for (const auto &line : pageLines) {
+                const auto &block = blocks[line.blockIndex];
+                const lv_point_t position = {static_cast<lv_coord_t>(coords.x1 + line.x), static_cast<lv_coord_t>(coords.y1 + line.y)};
+
+                /* Only lines crossing the invalidated area are drawn */
+                if (((position.y + line.height) <= drawCtx->clip_area->y1) || (position.y > drawCtx->clip_area->y2)) {
+                    continue;
+                }
+                if (block.image.empty()) {
+                    textLayoutDrawLine(drawCtx, labelDsc, block, line, position);
+                    continue;
+                }
+
+                /* Pictures are centered horizontally */
+                const auto it = std::find_if(pageImages.begin(), pageImages.end(), [&line](const auto &pageImage) {
+                    return pageImage.blockIndex == line.blockIndex;
+                });
+                if (it == pageImages.end()) {
+                    continue;
+                }
+                const auto &image = *it->image;
+                lv_area_t imageArea;
+                imageArea.x1 = static_cast<lv_coord_t>(coords.x1 + ((lv_area_get_width(&coords) - image.getWidth()) / 2));
+                imageArea.y1 = position.y;
+                imageArea.x2 = static_cast<lv_coord_t>(imageArea.x1 + image.getWidth() - 1);
+                imageArea.y2 = static_cast<lv_coord_t>(imageArea.y1 + image.getHeight() - 1);
+                lv_draw_img(drawCtx, &imageDsc, &imageArea, image.getDescriptor());
             }
-            pages.clear();
         }
 
-        auto handlePreviousAtFirstSectionPage() -> void
+        auto getImageHeight(const std::string &imagePath, lv_coord_t maxWidth, lv_coord_t maxHeight) -> lv_coord_t
         {
-            if (isBookBeginning()) {
-                ESP_LOGW(TAG, "Reached beginning of the book!");
+            const auto size = imageCacheGetSize(*currentEpub, imagePath, {static_cast<std::uint16_t>(maxWidth), static_cast<std::uint16_t>(maxHeight)});
+            return size.has_value() ? size->height : 0;
+        }
+
+        auto loadPageImages() -> void
+        {
+            /* Decoded only on the first view, the indexer usually has them cached by then */
+            const auto &blocks = section.getBlocks();
+            const auto &layout = paginator.getLayout();
+            const auto maxSize = ImageSize{static_cast<std::uint16_t>(layout.width), static_cast<std::uint16_t>(layout.height)};
+
+            pageImages.clear();
+            for (const auto &line : pageLines) {
+                const auto &imagePath = blocks[line.blockIndex].image;
+                if (imagePath.empty()) {
+                    continue;
+                }
+                if (auto image = imageCacheLoad(*currentEpub, imagePath, maxSize)) {
+                    pageImages.push_back({line.blockIndex, std::move(image)});
+                }
             }
-            else {
-                ESP_LOGI(TAG, "First page - rendering previous section");
-                renderNextSection(PageDirection::Previous);
-                pageIndex = getLastPageIndex();
-                lv_obj_clear_flag(pages[pageIndex], LV_OBJ_FLAG_HIDDEN);
+
+            /* Gray levels need slower refresh, pages with text only keep the fast one */
+            eink_worker_set_grayscale(!pageImages.empty());
+        }
+
+        auto renderPage() -> void
+        {
+            /* Page is a single object drawing its lines directly, there is no layout work on page turn */
+            pageLines = paginator.getPageLines(section, pageIndex);
+            loadPageImages();
+            lv_obj_invalidate(page);
+
+            updateProgress();
+            saveReadingState();
+        }
+
+        auto loadSection(std::size_t newSpineIndex) -> bool
+        {
+            try {
+                section = currentEpub->getSection(newSpineIndex);
+            } catch (std::exception &e) {
+                ESP_LOGE(TAG, "Exception for section@%zu: '%s'", newSpineIndex, e.what());
+                section = {};
             }
+
+            ESP_LOGI(TAG, "Pagination started...");
+            auto start = lv_tick_get();
+            paginator.paginate(section, newSpineIndex);
+            auto end = lv_tick_get();
+            ESP_LOGW(TAG, "Pagination time %lums, %zu pages", end - start, paginator.getPagesCount());
+
+            const auto glyphs = readingFontsGetCacheStatistics();
+            ESP_LOGI(TAG, "Glyph cache: %lu hits, %lu misses, %lu evictions, %zu/%zu bytes",
+                     glyphs.hits, glyphs.misses, glyphs.evictions, glyphs.size, glyphs.capacity);
+            const auto compressed = compressedFontsGetStatistics();
+            ESP_LOGI(TAG, "Compressed fonts: %lu hits, %lu decoded in %lu us, %zu/%zu bytes",
+                     compressed.glyphs.hits, compressed.glyphs.misses, compressed.decodeTimeUs, compressed.glyphs.size, compressed.glyphs.capacity);
+            const auto advances = textLayoutGetAdvanceStatistics();
+            ESP_LOGI(TAG, "Letter widths: %lu hits, %lu measured, %zu bytes", advances.hits, advances.misses, advances.size);
+
+            spineIndex = newSpineIndex;
+            return paginator.getPagesCount() > 0;
         }
 
-        auto handleNextAtLastSectionPage() -> void
+        auto loadAdjacentSection(PageDirection direction) -> bool
         {
-            if (isBookEnd()) {
-                ESP_LOGW(TAG, "Reached end of the book!");
+            const auto originalSpineIndex = spineIndex;
+
+            /* Skip sections with nothing to show */
+            while (true) {
+                if ((direction == PageDirection::Previous) && isBookBeginning()) {
+                    ESP_LOGW(TAG, "Reached beginning of the book!");
+                    break;
+                }
+                if ((direction == PageDirection::Next) && isBookEnd()) {
+                    ESP_LOGW(TAG, "Reached end of the book!");
+                    break;
+                }
+
+                const auto newSpineIndex = (direction == PageDirection::Next) ? (spineIndex + 1) : (spineIndex - 1);
+                if (loadSection(newSpineIndex)) {
+                    return true;
+                }
             }
-            else {
-                ESP_LOGI(TAG, "Last page - rendering next section");
-                renderNextSection(PageDirection::Next);
-                pageIndex = 0;
-                lv_obj_clear_flag(pages[pageIndex], LV_OBJ_FLAG_HIDDEN);
+
+            /* Nothing to display in that direction, stay where we were */
+            if (spineIndex != originalSpineIndex) {
+                loadSection(originalSpineIndex);
             }
+            return false;
         }
 
         auto turnPage(PageDirection direction) -> void
         {
+            bookIndexerDefer();
+
             switch (direction) {
-                case PageDirection::First:
-                    lv_obj_add_flag(pages[pageIndex], LV_OBJ_FLAG_HIDDEN);
-                    pageIndex = 0;
-                    lv_obj_clear_flag(pages[pageIndex], LV_OBJ_FLAG_HIDDEN);
-                    break;
                 case PageDirection::Previous:
-                    if (isAtFirstPage()) {
-                        handlePreviousAtFirstSectionPage();
+                    if (pageIndex > 0) {
+                        pageIndex--;
                     }
                     else {
-                        lv_obj_add_flag(pages[pageIndex], LV_OBJ_FLAG_HIDDEN);
-                        pageIndex--;
-                        lv_obj_clear_flag(pages[pageIndex], LV_OBJ_FLAG_HIDDEN);
+                        ESP_LOGI(TAG, "First page - loading previous section");
+                        if (!loadAdjacentSection(direction)) {
+                            return;
+                        }
+                        pageIndex = paginator.getPagesCount() - 1;
                     }
                     break;
                 case PageDirection::Next:
-                    if (isAtLastPage()) {
-                        handleNextAtLastSectionPage();
+                    if ((pageIndex + 1) < paginator.getPagesCount()) {
+                        pageIndex++;
                     }
                     else {
-                        lv_obj_add_flag(pages[pageIndex], LV_OBJ_FLAG_HIDDEN);
-                        pageIndex++;
-                        lv_obj_clear_flag(pages[pageIndex], LV_OBJ_FLAG_HIDDEN);
+                        ESP_LOGI(TAG, "Last page - loading next section");
+                        if (!loadAdjacentSection(direction)) {
+                            return;
+                        }
+                        pageIndex = 0;
                     }
                     break;
                 default:
                     break;    
             }
+
+            renderPage();
+        }
+
+        auto closePage() -> void
+        {
+            lv_timer_del(progressTimer);
+            progressTimer = nullptr;
+            statusBarSetProgress("");
+
+            lv_obj_del_async(page);
+            page = nullptr;
+            pageLines.clear();
+            pageImages.clear();
+            eink_worker_set_grayscale(false);
+            section = {};
         }
 
         auto onSwipeCallback(lv_event_t *event) -> void
@@ -137,14 +312,25 @@ namespace gui
                     turnPage(PageDirection::Previous);
                     break;
                 case LV_DIR_BOTTOM:
-                    cleanupSection();
+                    closePage();
+                    break;
+                case LV_DIR_TOP:
+                    settingsViewCreate();
                     break;
                 default:
                     break;
             }
         }
 
-        auto createNewPage() -> lv_obj_t *
+        auto setPageMargins() -> void
+        {
+            /* Lines are drawn relative to the content area */
+            const auto &settings = settingsGet();
+            lv_obj_set_style_pad_hor(page, settings.marginHorizontal, LV_PART_MAIN);
+            lv_obj_set_style_pad_ver(page, settings.marginVertical, LV_PART_MAIN);
+        }
+
+        auto createPage() -> lv_obj_t *
         {
             auto page = lv_obj_create(lv_scr_act());
 
@@ -153,192 +339,61 @@ namespace gui
             lv_obj_set_style_pad_all(page, 0, LV_PART_MAIN);
             lv_obj_set_style_border_side(page, LV_BORDER_SIDE_NONE, LV_PART_MAIN);
             lv_obj_add_event_cb(page, onSwipeCallback, LV_EVENT_GESTURE, nullptr);
+            lv_obj_add_event_cb(page, drawPageCallback, LV_EVENT_DRAW_MAIN, nullptr);
             lv_obj_clear_flag(page, LV_OBJ_FLAG_SCROLLABLE);
             lv_obj_clear_flag(page, LV_OBJ_FLAG_GESTURE_BUBBLE);
-            lv_obj_add_flag(page, LV_OBJ_FLAG_HIDDEN); // By default page should be invisible after creation
 
             return page;
         }
+    }
 
-        auto addBlockToPage(lv_obj_t *page, const TextBlock &textBlock, std::size_t blockOffsetBytes) -> lv_obj_t *
-        {
-            /* Add new block */
-            auto label = lv_label_create(page);
-            lv_label_set_text(label, &textBlock.text[blockOffsetBytes]);
-            lv_obj_set_width(label, style::width);
-            lv_obj_set_style_pad_bottom(label, 0, LV_PART_MAIN); // Needed to maintain line spacing between blocks
-            lv_obj_set_style_text_line_space(label, style::lineSpacing, LV_PART_MAIN);
-            switch (textBlock.font) {
-                case Font::Normal:
-                    lv_obj_set_style_text_font(label, &gui_montserrat_medium_28, LV_PART_MAIN);
-                    break;
-
-                case Font::Bold:
-                    lv_obj_set_style_text_font(label, &gui_montserrat_medium_36, LV_PART_MAIN);
-                    break;
-
-                default:
-                    break;
-            }
-            
-            /* Align to previous block if exists */
-            if (lv_obj_get_child_cnt(page) > 1) {
-                lv_obj_set_style_pad_top(label, style::lineSpacing, LV_PART_MAIN); // Maintain line spacing between blocks
-                auto previousLabelIndex = lv_obj_get_child_cnt(page) - 2; // TODO magic number?
-                auto previousLabel = lv_obj_get_child(page, previousLabelIndex);
-                lv_obj_align_to(label, previousLabel, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
-            }
-
-            /* Force update coordinates */
-            lv_obj_update_layout(page);
-
-            return label;
-        }
-
-        /* TODO this algorithm probably won't work for all cases */
-        auto getFirstExcessCharIndex(const lv_obj_t *block) -> std::size_t
-        {
-            lv_area_t area;
-            lv_obj_get_coords(block, &area);
-
-            const auto blockStartY = area.y1;
-            const auto blockEndY = area.y2;
-
-            /* The text ends before end of main area */
-            if (blockEndY <= style::main_area::maxY) {
-                return noExcessChar;
-            }
-
-            /* The text starts after the end of main area */
-            if (blockStartY >= style::main_area::maxY) {
-                return 0;
-            }
-
-            /* Compute first point not fitting on screen in local block coordinates 
-             * Assume the text is always fully aligned to the left -> x coordinate always zero */
-            lv_point_t firstExcessPointCoords = {
-                .x = 0,
-                .y = static_cast<lv_coord_t>(style::main_area::maxY - blockStartY)
-            };
-
-            if (!lv_label_is_char_under_pos(block, &firstExcessPointCoords)) {
-                return noExcessChar;
-            }
-            return lv_label_get_letter_on(block, &firstExcessPointCoords);
+    auto pageViewCreate(const Epub *epub, const EpubPosition &position) -> void
+    {
+        /* Sanity check */
+        if (epub == nullptr) {
+            return;
         }
 
-        auto renderSection(const EpubSection &section) -> void
-        {
-            std::size_t blockIndex = 0;
-            std::size_t blockOffsetBytes = 0;
-            std::size_t blockBytesLeft = 0;
-
-            const auto &blocks = section.getBlocks();
-            auto page = createNewPage();
-
-            /* Create LVGL objects with rendered text blocks for entire section */
-            while (true) {
-                const auto &block = blocks[blockIndex];
-                auto newGuiBlock = addBlockToPage(page, block, blockOffsetBytes);
-
-                const auto excessCharIndex = getFirstExcessCharIndex(newGuiBlock);
-                if (excessCharIndex == noExcessChar) { // Entire block fits on page
-                    blockBytesLeft = 0;
-                    if (isSectionEnd(section, blockIndex + 1)) { // Handle single page per block case
-                        pages.push_back(page);
-                    }
-                }
-                else if (excessCharIndex == 0) { // Not a single char fits
-                    /* Delete new block from page */
-                    lv_obj_del(newGuiBlock);
-
-                    /* Add current page to pages vector and create new page */
-                    pages.push_back(page);
-                    page = createNewPage();
-                }
-                else if (excessCharIndex > 0) { // Block fits partially
-                    /* Remove excess part */
-                    lv_label_cut_text(newGuiBlock, excessCharIndex, LV_LABEL_POS_LAST);
-
-                    /* Convert char index to byte offset and update sizes */
-                    const auto bytesAdded = _lv_txt_encoded_get_byte_id(block.text.c_str(), excessCharIndex);
-                    blockOffsetBytes += bytesAdded;
-                    blockBytesLeft -= bytesAdded;
-                    
-                    /* Add current page to pages vector and create new page */
-                    pages.push_back(page);
-                    page = createNewPage();
-                }
-
-                /* Entire block rendered, get next if possible */
-                if (blockBytesLeft == 0) {
-                    blockIndex++;
-                    if (isSectionEnd(section, blockIndex)) {
-                        ESP_LOGI(TAG, "Reached end of section");
-                        break;
-                    }
-                    else {
-                        blockOffsetBytes = 0;
-                        const auto &nextSectionBlock = blocks[blockIndex];
-                        blockBytesLeft = nextSectionBlock.text.length();
-                    }
-                }
-            }
+        /* Initialize context */
+        currentEpub = epub;
+        paginator.setLayout(settingsGetLayout());
+        paginator.setImageHeightGetter(getImageHeight);
+        paginator.setHyphenator(Hyphenator::forLanguage(epub->getLanguage()));
+        spineIndex = position.spineIndex;
+        if (!loadSection(position.spineIndex) && !loadAdjacentSection(PageDirection::Next)) {
+            ESP_LOGW(TAG, "Nothing to display from section@%zu onwards", position.spineIndex);
+            return;
         }
 
-        auto renderNextSection(PageDirection direction) -> void
-        {
-            /* Remove previous section */
-            cleanupSection();
-
-            /* Get next section */
-            switch (direction) {
-                case PageDirection::First:
-                    break;
-                case PageDirection::Previous:
-                    spineIndex--;
-                    break;
-                case PageDirection::Next:
-                    spineIndex++;
-                    break;
-                default:
-                    ESP_LOGE(TAG, "Invalid PageDirection!");
-                    break;
-            }
-
-            /* Render section */
-            EpubSection section;
-            try {
-                section = currentEpub->getSection(spineIndex);
-            } catch (std::exception &e) {
-                ESP_LOGE(TAG, "Exception for section@%zu: '%s'", spineIndex, e.what());
-                return;
-            }
-
-            ESP_LOGI(TAG, "Rendering started...");
-            auto start = lv_tick_get();
-            renderSection(section);
-            auto end = lv_tick_get();
-            ESP_LOGW(TAG, "Rendering time %lums", end - start);
+        /* Show page containing requested position */
+        if (page == nullptr) {
+            page = createPage();
+            progressTimer = lv_timer_create(progressTimerCallback, style::progressUpdatePeriodMs, nullptr);
         }
+        setPageMargins();
+        lv_timer_resume(progressTimer);
+        pageIndex = paginator.getPageIndex(position);
+        renderPage();
     }
 
-    auto pageViewCreate(const Epub *epub, std::size_t spineEntryIndex) -> void
+    auto pageViewRelayout() -> void
     {
-        /* Sanity check */
-        if (epub == nullptr) {
+        if (page == nullptr) {
             return;
         }
 
-        /* Initialize context */
-        currentEpub = epub;
-        pageIndex = 0;
-        spineIndex = spineEntryIndex;
-
-        /* Render pages for first section */
-        renderNextSection(PageDirection::First);
-            
-        /* Show first page */
-        turnPage(PageDirection::First);
+        /* Page boundaries move, but the first character of the displayed page stays visible */
+        const auto position = getCurrentPosition();
+        paginator.setLayout(settingsGetLayout());
+        setPageMargins();
+
+        /* Only the current section is laid out now, cached page counts of others no longer match the layout hash */
+        paginator.paginate(section, spineIndex);
+        pageIndex = paginator.getPageIndex(position);
+        renderPage();
+
+        /* Page counts of the whole book have to be recomputed too */
+        bookIndexerStart(currentEpub->getPath(), paginator.getLayout());
+        lv_timer_resume(progressTimer);
     }
 }
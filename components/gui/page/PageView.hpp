@@ -1,8 +1,11 @@
 #pragma once
 
+#include "Paginator.hpp"
 #include <Epub.hpp>
+#include <EpubPosition.hpp>
 
 namespace gui
 {
-    auto pageViewCreate(const Epub *epub, std::size_t spineEntryIndex) -> void; // TODO error handling
+    auto pageViewCreate(const Epub *epub, const EpubPosition &position) -> void; // TODO error handling
+    auto pageViewRelayout() -> void;
 }
@@ -0,0 +1,238 @@
+#include "Paginator.hpp"
+#include "TextLayout.hpp"
+#include "ParagraphBreaker.hpp"
+#include "ReadingFonts.hpp"
+#include <algorithm>
+
+namespace gui
+{
+    Paginator::Paginator(const Layout &layout) : layout{layout}, hyphenator{nullptr}, spineIndex{0}, blocksCount{0} {}
+
+    auto Paginator::paginate(const EpubSection &section, std::size_t spineIndex) -> void
+    {
+        const auto &blocks = section.getBlocks();
+
+        this->spineIndex = spineIndex;
+        blocksCount = blocks.size();
+        pageStarts.clear();
+        if (blocks.empty()) {
+            return;
+        }
+
+        /* Start is a copy, page starts are reallocated as the pages are added */
+        const EpubPosition start{spineIndex, 0, 0};
+        pageStarts.push_back(start);
+        layoutLines(section, start, [this](const Line &line, bool isPageStart) {
+            if (isPageStart) {
+                pageStarts.push_back({this->spineIndex, line.blockIndex, line.start});
+            }
+            return true;
+        });
+    }
+
+    auto Paginator::setLayout(const Layout &layout) -> void
+    {
+        this->layout = layout;
+    }
+
+    auto Paginator::setImageHeightGetter(ImageHeightGetter getter) -> void
+    {
+        imageHeightGetter = std::move(getter);
+    }
+
+    auto Paginator::setHyphenator(const Hyphenator *hyphenator) -> void
+    {
+        this->hyphenator = hyphenator;
+    }
+
+    auto Paginator::getLayout() const -> const Layout &
+    {
+        return layout;
+    }
+
+    auto Paginator::getLayoutHash() const -> std::uint32_t
+    {
+        /* FNV-1a over everything that affects page breaks */
+        const auto &normalFont = *getBlockFont(Font::Normal);
+        const auto &boldFont = *getBlockFont(Font::Bold);
+        const std::int32_t parameters[] = {
+            layoutAlgorithmVersion, layout.width, layout.height, layout.lineSpacing, layout.isOptimalLineBreaking,
+            normalFont.line_height, normalFont.base_line, 
+            boldFont.line_height, boldFont.base_line
+        };
+
+        std::uint32_t hash = 2166136261;
+        for (const auto parameter : parameters) {
+            for (std::size_t byte = 0; byte < sizeof(parameter); ++byte) {
+                hash ^= (parameter >> (byte * 8)) & 0xFF;
+                hash *= 16777619;
+            }
+        }
+        if (hyphenator != nullptr) {
+            for (const auto c : hyphenator->getLanguage()) {
+                hash ^= static_cast<std::uint8_t>(c);
+                hash *= 16777619;
+            }
+        }
+        for (const auto c : readingFontsGetFamily()) {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 16777619;
+        }
+        return hash;
+    }
+
+    auto Paginator::getPagesCount() const -> std::size_t
+    {
+        return pageStarts.size();
+    }
+
+    auto Paginator::getPageStart(std::size_t pageIndex) const -> const EpubPosition &
+    {
+        return pageStarts.at(pageIndex);
+    }
+
+    auto Paginator::getPageEnd(std::size_t pageIndex) const -> EpubPosition
+    {
+        if ((pageIndex + 1) < pageStarts.size()) {
+            return pageStarts[pageIndex + 1];
+        }
+        return {spineIndex, blocksCount, 0};
+    }
+
+    auto Paginator::getPageIndex(const EpubPosition &position) const -> std::size_t
+    {
+        /* Find the last page starting at or before the position */
+        const auto it = std::upper_bound(pageStarts.begin(), pageStarts.end(), position);
+        return (it == pageStarts.begin()) ? 0 : std::distance(pageStarts.begin(), it) - 1;
+    }
+
+    auto Paginator::getPageLines(const EpubSection &section, std::size_t pageIndex) const -> std::vector<Line>
+    {
+        /* Lines are not stored for the whole section, only the displayed page is laid out again */
+        std::vector<Line> lines;
+        layoutLines(section, getPageStart(pageIndex), [&lines](const Line &line, bool isPageStart) {
+            if (isPageStart) {
+                return false;
+            }
+            lines.push_back(line);
+            return true;
+        });
+        return lines;
+    }
+
+    auto Paginator::layoutLines(const EpubSection &section, const EpubPosition &from, const LineCallback &callback) const -> void
+    {
+        /* Lines of a block are separated by line spacing, blocks are separated by line spacing and their collapsed
+         * vertical margins, except the first block on a page. Hidden blocks take no lines. */
+        const auto &blocks = section.getBlocks();
+        ParagraphBreaker paragraphBreaker;
+        std::vector<LineBreak> paragraphLines;
+        lv_coord_t y = 0;
+        lv_coord_t previousMarginBottom = 0;
+        for (auto blockIndex = from.blockIndex; blockIndex < blocks.size(); ++blockIndex) {
+            const auto &block = blocks[blockIndex];
+            const auto &style = section.getBlockStyle(block);
+            if (style.isHidden) {
+                continue;
+            }
+
+            const auto &text = block.text;
+            const auto font = getBlockFont(block.font); // Faces of style runs have the same line height
+            auto lineHeight = lv_font_get_line_height(font);
+
+            /* Lengths of the style are in hundredths of em, line height of the block font stands for em.
+             * Margins are limited, so that a badly styled book still has room for text. */
+            const auto toPixels = [lineHeight](std::int16_t length) {
+                return static_cast<lv_coord_t>((static_cast<std::int32_t>(length) * lineHeight) / 100);
+            };
+            const auto marginLeft = std::clamp<lv_coord_t>(toPixels(style.marginLeft), 0, layout.width / 4);
+            const auto marginRight = std::clamp<lv_coord_t>(toPixels(style.marginRight), 0, layout.width / 4);
+            const auto textWidth = static_cast<lv_coord_t>(layout.width - marginLeft - marginRight);
+            const auto textIndent = std::clamp<lv_coord_t>(toPixels(style.textIndent), -marginLeft, textWidth / 2);
+            const auto marginTop = std::clamp<lv_coord_t>(std::max(previousMarginBottom, toPixels(style.marginTop)), 0, layout.height / 4);
+            previousMarginBottom = toPixels(style.marginBottom);
+
+            /* Picture that can't be shown takes an empty line, so that block positions stay valid */
+            const auto isImage = !block.image.empty();
+            if (isImage && imageHeightGetter) {
+                const auto imageHeight = imageHeightGetter(block.image, layout.width, layout.height);
+                lineHeight = (imageHeight > 0) ? imageHeight : lineHeight;
+            }
+
+            std::size_t offset = (blockIndex == from.blockIndex) ? from.blockOffsetBytes : 0;
+
+            /* Paragraph is always broken from its start, so that a page starting inside it gets the same lines */
+            const auto isParagraph = !isImage && layout.isOptimalLineBreaking && (style.textAlign == TextAlign::Justify) &&
+                                     paragraphBreaker.breakParagraph(block, textWidth - textIndent, textWidth, hyphenator, paragraphLines);
+            std::size_t paragraphLineIndex = 0;
+            if (isParagraph) {
+                std::size_t lineStart = 0;
+                while (((paragraphLineIndex + 1) < paragraphLines.size()) && ((lineStart + paragraphLines[paragraphLineIndex].length) <= offset)) {
+                    lineStart += paragraphLines[paragraphLineIndex].length;
+                    paragraphLineIndex++;
+                }
+                offset = lineStart;
+            }
+
+            bool isFirstLine = true;
+            bool isPageStart = false;
+            do {
+                /* Indentation applies to the first line of the block only, not to the first line of a page */
+                const auto isIndented = (offset == 0);
+                const auto lineWidth = static_cast<lv_coord_t>(textWidth - (isIndented ? textIndent : 0));
+                auto lineBreak = LineBreak{0, false};
+                if (isParagraph) {
+                    lineBreak = paragraphLines[paragraphLineIndex];
+                }
+                else if (!isImage) {
+                    lineBreak = textLayoutBreakLine(block, offset, lineWidth, hyphenator);
+                }
+                const auto lineLength = lineBreak.length;
+                const auto isFirstOnPage = (y == 0);
+                const auto spacing = layout.lineSpacing + (isFirstLine ? marginTop : 0);
+                const auto lineTop = isFirstOnPage ? 0 : (y + spacing);
+
+                /* Line does not fit, start new page with it - unless the page is empty, then it has to be cut anyway */
+                if (((lineTop + lineHeight) > layout.height) && !isFirstOnPage) {
+                    isPageStart = true;
+                    y = 0;
+                    continue;
+                }
+
+                /* Last line of a justified block is aligned to the left */
+                auto lineX = static_cast<lv_coord_t>(marginLeft + (isIndented ? textIndent : 0));
+                lv_coord_t justifiedWidth = 0;
+                if (!isImage && ((style.textAlign == TextAlign::Center) || (style.textAlign == TextAlign::Right))) {
+                    const auto freeWidth = std::max<lv_coord_t>(lineWidth - textLayoutGetLineWidth(block, offset, offset + lineLength, lineBreak.isHyphenated), 0);
+                    lineX += (style.textAlign == TextAlign::Center) ? (freeWidth / 2) : freeWidth;
+                }
+                else if (!isImage && (style.textAlign == TextAlign::Justify) && ((offset + lineLength) < text.size())) {
+                    justifiedWidth = lineWidth;
+                }
+
+                const auto line = Line{
+                    blockIndex, offset, offset + lineLength, lineX, static_cast<lv_coord_t>(lineTop),
+                    static_cast<lv_coord_t>(lineHeight), justifiedWidth, lineBreak.isHyphenated
+                };
+                if (!callback(line, isPageStart)) {
+                    return;
+                }
+                isPageStart = false;
+
+                y = lineTop + lineHeight;
+                offset += lineLength;
+                paragraphLineIndex++;
+                isFirstLine = false;
+
+                if (lineLength == 0) { // Empty block still takes one line
+                    break;
+                }
+            } while (isFirstLine || (offset < text.size()));
+        }
+    }
+
+    auto Paginator::getBlockFont(Font font) -> const lv_font_t *
+    {
+        return readingFontsGet(font);
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Hyphenator.hpp"
+#include <EpubSection.hpp>
+#include <EpubPosition.hpp>
+#include <lvgl.h>
+#include <vector>
+#include <functional>
+#include <string>
+#include <cstdint>
+
+namespace gui
+{
+    /* Splits a section into pages by measuring lines of text, without creating any LVGL
+     * objects. Pages are identified by the position of their first character, so a position
+     * can be mapped back to a page after relayout with different fonts or spacing. */
+    class Paginator
+    {
+        public:
+            struct Layout
+            {
+                lv_coord_t width;
+                lv_coord_t height;
+                lv_coord_t lineSpacing;
+                bool isOptimalLineBreaking; // Justified blocks are broken as whole paragraphs, not line by line
+            };
+
+            /* Line of a block, x and y are the top left corner of the line relative to the page, x includes margins,
+             * indentation and alignment. Image block is a single line as high as the picture, centered on the page. */
+            struct Line
+            {
+                std::size_t blockIndex;
+                std::size_t start;
+                std::size_t end;
+                lv_coord_t x;
+                lv_coord_t y;
+                lv_coord_t height;
+                lv_coord_t width; // Width the line is justified to, 0 if it's not justified
+                bool isHyphenated;
+            };
+
+            /* Returns height of the picture fitted in the given area, 0 if it can't be shown */
+            using ImageHeightGetter = std::function<lv_coord_t(const std::string &imagePath, lv_coord_t maxWidth, lv_coord_t maxHeight)>;
+
+            explicit Paginator(const Layout &layout);
+
+            auto paginate(const EpubSection &section, std::size_t spineIndex) -> void;
+            auto setLayout(const Layout &layout) -> void;
+            auto setImageHeightGetter(ImageHeightGetter getter) -> void;
+            auto setHyphenator(const Hyphenator *hyphenator) -> void; // Nullptr disables hyphenation
+
+            [[nodiscard]] auto getLayout() const -> const Layout &;
+            [[nodiscard]] auto getLayoutHash() const -> std::uint32_t;
+            [[nodiscard]] auto getPagesCount() const -> std::size_t;
+            [[nodiscard]] auto getPageStart(std::size_t pageIndex) const -> const EpubPosition &;
+            [[nodiscard]] auto getPageEnd(std::size_t pageIndex) const -> EpubPosition;
+            [[nodiscard]] auto getPageIndex(const EpubPosition &position) const -> std::size_t;
+            [[nodiscard]] auto getPageLines(const EpubSection &section, std::size_t pageIndex) const -> std::vector<Line>;
+
+            [[nodiscard]] static auto getBlockFont(Font font) -> const lv_font_t *;
+
+        private:
+            static constexpr auto layoutAlgorithmVersion = 7; // Bump when line breaking changes, invalidates cached page counts
+
+            Layout layout;
+            ImageHeightGetter imageHeightGetter;
+            const Hyphenator *hyphenator;
+            std::size_t spineIndex;
+            std::size_t blocksCount;
+            std::vector<EpubPosition> pageStarts;
+
+            /* Callback gets each line and whether it starts a new page, returns false to stop */
+            using LineCallback = std::function<bool(const Line &line, bool isPageStart)>;
+
+            auto layoutLines(const EpubSection &section, const EpubPosition &from, const LineCallback &callback) const -> void;
+    };
+}
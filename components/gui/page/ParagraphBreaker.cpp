@@ -0,0 +1,240 @@
+#include "ParagraphBreaker.hpp"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <string_view>
+#include <cmath>
+
+namespace gui
+{
+    namespace
+    {
+        /* Parameters of TeX's plain format, ratios of stretch and shrink to the width of a space are LaTeX's */
+        constexpr auto stretchRatio = 0.5f;
+        constexpr auto shrinkRatio = 1.0f / 3.0f;
+        constexpr auto tolerance = 10.0f; // Maximum adjustment ratio, narrow pages need loose lines
+        constexpr auto linePenalty = 10.0f;
+        constexpr auto hyphenPenalty = 50.0f;
+        constexpr auto doubleHyphenDemerits = 3000.0f;
+        constexpr auto fitnessDemerits = 100.0f;
+        constexpr auto maxBadness = 10000.0f;
+
+        constexpr auto noIndex = std::numeric_limits<std::uint32_t>::max();
+        constexpr auto infinity = std::numeric_limits<float>::infinity();
+
+        /* Lines are tight, decent, loose or very loose, neighbours shouldn't differ by more than one class */
+        auto getFitness(float ratio) -> std::uint8_t
+        {
+            if (ratio < -0.5f) {
+                return 0;
+            }
+            if (ratio <= 0.5f) {
+                return 1;
+            }
+            if (ratio <= 1.0f) {
+                return 2;
+            }
+            return 3;
+        }
+    }
+
+    auto ParagraphBreaker::breakParagraph(const TextBlock &block, lv_coord_t firstLineWidth, lv_coord_t lineWidth,
+                                          const Hyphenator *hyphenator, std::vector<LineBreak> &lines) -> bool
+    {
+        lines.clear();
+        if (!findBreakpoints(block, hyphenator) || !findBreaks(firstLineWidth, lineWidth)) {
+            return false;
+        }
+
+        /* Active nodes are all at the end of the paragraph now, the best one is followed back to the start */
+        const auto best = *std::min_element(active.begin(), active.end(), [this](auto a, auto b) {
+            return nodes[a].demerits < nodes[b].demerits;
+        });
+        for (auto index = best; nodes[index].breakpoint != noIndex; index = nodes[index].previous) {
+            const auto &breakpoint = breakpoints[nodes[index].breakpoint];
+            lines.push_back({breakpoint.end, breakpoint.kind == BreakKind::Hyphen});
+        }
+        std::reverse(lines.begin(), lines.end());
+
+        /* Ends are converted to lengths */
+        std::size_t start = 0;
+        for (auto &line : lines) {
+            const auto end = line.length;
+            line.length = end - start;
+            start = end;
+        }
+        return true;
+    }
+
+    auto ParagraphBreaker::findBreakpoints(const TextBlock &block, const Hyphenator *hyphenator) -> bool
+    {
+        /* Lines can be broken after spaces, inside words at hyphenation points and after hyphens in the text.
+         * Spaces at the start of the block take place in the first line, the ones at its end are not drawn. */
+        const auto &text = block.text;
+        const auto textSize = static_cast<std::uint32_t>(text.size());
+        std::int32_t width = 0;
+        std::int32_t spacesWidth = 0;
+
+        breakpoints.clear();
+        std::uint32_t i = 0;
+        while (i < textSize) {
+            auto j = i;
+            if (text[i] == ' ') {
+                while ((j < textSize) && (text[j] == ' ')) {
+                    j++;
+                }
+                if (j == textSize) {
+                    break;
+                }
+                const auto spaceWidth = textLayoutGetTextWidth(block, i, j, false);
+                if (i > 0) {
+                    breakpoints.push_back({j, width, spacesWidth, spaceWidth, BreakKind::Space});
+                }
+                width += spaceWidth;
+                spacesWidth += spaceWidth;
+                i = j;
+                continue;
+            }
+
+            while ((j < textSize) && (text[j] != ' ')) {
+                j++;
+            }
+
+            /* Word with a hyphen is broken only after it, others at hyphenation points */
+            const auto word = std::string_view{text}.substr(i, j - i);
+            auto kind = BreakKind::ExplicitHyphen;
+            hyphenationPoints.clear();
+            for (auto k = word.find('-'); (k != std::string_view::npos) && ((k + 1) < word.size()); k = word.find('-', k + 1)) {
+                if ((k > 0) && (word[k + 1] != '-')) {
+                    hyphenationPoints.push_back(k + 1);
+                }
+            }
+            if (hyphenationPoints.empty() && (hyphenator != nullptr)) {
+                kind = BreakKind::Hyphen;
+                hyphenator->hyphenate(word, hyphenationPoints);
+            }
+
+            lv_coord_t partWidth = 0;
+            for (const auto point : hyphenationPoints) {
+                const auto end = i + static_cast<std::uint32_t>(point);
+                const auto nextPartWidth = textLayoutGetTextWidth(block, i, end, false);
+                const auto hyphenWidth = (kind == BreakKind::Hyphen) ? (textLayoutGetTextWidth(block, i, end, true) - nextPartWidth) : 0;
+                width += nextPartWidth - partWidth;
+                partWidth = nextPartWidth;
+                breakpoints.push_back({end, width, spacesWidth, static_cast<lv_coord_t>(hyphenWidth), kind});
+            }
+            width += textLayoutGetTextWidth(block, i, j, false) - partWidth;
+            i = j;
+
+            if (breakpoints.size() >= maxBreakpoints) {
+                return false;
+            }
+        }
+        breakpoints.push_back({textSize, width, spacesWidth, 0, BreakKind::End});
+        return true;
+    }
+
+    auto ParagraphBreaker::findBreaks(lv_coord_t firstLineWidth, lv_coord_t lineWidth) -> bool
+    {
+        struct Candidate
+        {
+            float demerits;
+            std::uint32_t node;
+        };
+
+        nodes.clear();
+        active.clear();
+        nodes.push_back({noIndex, noIndex, 0.0f, 0, 1});
+        active.push_back(0);
+
+        for (std::uint32_t b = 0; b < breakpoints.size(); ++b) {
+            const auto &breakpoint = breakpoints[b];
+            const auto isEnd = (breakpoint.kind == BreakKind::End);
+            const auto isFlagged = (breakpoint.kind == BreakKind::Hyphen) || (breakpoint.kind == BreakKind::ExplicitHyphen);
+            const auto penalty = isFlagged ? hyphenPenalty : 0.0f;
+
+            /* The best line ending here is found for each fitness class */
+            std::array<Candidate, 4> candidates;
+            candidates.fill({infinity, noIndex});
+            for (auto it = active.begin(); it != active.end();) {
+                const auto &node = nodes[*it];
+                std::int32_t startWidth = 0;
+                std::int32_t startSpacesWidth = 0;
+                auto isStartFlagged = false;
+                if (node.breakpoint != noIndex) {
+                    const auto &start = breakpoints[node.breakpoint];
+                    const auto skippedWidth = (start.kind == BreakKind::Space) ? start.breakWidth : 0;
+                    startWidth = start.width + skippedWidth;
+                    startSpacesWidth = start.spacesWidth + skippedWidth;
+                    isStartFlagged = (start.kind == BreakKind::Hyphen) || (start.kind == BreakKind::ExplicitHyphen);
+                }
+
+                /* Spaces are adjusted to fill the line exactly, the last line of the paragraph is left as it is */
+                const auto targetWidth = static_cast<float>((node.line == 0) ? firstLineWidth : lineWidth);
+                const auto naturalWidth = static_cast<float>(breakpoint.width - startWidth + ((breakpoint.kind == BreakKind::Hyphen) ? breakpoint.breakWidth : 0));
+                const auto spaces = static_cast<float>(breakpoint.spacesWidth - startSpacesWidth);
+                auto ratio = 0.0f;
+                if (naturalWidth < targetWidth) {
+                    const auto stretch = spaces * stretchRatio;
+                    ratio = isEnd ? 0.0f : ((stretch > 0.0f) ? ((targetWidth - naturalWidth) / stretch) : infinity);
+                }
+                else if (naturalWidth > targetWidth) {
+                    const auto shrink = isEnd ? 0.0f : (spaces * shrinkRatio);
+                    ratio = (shrink > 0.0f) ? ((targetWidth - naturalWidth) / shrink) : -infinity;
+                }
+
+                if ((ratio >= -1.0f) && (ratio <= tolerance)) {
+                    const auto badness = std::min(100.0f * std::abs(ratio * ratio * ratio), maxBadness);
+                    const auto fitness = getFitness(ratio);
+                    auto demerits = (linePenalty + badness) * (linePenalty + badness) + penalty * penalty;
+                    if (isFlagged && isStartFlagged) {
+                        demerits += doubleHyphenDemerits;
+                    }
+                    if (std::abs(fitness - node.fitness) > 1) {
+                        demerits += fitnessDemerits;
+                    }
+                    demerits += node.demerits;
+                    if (demerits < candidates[fitness].demerits) {
+                        candidates[fitness] = {demerits, *it};
+                    }
+                }
+
+                /* Node can't start a line that is overfull already, or that would go past the end */
+                if ((ratio < -1.0f) || isEnd) {
+                    it = active.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+
+            /* Lines of the other classes are kept only if they are not much worse than the best one */
+            const auto minDemerits = std::min_element(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) {
+                return a.demerits < b.demerits;
+            })->demerits;
+            for (std::uint8_t fitness = 0; fitness < candidates.size(); ++fitness) {
+                const auto &candidate = candidates[fitness];
+                if ((candidate.node == noIndex) || (candidate.demerits > (minDemerits + fitnessDemerits))) {
+                    continue;
+                }
+                if (nodes.size() >= maxNodes) {
+                    return false;
+                }
+                const auto line = static_cast<std::uint16_t>(nodes[candidate.node].line + 1);
+                active.push_back(static_cast<std::uint32_t>(nodes.size()));
+                nodes.push_back({b, candidate.node, candidate.demerits, line, fitness});
+            }
+
+            if (active.size() > maxActiveNodes) {
+                std::nth_element(active.begin(), active.begin() + maxActiveNodes, active.end(), [this](auto a, auto b) {
+                    return nodes[a].demerits < nodes[b].demerits;
+                });
+                active.resize(maxActiveNodes);
+            }
+            if (active.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "TextLayout.hpp"
+#include "Hyphenator.hpp"
+#include <TextBlock.hpp>
+#include <lvgl.h>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace gui
+{
+    /* Total-fit line breaking of Knuth and Plass. Breaks of the whole paragraph are chosen together,
+     * minimizing the sum of demerits of its lines, so that spaces of a justified paragraph are stretched
+     * or shrunk about the same in all of them. Memory is bounded: only a limited number of active
+     * breakpoints is kept and buffers are reused between paragraphs of one instance. */
+    class ParagraphBreaker
+    {
+        public:
+            /* Fills lines of the whole block, the first line has firstLineWidth, others lineWidth. Returns false if the
+             * block is too long or can't be broken within tolerance, then it has to be broken line by line. */
+            auto breakParagraph(const TextBlock &block, lv_coord_t firstLineWidth, lv_coord_t lineWidth,
+                                const Hyphenator *hyphenator, std::vector<LineBreak> &lines) -> bool;
+
+        private:
+            static constexpr auto maxBreakpoints = 2048; // Longer paragraphs are broken greedily
+            static constexpr auto maxNodes = 2048;
+            static constexpr auto maxActiveNodes = 32; // The worst ones are dropped above that
+
+            enum class BreakKind : std::uint8_t
+            {
+                Space,
+                Hyphen, // Inside a word, drawn with a hyphen
+                ExplicitHyphen, // After a hyphen that is in the text
+                End
+            };
+
+            /* Totals are of the paragraph before the breakpoint, stretch and shrink of spaces are derived from their width */
+            struct Breakpoint
+            {
+                std::uint32_t end; // Line broken here ends at this offset, including the spaces
+                std::int32_t width;
+                std::int32_t spacesWidth;
+                lv_coord_t breakWidth; // Width of the spaces or the hyphen
+                BreakKind kind;
+            };
+
+            struct Node
+            {
+                std::uint32_t breakpoint;
+                std::uint32_t previous;
+                float demerits; // Total of the lines up to the breakpoint
+                std::uint16_t line;
+                std::uint8_t fitness;
+            };
+
+            std::vector<Breakpoint> breakpoints;
+            std::vector<Node> nodes;
+            std::vector<std::uint32_t> active;
+            std::vector<std::size_t> hyphenationPoints;
+
+            auto findBreakpoints(const TextBlock &block, const Hyphenator *hyphenator) -> bool;
+            auto findBreaks(lv_coord_t firstLineWidth, lv_coord_t lineWidth) -> bool;
+    };
+}
@@ -0,0 +1,378 @@
+#include "TextLayout.hpp"
+#include "Paginator.hpp"
+#include "SyntheticFont.hpp"
+#include "AdvanceCache.hpp"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+#include <string_view>
+
+namespace gui
+{
+    namespace
+    {
+        /* Finds style of consecutive characters, offsets passed must not decrease */
+        class StyleCursor
+        {
+            public:
+                StyleCursor(const TextBlock &block, std::size_t offset) : block{block}
+                {
+                    const auto it = std::upper_bound(block.runs.begin(), block.runs.end(), offset, [](std::size_t offset, const StyleRun &run) {
+                        return offset < (run.offset + run.length);
+                    });
+                    runIndex = std::distance(block.runs.begin(), it);
+                }
+
+                auto getStyle(std::size_t offset) -> TextStyle
+                {
+                    const auto &runs = block.runs;
+                    while ((runIndex < runs.size()) && ((runs[runIndex].offset + runs[runIndex].length) <= offset)) {
+                        runIndex++;
+                    }
+                    if ((runIndex < runs.size()) && (runs[runIndex].offset <= offset)) {
+                        return runs[runIndex].style;
+                    }
+                    return TextStyle::Regular;
+                }
+
+                auto getFont(std::size_t offset) -> const lv_font_t *
+                {
+                    return textLayoutGetFont(block.font, getStyle(offset));
+                }
+
+            private:
+                const TextBlock &block;
+                std::size_t runIndex;
+        };
+
+        constexpr auto stylesCount = 4; // Regular, italic, bold and both
+
+        /* Faces derived from the reading fonts and widths of their letters, in the order of text styles */
+        struct Faces
+        {
+            SyntheticFont normalItalic{Paginator::getBlockFont(Font::Normal), false, true};
+            SyntheticFont normalBold{Paginator::getBlockFont(Font::Normal), true, false};
+            SyntheticFont normalBoldItalic{Paginator::getBlockFont(Font::Normal), true, true};
+            SyntheticFont headingItalic{Paginator::getBlockFont(Font::Bold), false, true};
+            SyntheticFont headingBold{Paginator::getBlockFont(Font::Bold), true, false};
+            SyntheticFont headingBoldItalic{Paginator::getBlockFont(Font::Bold), true, true};
+
+            AdvanceCache normalAdvances[stylesCount] = {
+                AdvanceCache{Paginator::getBlockFont(Font::Normal)},
+                AdvanceCache{normalItalic.get()},
+                AdvanceCache{normalBold.get()},
+                AdvanceCache{normalBoldItalic.get()}
+            };
+            AdvanceCache headingAdvances[stylesCount] = {
+                AdvanceCache{Paginator::getBlockFont(Font::Bold)},
+                AdvanceCache{headingItalic.get()},
+                AdvanceCache{headingBold.get()},
+                AdvanceCache{headingBoldItalic.get()}
+            };
+        };
+
+        /* Created on first use from any task, replaced only when no text is measured */
+        std::mutex facesMutex;
+        std::unique_ptr<Faces> faces;
+        std::atomic<Faces *> currentFaces;
+
+        auto getFaces() -> Faces &
+        {
+            if (const auto current = currentFaces.load(std::memory_order_acquire); current != nullptr) {
+                return *current;
+            }
+
+            std::lock_guard lock{facesMutex};
+            if (faces == nullptr) {
+                faces = std::make_unique<Faces>();
+                currentFaces.store(faces.get(), std::memory_order_release);
+            }
+            return *faces;
+        }
+
+        auto getAdvanceCaches(Font blockFont) -> AdvanceCache *
+        {
+            auto &current = getFaces();
+            return (blockFont == Font::Bold) ? current.headingAdvances : current.normalAdvances;
+        }
+
+        /* All measuring goes through the caches, so layout and drawing see the same widths */
+        auto getLetterWidth(Font blockFont, TextStyle style, std::uint32_t letter, std::uint32_t letterNext) -> lv_coord_t
+        {
+            return getAdvanceCaches(blockFont)[static_cast<std::size_t>(style)].getWidth(letter, letterNext);
+        }
+
+        constexpr auto noBreak = std::numeric_limits<std::uint32_t>::max();
+        constexpr std::uint32_t hyphen = '-';
+
+        auto isWordEnd(const TextBlock &block, std::uint32_t offset) -> bool
+        {
+            if (offset >= block.text.size()) {
+                return true;
+            }
+            const auto letter = _lv_txt_encoded_next(block.text.c_str(), &offset);
+            return (letter == '\n') || (letter == '\r') || _lv_txt_is_break_char(letter);
+        }
+
+        /* Port of LVGL's lv_txt_get_next_word() measuring every letter with its own font */
+        auto getNextWord(const TextBlock &block, StyleCursor &cursor, std::uint32_t start, lv_coord_t maxWidth,
+                         lv_coord_t &wordWidth, bool force) -> std::uint32_t
+        {
+            const auto text = block.text.c_str();
+            const auto textSize = static_cast<std::uint32_t>(block.text.size());
+
+            std::uint32_t i = start;
+            std::uint32_t iNext = start;
+            auto letter = _lv_txt_encoded_next(text, &iNext);
+            auto iNextNext = iNext;
+            std::uint32_t letterNext = 0;
+            lv_coord_t currentWidth = 0;
+            std::uint32_t wordLength = 0;
+            auto breakIndex = noBreak;
+
+            /* Obtain the full word, regardless if it fits or not */
+            while (i < textSize) {
+                letterNext = (iNextNext < textSize) ? _lv_txt_encoded_next(text, &iNextNext) : 0;
+                wordLength++;
+
+                /* Kerning applies only between letters of the same face */
+                const auto style = cursor.getStyle(i);
+                const auto isNextSameStyle = (iNext < textSize) && (cursor.getStyle(iNext) == style);
+                currentWidth += getLetterWidth(block.font, style, letter, isNextSameStyle ? letterNext : 0);
+
+                /* Remember the first character that doesn't fit */
+                if ((breakIndex == noBreak) && (currentWidth > maxWidth)) {
+                    breakIndex = i;
+                }
+
+                if ((letter == '\n') || (letter == '\r') || _lv_txt_is_break_char(letter)) {
+                    if ((i == start) && (breakIndex == noBreak)) {
+                        wordWidth = currentWidth;
+                    }
+                    wordLength--;
+                    break;
+                }
+
+                if (breakIndex == noBreak) {
+                    wordWidth = currentWidth;
+                }
+
+                i = iNext;
+                iNext = iNextNext;
+                letter = letterNext;
+            }
+
+            /* Entire word fits */
+            if (breakIndex == noBreak) {
+                if (wordLength == 0) {
+                    i = iNext;
+                }
+                return i - start;
+            }
+
+            /* Word doesn't fit - it's cut only if it's the first one in the line */
+            if (force) {
+                return breakIndex - start;
+            }
+            wordWidth = 0;
+            return 0;
+        }
+
+        /* Returns end of the longest part of the word starting at offset, that fits with a hyphen, offset if none does */
+        auto getHyphenatedEnd(const TextBlock &block, std::uint32_t offset, lv_coord_t maxWidth, const Hyphenator &hyphenator) -> std::uint32_t
+        {
+            auto wordEnd = offset;
+            while (!isWordEnd(block, wordEnd)) {
+                _lv_txt_encoded_next(block.text.c_str(), &wordEnd);
+            }
+
+            std::vector<std::size_t> points;
+            hyphenator.hyphenate(std::string_view{block.text}.substr(offset, wordEnd - offset), points);
+            for (auto it = points.rbegin(); it != points.rend(); ++it) {
+                const auto end = offset + static_cast<std::uint32_t>(*it);
+                if (textLayoutGetLineWidth(block, offset, end, true) <= maxWidth) {
+                    return end;
+                }
+            }
+            return offset;
+        }
+    }
+
+    auto textLayoutGetFont(Font blockFont, TextStyle style) -> const lv_font_t *
+    {
+        const auto &current = getFaces();
+        const auto isHeading = (blockFont == Font::Bold);
+        switch (style) {
+            case TextStyle::Italic:
+                return isHeading ? current.headingItalic.get() : current.normalItalic.get();
+            case TextStyle::Bold:
+                return isHeading ? current.headingBold.get() : current.normalBold.get();
+            case TextStyle::BoldItalic:
+                return isHeading ? current.headingBoldItalic.get() : current.normalBoldItalic.get();
+            case TextStyle::Regular:
+            default:
+                return Paginator::getBlockFont(blockFont);
+        }
+    }
+
+    auto textLayoutResetFonts() -> void
+    {
+        std::lock_guard lock{facesMutex};
+        currentFaces.store(nullptr, std::memory_order_release);
+        faces.reset();
+    }
+
+    auto textLayoutGetAdvanceStatistics() -> AdvanceCache::Statistics
+    {
+        AdvanceCache::Statistics result{0, 0, 0};
+        for (const auto blockFont : {Font::Normal, Font::Bold}) {
+            const auto caches = getAdvanceCaches(blockFont);
+            for (std::size_t i = 0; i < stylesCount; ++i) {
+                const auto statistics = caches[i].getStatistics();
+                result.hits += statistics.hits;
+                result.misses += statistics.misses;
+                result.size += statistics.size;
+            }
+        }
+        return result;
+    }
+
+    auto textLayoutBreakLine(const TextBlock &block, std::size_t offset, lv_coord_t maxWidth, const Hyphenator *hyphenator) -> LineBreak
+    {
+        const auto textSize = block.text.size();
+        if (offset >= textSize) {
+            return {0, false};
+        }
+
+        StyleCursor cursor{block, offset};
+        auto i = static_cast<std::uint32_t>(offset);
+        while ((i < textSize) && (maxWidth > 0)) {
+            lv_coord_t wordWidth = 0;
+            const auto isFirstWord = (i == offset);
+            const auto advance = getNextWord(block, cursor, i, maxWidth, wordWidth, isFirstWord);
+
+            /* Word that doesn't fit is hyphenated - also the first one, which would be cut anywhere otherwise */
+            const auto isWordCut = isFirstWord && (advance > 0) && !isWordEnd(block, i + advance);
+            if ((hyphenator != nullptr) && ((advance == 0) || isWordCut)) {
+                const auto hyphenEnd = getHyphenatedEnd(block, i, maxWidth, *hyphenator);
+                if (hyphenEnd > i) {
+                    return {hyphenEnd - offset, true};
+                }
+            }
+
+            maxWidth -= wordWidth;
+            if (advance == 0) {
+                break;
+            }
+            i += advance;
+        }
+
+        /* Always step at least one character to avoid infinite loops */
+        if (i == offset) {
+            _lv_txt_encoded_next(block.text.c_str(), &i);
+        }
+        return {i - offset, false};
+    }
+
+    auto textLayoutGetLineWidth(const TextBlock &block, std::size_t start, std::size_t end, bool isHyphenated) -> lv_coord_t
+    {
+        /* Spaces the line was broken at don't count */
+        const auto text = block.text.c_str();
+        end = std::min(end, block.text.size());
+        while ((end > start) && (text[end - 1] == ' ')) {
+            end--;
+        }
+        return textLayoutGetTextWidth(block, start, end, isHyphenated);
+    }
+
+    auto textLayoutGetTextWidth(const TextBlock &block, std::size_t start, std::size_t end, bool isHyphenated) -> lv_coord_t
+    {
+        /* Measured the same way the line is drawn */
+        const auto text = block.text.c_str();
+        end = std::min(end, block.text.size());
+
+        StyleCursor cursor{block, start};
+        lv_coord_t width = 0;
+        auto style = TextStyle::Regular;
+        auto i = static_cast<std::uint32_t>(start);
+        while (i < end) {
+            style = cursor.getStyle(i);
+            const auto letter = _lv_txt_encoded_next(text, &i);
+            auto iNext = i;
+            const auto letterNext = (i < end) ? _lv_txt_encoded_next(text, &iNext) : 0;
+            const auto isNextSameStyle = (i < end) && (cursor.getStyle(i) == style);
+            width += getLetterWidth(block.font, style, letter, isNextSameStyle ? letterNext : 0);
+        }
+        if (isHyphenated) {
+            width += getLetterWidth(block.font, style, hyphen, 0);
+        }
+        return width;
+    }
+
+    auto textLayoutDrawLine(lv_draw_ctx_t *drawCtx, const lv_draw_label_dsc_t &labelDsc, const TextBlock &block,
+                            const Paginator::Line &line, const lv_point_t &position) -> void
+    {
+        const auto text = block.text.c_str();
+        const auto start = line.start;
+        const auto end = line.end;
+
+        /* Spaces inside a justified line share the free space, the first ones get a pixel more than the rest.
+         * Free space is negative if the line was broken with shrunk spaces. */
+        auto textEnd = end;
+        while ((textEnd > start) && (text[textEnd - 1] == ' ')) {
+            textEnd--;
+        }
+        lv_coord_t spaceExtra = 0;
+        lv_coord_t spaceRemainderStep = 0;
+        std::int32_t widerSpacesCount = 0;
+        if (line.width > 0) {
+            const auto spacesCount = static_cast<std::int32_t>(std::count(&text[start], &text[textEnd], ' '));
+            const auto freeWidth = static_cast<std::int32_t>(line.width - textLayoutGetLineWidth(block, start, end, line.isHyphenated));
+            if (spacesCount > 0) {
+                spaceExtra = static_cast<lv_coord_t>(freeWidth / spacesCount);
+                widerSpacesCount = std::abs(freeWidth % spacesCount);
+                spaceRemainderStep = (freeWidth < 0) ? -1 : 1;
+            }
+        }
+
+        auto letterDsc = labelDsc;
+        auto letterPosition = position;
+        StyleCursor cursor{block, start};
+
+        auto i = static_cast<std::uint32_t>(start);
+        while (i < end) {
+            const auto letterIndex = i;
+            const auto letter = _lv_txt_encoded_next(text, &i);
+            auto iNext = i;
+            const auto letterNext = (i < end) ? _lv_txt_encoded_next(text, &iNext) : 0;
+
+            const auto style = cursor.getStyle(letterIndex);
+            const auto isNextSameStyle = (i < end) && (cursor.getStyle(i) == style);
+            letterDsc.font = textLayoutGetFont(block.font, style);
+            const auto letterWidth = getLetterWidth(block.font, style, letter, isNextSameStyle ? letterNext : 0);
+
+            /* Skip letters outside of the clip area */
+            if ((letterPosition.x + letterWidth >= drawCtx->clip_area->x1) && (letterPosition.x <= drawCtx->clip_area->x2)) {
+                lv_draw_letter(drawCtx, &letterDsc, &letterPosition, letter);
+            }
+            letterPosition.x += letterWidth;
+
+            if ((letter == ' ') && (letterIndex < textEnd)) {
+                letterPosition.x += spaceExtra;
+                if (widerSpacesCount > 0) {
+                    letterPosition.x += spaceRemainderStep;
+                    widerSpacesCount--;
+                }
+            }
+        }
+
+        /* Hyphen has the face of the last letter */
+        if (line.isHyphenated) {
+            lv_draw_letter(drawCtx, &letterDsc, &letterPosition, hyphen);
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Paginator.hpp"
+#include "Hyphenator.hpp"
+#include "AdvanceCache.hpp"
+#include <TextBlock.hpp>
+#include <lvgl.h>
+#include <cstddef>
+
+namespace gui
+{
+    /* Layout of text blocks with style runs. Lines are broken the same way LVGL labels
+     * do it, but each character is measured with the font of its run, so pagination and
+     * drawing of mixed faces agree with each other. Word that doesn't fit in the line
+     * is hyphenated, if a hyphenator is given. */
+
+    struct LineBreak
+    {
+        std::size_t length; // In bytes
+        bool isHyphenated; // Line ends inside a word and is drawn with a hyphen
+    };
+
+    auto textLayoutGetFont(Font blockFont, TextStyle style) -> const lv_font_t *;
+
+    /* Drops faces derived from the reading fonts and their cached widths, before the fonts are loaded
+     * again. No text may be measured or drawn in any task meanwhile. */
+    auto textLayoutResetFonts() -> void;
+
+    /* Letter widths cached for all faces, summed */
+    auto textLayoutGetAdvanceStatistics() -> AdvanceCache::Statistics;
+
+    /* Returns the end of the line starting at offset, the line has at least one character */
+    auto textLayoutBreakLine(const TextBlock &block, std::size_t offset, lv_coord_t maxWidth, const Hyphenator *hyphenator) -> LineBreak;
+
+    /* Returns width of text in range [start, end) drawn as a single line, without trailing spaces and with the hyphen */
+    auto textLayoutGetLineWidth(const TextBlock &block, std::size_t start, std::size_t end, bool isHyphenated) -> lv_coord_t;
+
+    /* Returns width of text in range [start, end) as it is, e.g. of a single word */
+    auto textLayoutGetTextWidth(const TextBlock &block, std::size_t start, std::size_t end, bool isHyphenated) -> lv_coord_t;
+
+    /* Draws the line with top left corner at position, justified line has the free space spread over its spaces */
+    auto textLayoutDrawLine(lv_draw_ctx_t *drawCtx, const lv_draw_label_dsc_t &labelDsc, const TextBlock &block,
+                            const Paginator::Line &line, const lv_point_t &position) -> void;
+}
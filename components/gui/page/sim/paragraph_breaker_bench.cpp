@@ -0,0 +1,223 @@
+/* Host benchmark of ParagraphBreaker, compares the cost per page and the evenness of spaces in justified
+ * paragraphs broken as a whole with the ones broken greedily, line by line. Not a part of the firmware,
+ * build and run on the host with:
+ *
+ *   L=../../../third_party/lvgl
+ *   cc -O2 -DLV_CONF_SKIP -DLV_LVGL_H_INCLUDE_SIMPLE -I$L -c ../../fonts/gui_montserrat_medium_28.c $L/src/font/lv_font.c $L/src/font/lv_font_fmt_txt.c $L/src/misc/lv_utils.c
+ *   c++ -std=gnu++20 -O2 -DLV_CONF_SKIP -Wno-deprecated-enum-enum-conversion -I.. -I../../fonts -I../../../epub -I../../../third_party -I$L \
+ *       -o paragraph_breaker_bench paragraph_breaker_bench.cpp ../ParagraphBreaker.cpp ../../fonts/AdvanceCache.cpp *.o && ./paragraph_breaker_bench
+ *
+ * Text is measured through AdvanceCache with a built-in face, as on the device once its widths are cached,
+ * so the time is the one of breaking itself. Words are not hyphenated, hyphenation points would add
+ * breakpoints to both. */
+
+#include "ParagraphBreaker.hpp"
+#include "AdvanceCache.hpp"
+#include <lvgl.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" const lv_font_t gui_montserrat_medium_28;
+
+namespace
+{
+    constexpr auto paragraphsCount = 2000;
+    constexpr auto minParagraphWords = 10;
+    constexpr auto maxParagraphWords = 250;
+    constexpr lv_coord_t lineWidth = 520;
+    constexpr lv_coord_t textIndent = 40;
+    constexpr auto linesPerPage = 28;
+    constexpr auto seed = 12345U;
+
+    /* Short words are repeated, so that their share is about the one of English prose */
+    const std::vector<std::string> words = {
+        "the", "the", "the", "of", "of", "and", "and", "a", "a", "to", "to", "in", "in", "was", "he", "that",
+        "it", "his", "her", "with", "as", "had", "for", "you", "not", "be", "at", "on", "which", "from", "said",
+        "by", "but", "they", "were", "all", "she", "been", "would", "could", "there", "little", "house",
+        "evening", "window", "remembered", "nothing", "whispered", "extraordinary", "circumstances",
+        "nevertheless", "understanding", "conversation", "immediately", "gentleman", "particularly",
+        "well-known", "drawing-room", "“Yes,”", "said.", "again;", "Mr.", "Elizabeth", "Darcy"
+    };
+
+    gui::AdvanceCache *advances;
+
+    auto decodeLetter(const std::string &text, std::size_t &offset) -> std::uint32_t
+    {
+        const auto byte = static_cast<std::uint8_t>(text[offset++]);
+        const auto length = (byte < 0x80) ? 0 : ((byte < 0xE0) ? 1 : ((byte < 0xF0) ? 2 : 3));
+        std::uint32_t letter = (length == 0) ? byte : (byte & (0x3F >> length));
+        for (auto i = 0; (i < length) && (offset < text.size()); ++i) {
+            letter = (letter << 6) | (static_cast<std::uint8_t>(text[offset++]) & 0x3F);
+        }
+        return letter;
+    }
+
+    struct Paragraph
+    {
+        TextBlock block;
+        std::vector<std::size_t> wordEnds; // Of each word, the space follows it
+    };
+
+    auto makeParagraph(std::mt19937 &random) -> Paragraph
+    {
+        std::uniform_int_distribution<int> wordsCount{minParagraphWords, maxParagraphWords};
+        std::uniform_int_distribution<std::size_t> wordIndex{0, words.size() - 1};
+        Paragraph paragraph{{"", Font::Normal, {}, "", 0}, {}};
+        const auto count = wordsCount(random);
+        for (auto i = 0; i < count; ++i) {
+            if (i > 0) {
+                paragraph.block.text += ' ';
+            }
+            paragraph.block.text += words[wordIndex(random)];
+            paragraph.wordEnds.push_back(paragraph.block.text.size());
+        }
+        return paragraph;
+    }
+
+    /* Same as breaking line by line without hyphenation, each word is measured once and added while the line fits */
+    auto breakGreedily(const Paragraph &paragraph, std::vector<gui::LineBreak> &lines) -> void
+    {
+        lines.clear();
+        std::size_t lineStart = 0;
+        std::size_t previousWordEnd = 0;
+        lv_coord_t width = 0;
+        auto maxWidth = lineWidth - textIndent;
+        for (const auto wordEnd : paragraph.wordEnds) {
+            /* Word is measured with the space before it, line ends after the space following the last word that fits */
+            const auto wordWidth = gui::textLayoutGetTextWidth(paragraph.block, previousWordEnd, wordEnd, false);
+            if ((previousWordEnd > lineStart) && ((width + wordWidth) > maxWidth)) {
+                lines.push_back({previousWordEnd + 1 - lineStart, false});
+                lineStart = previousWordEnd + 1;
+                width = gui::textLayoutGetTextWidth(paragraph.block, lineStart, wordEnd, false);
+                maxWidth = lineWidth;
+            }
+            else {
+                width += wordWidth;
+            }
+            previousWordEnd = wordEnd;
+        }
+        lines.push_back({paragraph.block.text.size() - lineStart, false});
+    }
+
+    struct Statistics
+    {
+        std::uint64_t lines;
+        double microseconds;
+        std::uint64_t justifiedLines; // All but the last lines of paragraphs the optimal mode breaks as a whole
+        double ratioSum; // Of stretch of spaces relative to their width
+        double ratioMax;
+        std::uint64_t looseLines; // With spaces stretched over twice their width
+    };
+
+    auto addLines(const Paragraph &paragraph, const std::vector<gui::LineBreak> &lines, bool isCompared, Statistics &statistics) -> void
+    {
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            const auto end = start + lines[i].length;
+            statistics.lines++;
+            if (isCompared && ((i + 1) < lines.size())) {
+                statistics.justifiedLines++;
+                /* Trailing space is not drawn, the others are stretched to fill the line */
+                const auto lineEnd = (paragraph.block.text[end - 1] == ' ') ? (end - 1) : end;
+                const auto naturalWidth = gui::textLayoutGetTextWidth(paragraph.block, start, lineEnd, false);
+                const auto targetWidth = (i == 0) ? (lineWidth - textIndent) : lineWidth;
+                const auto spacesCount = std::count(paragraph.block.text.begin() + start, paragraph.block.text.begin() + lineEnd, ' ');
+                const auto spaceWidth = advances->getWidth(' ', 0);
+                const auto ratio = (spacesCount > 0) ? (static_cast<double>(targetWidth - naturalWidth) / (spacesCount * spaceWidth)) : 0.0;
+                statistics.ratioSum += std::abs(ratio);
+                statistics.ratioMax = std::max(statistics.ratioMax, std::abs(ratio));
+                statistics.looseLines += (ratio > 2.0) ? 1 : 0;
+            }
+            start = end;
+        }
+    }
+
+    auto print(const char *name, const Statistics &statistics) -> void
+    {
+        const auto pages = static_cast<double>(statistics.lines) / linesPerPage;
+        std::printf("%-8s %8llu %12.1f %12.2f %10.2f %12llu\n", name, static_cast<unsigned long long>(statistics.lines),
+                    statistics.microseconds / pages, statistics.ratioSum / statistics.justifiedLines, statistics.ratioMax,
+                    static_cast<unsigned long long>(statistics.looseLines));
+    }
+}
+
+namespace gui
+{
+    /* Never called, no hyphenator is given to the breaker */
+    auto Hyphenator::hyphenate(std::string_view word, std::vector<std::size_t> &points) const -> void {}
+
+    auto textLayoutGetTextWidth(const TextBlock &block, std::size_t start, std::size_t end, bool isHyphenated) -> lv_coord_t
+    {
+        lv_coord_t width = 0;
+        auto offset = start;
+        auto letter = (offset < end) ? decodeLetter(block.text, offset) : 0;
+        while (letter != 0) {
+            const auto letterNext = (offset < end) ? decodeLetter(block.text, offset) : 0;
+            width += advances->getWidth(letter, letterNext);
+            letter = letterNext;
+        }
+        return width + (isHyphenated ? advances->getWidth('-', 0) : 0);
+    }
+}
+
+int main()
+{
+    gui::AdvanceCache cache{&gui_montserrat_medium_28};
+    advances = &cache;
+
+    std::mt19937 random{seed};
+    std::vector<Paragraph> paragraphs;
+    for (auto i = 0; i < paragraphsCount; ++i) {
+        paragraphs.push_back(makeParagraph(random));
+    }
+
+    /* Paragraphs too loose to be broken within tolerance are broken greedily, as on the device. They are timed,
+     * but spaces are compared only in the ones broken as a whole. Widths are cached before. */
+    gui::ParagraphBreaker breaker;
+    std::vector<gui::LineBreak> lines;
+    std::vector<bool> isBrokenAsWhole;
+    for (const auto &paragraph : paragraphs) {
+        isBrokenAsWhole.push_back(breaker.breakParagraph(paragraph.block, lineWidth - textIndent, lineWidth, nullptr, lines));
+        breakGreedily(paragraph, lines);
+    }
+
+    Statistics greedy{0, 0.0, 0, 0.0, 0.0, 0};
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &paragraph : paragraphs) {
+        breakGreedily(paragraph, lines);
+    }
+    greedy.microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    Statistics optimal{0, 0.0, 0, 0.0, 0.0, 0};
+    start = std::chrono::steady_clock::now();
+    for (const auto &paragraph : paragraphs) {
+        if (!breaker.breakParagraph(paragraph.block, lineWidth - textIndent, lineWidth, nullptr, lines)) {
+            breakGreedily(paragraph, lines);
+        }
+    }
+    optimal.microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    for (std::size_t i = 0; i < paragraphs.size(); ++i) {
+        breakGreedily(paragraphs[i], lines);
+        addLines(paragraphs[i], lines, isBrokenAsWhole[i], greedy);
+        if (!isBrokenAsWhole[i] || !breaker.breakParagraph(paragraphs[i].block, lineWidth - textIndent, lineWidth, nullptr, lines)) {
+            breakGreedily(paragraphs[i], lines);
+        }
+        addLines(paragraphs[i], lines, isBrokenAsWhole[i], optimal);
+    }
+
+    const auto wholeCount = std::count(isBrokenAsWhole.begin(), isBrokenAsWhole.end(), true);
+    std::printf("%d paragraphs of %d to %d words, lines of %d px, %d lines per page\n", paragraphsCount, minParagraphWords,
+                maxParagraphWords, lineWidth, linesPerPage);
+    std::printf("%ld paragraphs broken as a whole, spaces compared in them\n", static_cast<long>(wholeCount));
+    std::printf("%-8s %8s %12s %12s %10s %12s\n", "", "lines", "us/page", "mean ratio", "max ratio", "ratio > 2");
+    print("greedy", greedy);
+    print("optimal", optimal);
+    return 0;
+}
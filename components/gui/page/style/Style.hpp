@@ -8,5 +8,8 @@ namespace gui::style
     inline constexpr auto width = main_area::width;
     inline constexpr auto height = main_area::height - marginTop;
     inline constexpr auto offsetY = main_area::minY + marginTop;
-    inline constexpr auto lineSpacing = 5;
+    inline constexpr auto progressUpdatePeriodMs = 1000;
+    inline constexpr auto fontsDirectory = ".fonts"; // In the library root, one subdirectory per family
+    inline constexpr auto fallbackFontFamily = "fallback"; // Fonts for characters missing in the family
+    inline constexpr auto glyphCacheCapacity = 256 * 1024;
 }
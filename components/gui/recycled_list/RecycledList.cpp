@@ -0,0 +1,337 @@
+#include "RecycledList.hpp"
+#include "style/Style.hpp"
+#include <esp_log.h>
+#include <algorithm>
+#include <cstdlib>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    RecycledList::RecycledList(lv_obj_t *parent, lv_coord_t width, lv_coord_t height, const lv_font_t *font, Mode mode) :
+        pageBar{nullptr}, pageLabel{nullptr}, font{font}, mode{mode}, itemCount{0}, scrollOffset{0}, dragDistance{0}
+    {
+        /* Create list, disable built-in layout and scrolling - rows are placed manually */
+        list = lv_list_create(parent);
+        lv_obj_set_size(list, width, height);
+        lv_obj_set_style_layout(list, 0, LV_PART_MAIN);
+        lv_obj_set_style_pad_all(list, 0, LV_PART_MAIN);
+        lv_obj_clear_flag(list, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_event_cb(list, onDrag, LV_EVENT_PRESSED, this);
+        lv_obj_add_event_cb(list, onDrag, LV_EVENT_PRESSING, this);
+
+        rowHeight = lv_font_get_line_height(font) + style::recycled_list::row::padTop + style::recycled_list::row::padBottom;
+
+        /* Paged list needs exactly one page of rows, scrolled one has to cover partially visible rows and margins */
+        std::size_t rowsCount;
+        if (mode == Mode::Paged) {
+            createPageBar(font);
+            lv_obj_add_event_cb(list, onGesture, LV_EVENT_GESTURE, this);
+            lv_obj_clear_flag(list, LV_OBJ_FLAG_GESTURE_BUBBLE);
+            rowsPerPage = std::max((height - style::recycled_list::page_bar::height) / rowHeight, 1);
+            rowsCount = rowsPerPage;
+        }
+        else {
+            rowsPerPage = height / rowHeight;
+            rowsCount = rowsPerPage + 2 + (2 * style::recycled_list::marginRows);
+        }
+
+        rows.reserve(rowsCount);
+        for (std::size_t i = 0; i < rowsCount; ++i) {
+            rows.push_back(createRow());
+        }
+        updatePageLabel();
+    }
+
+    RecycledList::~RecycledList() noexcept
+    {
+        lv_obj_del(list);
+    }
+
+    auto RecycledList::setItemGetter(ItemGetter getter) -> void
+    {
+        itemGetter = std::move(getter);
+    }
+
+    auto RecycledList::setClickCallback(ItemCallback callback) -> void
+    {
+        clickCallback = std::move(callback);
+    }
+
+    auto RecycledList::setIconClickCallback(ItemCallback callback) -> void
+    {
+        iconClickCallback = std::move(callback);
+    }
+
+    auto RecycledList::setItemCount(std::size_t count) -> void
+    {
+        itemCount = count;
+        scrollOffset = std::min(scrollOffset, getMaxScrollOffset());
+        updateRows(true);
+    }
+
+    auto RecycledList::refreshItem(std::size_t index) -> void
+    {
+        /* Only a row currently bound to the item needs rebinding, others get it when they come into view */
+        const auto it = std::find_if(rows.begin(), rows.end(), [&](const auto &row) {
+            return row.itemIndex == index;
+        });
+        if ((it != rows.end()) && itemGetter) {
+            bindRow(*it, index);
+        }
+    }
+
+    auto RecycledList::scrollToTop() -> void
+    {
+        scrollOffset = 0;
+        updateRows(false);
+    }
+
+    auto RecycledList::getObject() const -> lv_obj_t *
+    {
+        return list;
+    }
+
+    auto RecycledList::onDrag(lv_event_t *event) -> void
+    {
+        auto self = static_cast<RecycledList *>(lv_event_get_user_data(event));
+
+        if (lv_event_get_code(event) == LV_EVENT_PRESSED) {
+            self->dragDistance = 0;
+            return;
+        }
+
+        lv_point_t vector;
+        lv_indev_get_vect(lv_indev_get_act(), &vector);
+        if ((vector.x == 0) && (vector.y == 0)) {
+            return;
+        }
+
+        /* Distance is tracked also in paged mode to not treat swipe as a click */
+        self->dragDistance += std::abs(vector.x) + std::abs(vector.y);
+        if ((self->mode == Mode::Paged) || !self->isDragged()) {
+            return;
+        }
+
+        const auto newScrollOffset = std::clamp<std::int32_t>(self->scrollOffset - vector.y, 0, self->getMaxScrollOffset());
+        if (newScrollOffset != self->scrollOffset) {
+            self->scrollOffset = newScrollOffset;
+            self->updateRows(false);
+        }
+    }
+
+    auto RecycledList::onGesture(lv_event_t *event) -> void
+    {
+        auto self = static_cast<RecycledList *>(lv_event_get_user_data(event));
+
+        const auto swipeDirection = lv_indev_get_gesture_dir(lv_indev_get_act());
+        switch (swipeDirection) {
+            case LV_DIR_LEFT:
+            case LV_DIR_TOP:
+                self->turnPage(1);
+                break;
+            case LV_DIR_RIGHT:
+            case LV_DIR_BOTTOM:
+                self->turnPage(-1);
+                break;
+            default:
+                break;
+        }
+    }
+
+    auto RecycledList::onPreviousPageClick(lv_event_t *event) -> void
+    {
+        auto self = static_cast<RecycledList *>(lv_event_get_user_data(event));
+        self->turnPage(-1);
+    }
+
+    auto RecycledList::onNextPageClick(lv_event_t *event) -> void
+    {
+        auto self = static_cast<RecycledList *>(lv_event_get_user_data(event));
+        self->turnPage(1);
+    }
+
+    auto RecycledList::onRowClick(lv_event_t *event) -> void
+    {
+        auto self = static_cast<RecycledList *>(lv_event_get_user_data(event));
+        if (self->isDragged() || !self->clickCallback) {
+            return;
+        }
+
+        const auto target = lv_event_get_target(event);
+        const auto it = std::find_if(self->rows.begin(), self->rows.end(), [&](const auto &row) {
+            return row.button == target;
+        });
+        if ((it != self->rows.end()) && (it->itemIndex != noItem)) {
+            self->clickCallback(it->itemIndex);
+        }
+    }
+
+    auto RecycledList::onIconClick(lv_event_t *event) -> void
+    {
+        auto self = static_cast<RecycledList *>(lv_event_get_user_data(event));
+        if (self->isDragged() || !self->iconClickCallback) {
+            return;
+        }
+
+        const auto target = lv_event_get_target(event);
+        const auto it = std::find_if(self->rows.begin(), self->rows.end(), [&](const auto &row) {
+            return row.icon == target;
+        });
+        if ((it != self->rows.end()) && (it->itemIndex != noItem)) {
+            self->iconClickCallback(it->itemIndex);
+        }
+    }
+
+    auto RecycledList::createRow() -> Row
+    {
+        Row row;
+        row.button = lv_list_add_btn(list, LV_SYMBOL_FILE, "");
+        row.icon = lv_obj_get_child(row.button, 0); // Icon is created as the first child
+        row.label = lv_obj_get_child(row.button, 1); // Label is created as the last child
+        row.itemIndex = noItem;
+
+        lv_obj_set_height(row.button, rowHeight);
+        lv_obj_set_style_text_font(row.button, font, LV_PART_MAIN);
+        lv_obj_set_style_pad_top(row.button, style::recycled_list::row::padTop, LV_PART_MAIN);
+        lv_obj_set_style_pad_bottom(row.button, style::recycled_list::row::padBottom, LV_PART_MAIN);
+        lv_obj_add_flag(row.button, LV_OBJ_FLAG_EVENT_BUBBLE); // Pass pressing to the list to handle dragging
+        lv_obj_add_flag(row.button, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(row.button, LV_OBJ_FLAG_SCROLLABLE); // Image icon can be higher than the text
+        lv_obj_add_event_cb(row.button, onRowClick, LV_EVENT_CLICKED, this);
+        row.basePadLeft = lv_obj_get_style_pad_left(row.button, LV_PART_MAIN);
+
+        /* Rows have fixed height, so the text has to be truncated instead of wrapped */
+        lv_obj_set_height(row.label, lv_font_get_line_height(font));
+        lv_label_set_long_mode(row.label, LV_LABEL_LONG_DOT);
+
+        lv_obj_add_flag(row.icon, LV_OBJ_FLAG_EVENT_BUBBLE);
+        lv_obj_set_ext_click_area(row.icon, style::recycled_list::row::iconExtClickArea);
+        lv_obj_add_event_cb(row.icon, onIconClick, LV_EVENT_CLICKED, this);
+
+        return row;
+    }
+
+    auto RecycledList::createPageBar(const lv_font_t *font) -> void
+    {
+        /* Create bar at the bottom of the list */
+        pageBar = lv_obj_create(list);
+        lv_obj_set_size(pageBar, LV_PCT(100), style::recycled_list::page_bar::height);
+        lv_obj_align(pageBar, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lv_obj_set_style_pad_all(pageBar, 0, LV_PART_MAIN);
+        lv_obj_set_style_border_side(pageBar, LV_BORDER_SIDE_TOP, LV_PART_MAIN);
+        lv_obj_set_style_border_width(pageBar, style::recycled_list::page_bar::borderWidth, LV_PART_MAIN);
+        lv_obj_set_style_text_font(pageBar, font, LV_PART_MAIN);
+        lv_obj_clear_flag(pageBar, LV_OBJ_FLAG_SCROLLABLE);
+
+        /* Add page indicator */
+        pageLabel = lv_label_create(pageBar);
+        lv_obj_center(pageLabel);
+
+        /* Add page turning buttons */
+        createPageButton(LV_SYMBOL_LEFT, LV_ALIGN_LEFT_MID, onPreviousPageClick);
+        createPageButton(LV_SYMBOL_RIGHT, LV_ALIGN_RIGHT_MID, onNextPageClick);
+    }
+
+    auto RecycledList::createPageButton(const char *symbol, lv_align_t align, lv_event_cb_t callback) -> void
+    {
+        auto button = lv_btn_create(pageBar);
+        lv_obj_set_size(button, style::recycled_list::page_bar::buttonWidth, LV_PCT(100));
+        lv_obj_set_style_border_side(button, LV_BORDER_SIDE_NONE, LV_PART_MAIN);
+        lv_obj_align(button, align, 0, 0);
+        lv_obj_add_event_cb(button, callback, LV_EVENT_CLICKED, this);
+
+        auto icon = lv_label_create(button);
+        lv_label_set_text(icon, symbol);
+        lv_obj_center(icon);
+    }
+
+    auto RecycledList::bindRow(Row &row, std::size_t itemIndex) -> void
+    {
+        const auto &item = itemGetter(itemIndex);
+        lv_img_set_src(row.icon, item.icon);
+        lv_label_set_text(row.label, item.text.c_str());
+        lv_obj_set_style_pad_left(row.button, row.basePadLeft + item.indent, LV_PART_MAIN);
+        if (iconClickCallback) {
+            lv_obj_add_flag(row.icon, LV_OBJ_FLAG_CLICKABLE);
+        }
+        lv_obj_clear_flag(row.button, LV_OBJ_FLAG_HIDDEN);
+        row.itemIndex = itemIndex;
+    }
+
+    auto RecycledList::updateRows(bool forceRebind) -> void
+    {
+        if (!itemGetter) {
+            return;
+        }
+
+        /* Compute window of items that should have rows, each item always lands in the same slot
+         * so only rows whose item changed have to be rebound */
+        const std::size_t marginRows = (mode == Mode::Paged) ? 0 : style::recycled_list::marginRows;
+        const auto firstVisibleItem = static_cast<std::size_t>(scrollOffset / rowHeight);
+        const auto firstItem = (firstVisibleItem > marginRows) ? (firstVisibleItem - marginRows) : 0;
+        const auto lastItem = std::min(firstItem + rows.size(), itemCount);
+
+        for (auto &row : rows) {
+            row.itemIndex = forceRebind ? noItem : row.itemIndex;
+            if ((row.itemIndex < firstItem) || (row.itemIndex >= lastItem)) {
+                row.itemIndex = noItem;
+                lv_obj_add_flag(row.button, LV_OBJ_FLAG_HIDDEN);
+            }
+        }
+
+        for (auto itemIndex = firstItem; itemIndex < lastItem; ++itemIndex) {
+            auto &row = rows[itemIndex % rows.size()];
+            if (row.itemIndex != itemIndex) {
+                bindRow(row, itemIndex);
+            }
+            lv_obj_set_y(row.button, static_cast<lv_coord_t>(static_cast<std::int32_t>(itemIndex * rowHeight) - scrollOffset));
+        }
+
+        updatePageLabel();
+    }
+
+    auto RecycledList::updatePageLabel() -> void
+    {
+        if (pageLabel == nullptr) {
+            return;
+        }
+        lv_label_set_text_fmt(pageLabel, "%zu / %zu", getPageIndex() + 1, getPagesCount());
+    }
+
+    auto RecycledList::turnPage(std::int32_t pagesCount) -> void
+    {
+        const auto lastPageIndex = static_cast<std::int32_t>(getPagesCount()) - 1;
+        const auto newPageIndex = std::clamp<std::int32_t>(getPageIndex() + pagesCount, 0, lastPageIndex);
+        const auto newScrollOffset = static_cast<std::int32_t>(newPageIndex * rowsPerPage * rowHeight);
+        if (newScrollOffset != scrollOffset) {
+            scrollOffset = newScrollOffset;
+            updateRows(false);
+        }
+    }
+
+    auto RecycledList::getPageIndex() const -> std::size_t
+    {
+        return scrollOffset / (rowsPerPage * rowHeight);
+    }
+
+    auto RecycledList::getPagesCount() const -> std::size_t
+    {
+        return std::max<std::size_t>((itemCount + rowsPerPage - 1) / rowsPerPage, 1);
+    }
+
+    auto RecycledList::getMaxScrollOffset() const -> std::int32_t
+    {
+        if (mode == Mode::Paged) {
+            return static_cast<std::int32_t>((getPagesCount() - 1) * rowsPerPage * rowHeight);
+        }
+
+        const auto contentHeight = static_cast<std::int32_t>(itemCount * rowHeight);
+        return std::max<std::int32_t>(contentHeight - lv_obj_get_content_height(list), 0);
+    }
+
+    auto RecycledList::isDragged() const -> bool
+    {
+        return dragDistance > style::recycled_list::dragThreshold;
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <lvgl.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+namespace gui
+{
+    /* List keeping LVGL objects only for rows in the viewport (plus small margin),
+     * rows are repositioned and rebound to other items while dragging. Scrolling is
+     * done manually with 32-bit offset, as total height of thousands of rows would
+     * overflow LVGL coordinates.
+     *
+     * In paged mode the list does not scroll at all - it shows one screenful of rows
+     * at a time and is navigated by swipes or page buttons, which costs one display
+     * refresh per page instead of one per scroll step. */
+    class RecycledList
+    {
+        public:
+            enum class Mode
+            {
+                Scrolled,
+                Paged
+            };
+
+            struct Item
+            {
+                const void *icon; // Symbol or image descriptor
+                std::string text;
+                lv_coord_t indent;
+            };
+
+            using ItemGetter = std::function<Item(std::size_t index)>;
+            using ItemCallback = std::function<void(std::size_t index)>;
+
+            RecycledList(lv_obj_t *parent, lv_coord_t width, lv_coord_t height, const lv_font_t *font, Mode mode = Mode::Paged);
+            ~RecycledList() noexcept;
+
+            RecycledList(const RecycledList &) = delete;
+            auto operator=(const RecycledList &) -> RecycledList & = delete;
+
+            auto setItemGetter(ItemGetter getter) -> void;
+            auto setClickCallback(ItemCallback callback) -> void;
+            auto setIconClickCallback(ItemCallback callback) -> void;
+
+            auto setItemCount(std::size_t count) -> void;
+            auto refreshItem(std::size_t index) -> void;
+            auto scrollToTop() -> void;
+
+            [[nodiscard]] auto getObject() const -> lv_obj_t *;
+
+        private:
+            static constexpr auto noItem = std::numeric_limits<std::size_t>::max();
+
+            struct Row
+            {
+                lv_obj_t *button;
+                lv_obj_t *icon;
+                lv_obj_t *label;
+                lv_coord_t basePadLeft;
+                std::size_t itemIndex;
+            };
+
+            lv_obj_t *list;
+            lv_obj_t *pageBar;
+            lv_obj_t *pageLabel;
+            const lv_font_t *font;
+            Mode mode;
+            lv_coord_t rowHeight;
+            std::size_t rowsPerPage;
+            std::vector<Row> rows;
+            std::size_t itemCount;
+            std::int32_t scrollOffset;
+            std::int32_t dragDistance;
+
+            ItemGetter itemGetter;
+            ItemCallback clickCallback;
+            ItemCallback iconClickCallback;
+
+            static auto onDrag(lv_event_t *event) -> void;
+            static auto onGesture(lv_event_t *event) -> void;
+            static auto onPreviousPageClick(lv_event_t *event) -> void;
+            static auto onNextPageClick(lv_event_t *event) -> void;
+            static auto onRowClick(lv_event_t *event) -> void;
+            static auto onIconClick(lv_event_t *event) -> void;
+
+            auto createRow() -> Row;
+            auto createPageBar(const lv_font_t *font) -> void;
+            auto createPageButton(const char *symbol, lv_align_t align, lv_event_cb_t callback) -> void;
+            auto bindRow(Row &row, std::size_t itemIndex) -> void;
+            auto updateRows(bool forceRebind) -> void;
+            auto updatePageLabel() -> void;
+            auto turnPage(std::int32_t pagesCount) -> void;
+            auto getPageIndex() const -> std::size_t;
+            auto getPagesCount() const -> std::size_t;
+            auto getMaxScrollOffset() const -> std::int32_t;
+            auto isDragged() const -> bool;
+    };
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Dimensions.hpp"
+
+namespace gui::style::recycled_list
+{
+    /* Number of rows kept above and below the viewport */
+    inline constexpr auto marginRows = 2;
+
+    /* Drag distance after which release is not treated as a click */
+    inline constexpr auto dragThreshold = 10;
+
+    namespace page_bar
+    {
+        inline constexpr auto height = 60;
+        inline constexpr auto buttonWidth = 120;
+        inline constexpr auto borderWidth = 1;
+    }
+
+    namespace row
+    {
+        inline constexpr auto padTop = 20;
+        inline constexpr auto padBottom = 20;
+        inline constexpr auto iconExtClickArea = 20;
+    }
+}
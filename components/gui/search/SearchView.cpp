@@ -0,0 +1,354 @@
+#include "SearchView.hpp"
+#include "style/Style.hpp"
+#include "PageView.hpp"
+#include "BookIndexer.hpp"
+#include "RecycledList.hpp"
+#include "StatusBar.hpp"
+#include "Fonts.h"
+#include <SearchIndex.hpp>
+#include <StreamingSearch.hpp>
+#include <lvgl.h>
+#include <esp_log.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        lv_obj_t *view;
+        lv_obj_t *textArea;
+        lv_obj_t *keyboard;
+        lv_obj_t *statusLabel;
+        std::unique_ptr<RecycledList> resultsList;
+
+        const Epub *currentEpub;
+        std::unique_ptr<SearchIndex> searchIndex;
+        std::vector<SearchHit> hits;
+        std::string firstQueryTerm;
+
+        /* Without the index the book is scanned section by section in short time slices of LVGL timer,
+         * snippets are captured during the scan */
+        std::unique_ptr<StreamingSearch> streamingSearch;
+        std::unique_ptr<EpubEntryStream> sectionStream;
+        std::size_t streamedSectionIndex;
+        std::vector<std::string> snippets;
+        std::array<char, 2048> streamBuffer;
+        lv_timer_t *streamingTimer;
+        std::size_t shownHitsCount;
+        std::uint32_t streamingStartTick;
+        std::uint32_t lastResultsUpdateTick;
+
+        /* Results are sorted by section, so keeping one parsed section is enough for snippets of a whole page */
+        EpubSection cachedSection;
+        std::size_t cachedSectionIndex = Epub::invalidSpineEntryIndex;
+
+        auto getBlockText(const SearchHit &hit) -> std::string_view
+        {
+            if (cachedSectionIndex != hit.spineIndex) {
+                try {
+                    cachedSection = currentEpub->getSection(hit.spineIndex);
+                } catch (std::exception &e) {
+                    ESP_LOGE(TAG, "Exception for section@%lu: '%s'", hit.spineIndex, e.what());
+                    cachedSection = {};
+                }
+                cachedSectionIndex = hit.spineIndex;
+            }
+
+            const auto &blocks = cachedSection.getBlocks();
+            if (hit.blockIndex >= blocks.size()) {
+                return {};
+            }
+            return blocks[hit.blockIndex].text;
+        }
+
+        auto getSnippet(std::string_view text) -> std::string
+        {
+            /* Show the text starting shortly before the first match */
+            const auto it = std::search(text.begin(), text.end(), firstQueryTerm.begin(), firstQueryTerm.end(), [](char lhs, char rhs) {
+                return std::tolower(static_cast<unsigned char>(lhs)) == rhs;
+            });
+            auto start = static_cast<std::size_t>(std::distance(text.begin(), it));
+            if ((it == text.end()) || (start <= style::snippet::contextBytes)) {
+                return std::string{text};
+            }
+
+            start -= style::snippet::contextBytes;
+            while ((start < text.size()) && ((static_cast<unsigned char>(text[start]) & 0xC0) == 0x80)) { // Don't start in the middle of UTF-8 character
+                start++;
+            }
+            return "..." + std::string{text.substr(start)};
+        }
+
+        auto getListItem(std::size_t hitIndex) -> RecycledList::Item
+        {
+            if (hitIndex < snippets.size()) {
+                return {GUI_SYMBOL_BOOK_OPEN, snippets[hitIndex], 0};
+            }
+            return {GUI_SYMBOL_BOOK_OPEN, getSnippet(getBlockText(hits[hitIndex])), 0};
+        }
+
+        auto stopStreaming() -> void
+        {
+            if (streamingTimer != nullptr) {
+                lv_timer_del(streamingTimer);
+                streamingTimer = nullptr;
+                statusBarSetProgress("");
+            }
+            sectionStream.reset();
+            streamingSearch.reset();
+        }
+
+        auto closeView() -> void
+        {
+            stopStreaming();
+            snippets.clear();
+            resultsList.reset();
+            searchIndex.reset();
+            hits.clear();
+            cachedSection = {};
+            cachedSectionIndex = Epub::invalidSpineEntryIndex;
+            lv_obj_del_async(view);
+        }
+
+        auto resultClickCallback(std::size_t hitIndex) -> void
+        {
+            const auto hit = hits[hitIndex];
+            closeView();
+            pageViewCreate(currentEpub, {hit.spineIndex, hit.blockIndex, 0});
+        }
+
+        auto setStatus(const char *text) -> void
+        {
+            lv_label_set_text(statusLabel, text);
+            lv_obj_clear_flag(statusLabel, LV_OBJ_FLAG_HIDDEN);
+        }
+
+        auto showResults(bool isSearchFinished) -> void
+        {
+            resultsList->setItemCount(hits.size());
+            shownHitsCount = hits.size();
+            if (!hits.empty()) {
+                lv_obj_add_flag(statusLabel, LV_OBJ_FLAG_HIDDEN);
+            }
+            else if (isSearchFinished) {
+                setStatus("No results");
+            }
+        }
+
+        auto updateStreamingProgress() -> void
+        {
+            /* Sections are weighted equally, the current one by the part already inflated */
+            const auto sectionsCount = currentEpub->getSpineItemsCount();
+            auto sectionPart = 0.0f;
+            if ((sectionStream != nullptr) && (sectionStream->getSize() > 0)) {
+                sectionPart = static_cast<float>(sectionStream->getPosition()) / sectionStream->getSize();
+            }
+            const auto percent = static_cast<int>(100 * (streamedSectionIndex + sectionPart) / sectionsCount);
+
+            char buffer[32];
+            snprintf(buffer, sizeof(buffer), "Searching %d%%", percent);
+            statusBarSetProgress(buffer);
+        }
+
+        /* Returns false when there is nothing more to scan */
+        auto streamNextChunk() -> bool
+        {
+            if (sectionStream == nullptr) {
+                if (streamedSectionIndex >= currentEpub->getSpineItemsCount()) {
+                    return false;
+                }
+                sectionStream = currentEpub->openSectionStream(streamedSectionIndex);
+                if (sectionStream == nullptr) {
+                    streamedSectionIndex++;
+                    return true;
+                }
+                streamingSearch->beginSection(streamedSectionIndex);
+            }
+
+            const auto bytesRead = sectionStream->read(streamBuffer.data(), streamBuffer.size());
+            if (bytesRead == 0) {
+                streamingSearch->endSection();
+                sectionStream.reset();
+                streamedSectionIndex++;
+                return true;
+            }
+            streamingSearch->feed({streamBuffer.data(), bytesRead});
+            return true;
+        }
+
+        auto streamingTimerCallback(lv_timer_t *timer) -> void
+        {
+            /* Scanning is not an user activity, but LVGL task must not go to sleep before it ends */
+            lv_disp_trig_activity(nullptr);
+
+            const auto sliceStart = lv_tick_get();
+            auto isFinished = false;
+            while (!isFinished && (lv_tick_elaps(sliceStart) < style::streaming::sliceDurationMs)) {
+                isFinished = !streamNextChunk() || (hits.size() >= style::streaming::maxHits);
+
+                for (auto &hit : streamingSearch->takeHits()) {
+                    hits.push_back(hit.position);
+                    snippets.push_back(std::move(hit.snippet));
+                }
+            }
+
+            if (isFinished) {
+                ESP_LOGI(TAG, "Scan finished in %lums, %zu hits", lv_tick_elaps(streamingStartTick), hits.size());
+                stopStreaming();
+                showResults(true);
+                return;
+            }
+
+            /* Each update of the list costs a display refresh, so hits are shown in batches */
+            if ((hits.size() != shownHitsCount) && (lv_tick_elaps(lastResultsUpdateTick) >= style::streaming::resultsUpdatePeriodMs)) {
+                showResults(false);
+                lastResultsUpdateTick = lv_tick_get();
+            }
+            updateStreamingProgress();
+        }
+
+        auto startStreaming(std::string_view query) -> void
+        {
+            streamingSearch = std::make_unique<StreamingSearch>(query);
+            if (!streamingSearch->isQueryValid()) {
+                streamingSearch.reset();
+                showResults(true);
+                return;
+            }
+
+            streamedSectionIndex = 0;
+            streamingStartTick = lv_tick_get();
+            lastResultsUpdateTick = streamingStartTick;
+            streamingTimer = lv_timer_create(streamingTimerCallback, style::streaming::periodMs, nullptr);
+            setStatus("Searching...");
+            updateStreamingProgress();
+        }
+
+        auto runSearch() -> void
+        {
+            const auto query = std::string_view{lv_textarea_get_text(textArea)};
+
+            stopStreaming();
+            hits.clear();
+            snippets.clear();
+            resultsList->scrollToTop();
+            if (searchIndex == nullptr) {
+                resultsList->setItemCount(0);
+                startStreaming(query);
+                return;
+            }
+
+            firstQueryTerm.clear();
+            SearchIndex::tokenize(query, [](std::string_view term) {
+                if (firstQueryTerm.empty()) {
+                    firstQueryTerm = term;
+                }
+            });
+
+            const auto start = lv_tick_get();
+            hits = searchIndex->find(query);
+            const auto end = lv_tick_get();
+            ESP_LOGI(TAG, "Query '%s': %zu hits in %lums", query.data(), hits.size(), end - start);
+
+            showResults(true);
+        }
+
+        auto keyboardEventCallback(lv_event_t *event) -> void
+        {
+            switch (lv_event_get_code(event)) {
+                case LV_EVENT_READY:
+                    lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+                    runSearch();
+                    break;
+                case LV_EVENT_CANCEL:
+                    lv_obj_add_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        auto textAreaClickCallback(lv_event_t *event) -> void
+        {
+            lv_obj_clear_flag(keyboard, LV_OBJ_FLAG_HIDDEN);
+        }
+
+        auto backButtonClickCallback(lv_event_t *event) -> void
+        {
+            closeView();
+        }
+    }
+
+    auto searchViewCreate(const Epub *epub) -> void
+    {
+        /* Sanity check */
+        if (epub == nullptr) {
+            return;
+        }
+
+        currentEpub = epub;
+        searchIndex = bookIndexerOpenSearchIndex(epub->getPath());
+
+        /* Create view covering the main area */
+        view = lv_obj_create(lv_scr_act());
+        lv_obj_set_size(view, style::main_area::width, style::main_area::height);
+        lv_obj_align(view, LV_ALIGN_TOP_MID, 0, style::main_area::minY);
+        lv_obj_set_style_pad_all(view, 0, LV_PART_MAIN);
+        lv_obj_set_style_border_side(view, LV_BORDER_SIDE_NONE, LV_PART_MAIN);
+        lv_obj_clear_flag(view, LV_OBJ_FLAG_SCROLLABLE);
+
+        /* Create top bar */
+        auto topBar = lv_obj_create(view);
+        lv_obj_set_size(topBar, style::top_bar::width, style::top_bar::height);
+        lv_obj_align(topBar, LV_ALIGN_TOP_MID, 0, style::top_bar::marginTop);
+        lv_obj_set_style_border_side(topBar, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
+        lv_obj_set_style_pad_all(topBar, 0, LV_PART_MAIN);
+        lv_obj_clear_flag(topBar, LV_OBJ_FLAG_SCROLLABLE);
+
+        /* Add back button */
+        auto backButton = lv_btn_create(topBar);
+        lv_obj_set_style_border_side(backButton, LV_BORDER_SIDE_NONE, LV_PART_MAIN);
+        lv_obj_set_size(backButton, style::back_button::width, style::back_button::height);
+        lv_obj_align(backButton, LV_ALIGN_LEFT_MID, style::back_button::offsetX, 0);
+        lv_obj_add_event_cb(backButton, backButtonClickCallback, LV_EVENT_CLICKED, nullptr);
+
+        auto backButtonIcon = lv_label_create(backButton);
+        lv_label_set_text(backButtonIcon, GUI_SYMBOL_ARROW_LEFT);
+        lv_obj_set_style_text_font(backButtonIcon, &gui_montserrat_medium_44, LV_PART_MAIN);
+        lv_obj_center(backButtonIcon);
+
+        /* Add query text area */
+        textArea = lv_textarea_create(topBar);
+        lv_textarea_set_one_line(textArea, true);
+        lv_textarea_set_placeholder_text(textArea, "Search");
+        lv_obj_set_width(textArea, style::text_area::width);
+        lv_obj_set_style_text_font(textArea, &gui_montserrat_medium_28, LV_PART_MAIN);
+        lv_obj_align(textArea, LV_ALIGN_RIGHT_MID, style::text_area::offsetX, 0);
+        lv_obj_add_event_cb(textArea, textAreaClickCallback, LV_EVENT_CLICKED, nullptr);
+
+        /* Create results list */
+        resultsList = std::make_unique<RecycledList>(view, style::list::width, style::list::height, &gui_montserrat_medium_28);
+        lv_obj_align_to(resultsList->getObject(), topBar, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
+        resultsList->setItemGetter(getListItem);
+        resultsList->setClickCallback(resultClickCallback);
+        resultsList->setItemCount(0);
+
+        /* Add status label shown instead of results */
+        statusLabel = lv_label_create(view);
+        lv_obj_set_style_text_font(statusLabel, &gui_montserrat_medium_28, LV_PART_MAIN);
+        lv_obj_align_to(statusLabel, topBar, LV_ALIGN_OUT_BOTTOM_MID, 0, style::top_bar::height);
+        lv_obj_add_flag(statusLabel, LV_OBJ_FLAG_HIDDEN);
+
+        /* Create keyboard on top of the results */
+        keyboard = lv_keyboard_create(view);
+        lv_obj_set_size(keyboard, style::main_area::width, style::keyboard::height);
+        lv_obj_align(keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lv_obj_set_style_text_font(keyboard, &gui_montserrat_medium_28, LV_PART_ITEMS);
+        lv_keyboard_set_textarea(keyboard, textArea);
+        lv_obj_add_event_cb(keyboard, keyboardEventCallback, LV_EVENT_ALL, nullptr);
+    }
+}
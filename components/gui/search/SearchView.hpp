@@ -0,0 +1,8 @@
+#pragma once
+
+#include <Epub.hpp>
+
+namespace gui
+{
+    auto searchViewCreate(const Epub *epub) -> void;
+}
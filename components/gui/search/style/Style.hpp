@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Dimensions.hpp"
+
+namespace gui::style
+{
+    namespace top_bar
+    {
+        inline constexpr auto marginTop = 2;
+        inline constexpr auto width = main_area::width;
+        inline constexpr auto height = 60;
+        inline constexpr auto offsetY = main_area::minY + marginTop;
+    }
+
+    namespace back_button
+    {
+        inline constexpr auto offsetX = 2;
+        inline constexpr auto width = 60;
+        inline constexpr auto height = 50;
+    }
+
+    namespace text_area
+    {
+        inline constexpr auto width = top_bar::width - (back_button::width + 2 * back_button::offsetX + 10);
+        inline constexpr auto offsetX = -2;
+    }
+
+    namespace keyboard
+    {
+        inline constexpr auto height = 360;
+    }
+
+    namespace list
+    {
+        inline constexpr auto width = main_area::width;
+        inline constexpr auto height = main_area::height - (top_bar::height + top_bar::marginTop);
+    }
+
+    namespace snippet
+    {
+        inline constexpr auto contextBytes = 24; // Text shown before the match
+    }
+
+    namespace streaming
+    {
+        inline constexpr auto periodMs = 10;
+        inline constexpr auto sliceDurationMs = 50; // Time of scanning per timer call, keeps UI responsive
+        inline constexpr auto resultsUpdatePeriodMs = 1000;
+        inline constexpr auto maxHits = 500;
+    }
+}
@@ -0,0 +1,178 @@
+#include "Settings.hpp"
+#include "style/Style.hpp"
+#include "page/style/Style.hpp"
+#include "PageView.hpp"
+#include "BookIndexer.hpp"
+#include "TextLayout.hpp"
+#include "ReadingFonts.hpp"
+#include <esp_log.h>
+#include <algorithm>
+#include <cstdio>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        constexpr auto settingsFileMagic = std::uint32_t{0x54455352}; // "RSET"
+        constexpr auto settingsFileVersion = std::uint32_t{3};
+        constexpr auto fontFamilyMaxLength = 32;
+
+        struct SettingsFile
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            char fontFamily[fontFamilyMaxLength]; // Null terminated
+            std::uint16_t fontSize;
+            std::int16_t lineSpacing;
+            std::int16_t marginHorizontal;
+            std::int16_t marginVertical;
+            std::uint8_t isOptimalLineBreaking;
+            std::uint16_t hibernateDelay;
+        };
+
+        std::filesystem::path settingsPath;
+        std::filesystem::path fontsPath;
+        ReaderSettings current{
+            style::settings::defaults::fontFamily,
+            style::settings::defaults::fontSize,
+            style::settings::defaults::lineSpacing,
+            style::settings::defaults::marginHorizontal,
+            style::settings::defaults::marginVertical,
+            style::settings::defaults::isOptimalLineBreaking,
+            style::settings::defaults::hibernateDelay
+        };
+
+        auto isValid(const ReaderSettings &settings) -> bool
+        {
+            using namespace style::settings;
+            return (settings.fontFamily.size() < fontFamilyMaxLength) && (settings.fontFamily.find('/') == std::string::npos) &&
+                   (settings.fontSize >= font_size::min) && (settings.fontSize <= font_size::max) &&
+                   (settings.lineSpacing >= line_spacing::min) && (settings.lineSpacing <= line_spacing::max) &&
+                   (settings.marginHorizontal >= margin::min) && (settings.marginHorizontal <= margin::maxHorizontal) &&
+                   (settings.marginVertical >= margin::min) && (settings.marginVertical <= margin::maxVertical) &&
+                   (std::find(hibernate_delay::choices.begin(), hibernate_delay::choices.end(), settings.hibernateDelay) != hibernate_delay::choices.end());
+        }
+
+        auto readSettings(const std::filesystem::path &path) -> bool
+        {
+            auto file = std::fopen(path.c_str(), "rb");
+            if (file == nullptr) {
+                return false;
+            }
+
+            SettingsFile content;
+            const auto isRead = std::fread(&content, sizeof(content), 1, file) == 1;
+            std::fclose(file);
+            if (!isRead || (content.magic != settingsFileMagic) || (content.version != settingsFileVersion)) {
+                return false;
+            }
+
+            content.fontFamily[fontFamilyMaxLength - 1] = '\0';
+            const ReaderSettings settings{content.fontFamily, content.fontSize, content.lineSpacing, content.marginHorizontal, content.marginVertical,
+                                          content.isOptimalLineBreaking != 0, content.hibernateDelay};
+            if (!isValid(settings)) {
+                return false;
+            }
+            current = settings;
+            return true;
+        }
+
+        auto writeSettings(const std::filesystem::path &path) -> bool
+        {
+            SettingsFile content{};
+            content.magic = settingsFileMagic;
+            content.version = settingsFileVersion;
+            current.fontFamily.copy(content.fontFamily, fontFamilyMaxLength - 1);
+            content.fontSize = current.fontSize;
+            content.lineSpacing = static_cast<std::int16_t>(current.lineSpacing);
+            content.marginHorizontal = static_cast<std::int16_t>(current.marginHorizontal);
+            content.marginVertical = static_cast<std::int16_t>(current.marginVertical);
+            content.isOptimalLineBreaking = current.isOptimalLineBreaking ? 1 : 0;
+            content.hibernateDelay = current.hibernateDelay;
+
+            /* Write to temporary file first, so that power loss never leaves half-written settings */
+            auto tempPath = path;
+            tempPath += ".tmp";
+            auto file = std::fopen(tempPath.c_str(), "wb");
+            if (file == nullptr) {
+                return false;
+            }
+            const auto isWritten = std::fwrite(&content, sizeof(content), 1, file) == 1;
+            std::fclose(file);
+            if (!isWritten) {
+                std::remove(tempPath.c_str());
+                return false;
+            }
+
+            /* FAT can't rename over existing file */
+            std::remove(path.c_str());
+            return std::rename(tempPath.c_str(), path.c_str()) == 0;
+        }
+
+        auto loadFonts() -> void
+        {
+            const auto familyPath = current.fontFamily.empty() ? std::filesystem::path{} : (fontsPath / current.fontFamily);
+            readingFontsLoad(familyPath, fontsPath / style::fallbackFontFamily, current.fontSize, style::glyphCacheCapacity);
+        }
+    }
+
+    auto settingsLoad(const std::filesystem::path &rootPath) -> void
+    {
+        settingsPath = rootPath / style::settings::fileName;
+        fontsPath = rootPath / style::fontsDirectory;
+        if (!readSettings(settingsPath)) {
+            ESP_LOGI(TAG, "No valid settings in '%s', using defaults", settingsPath.c_str());
+        }
+        loadFonts();
+    }
+
+    auto settingsGet() -> const ReaderSettings &
+    {
+        return current;
+    }
+
+    auto settingsSet(const ReaderSettings &settings) -> bool
+    {
+        if (!isValid(settings)) {
+            return false;
+        }
+
+        const auto isFontChanged = (settings.fontFamily != current.fontFamily) || (settings.fontSize != current.fontSize);
+        const auto isLayoutChanged = isFontChanged || (settings.lineSpacing != current.lineSpacing) ||
+                                     (settings.marginHorizontal != current.marginHorizontal) || (settings.marginVertical != current.marginVertical) ||
+                                     (settings.isOptimalLineBreaking != current.isOptimalLineBreaking);
+        current = settings;
+        if (!writeSettings(settingsPath)) {
+            ESP_LOGE(TAG, "Failed to save settings to '%s'", settingsPath.c_str());
+        }
+
+        /* Fonts are replaced only when nothing measures text with them, the indexer is restarted by relayout */
+        if (isFontChanged) {
+            bookIndexerStop();
+            bookIndexerWaitForStop();
+            textLayoutResetFonts();
+            loadFonts();
+        }
+        if (isLayoutChanged) {
+            pageViewRelayout();
+        }
+        return true;
+    }
+
+    auto settingsGetLayout() -> Paginator::Layout
+    {
+        return {
+            static_cast<lv_coord_t>(style::width - (2 * current.marginHorizontal)),
+            static_cast<lv_coord_t>(style::height - (2 * current.marginVertical)),
+            current.lineSpacing,
+            current.isOptimalLineBreaking
+        };
+    }
+
+    auto settingsGetFontFamilies() -> std::vector<std::string>
+    {
+        return readingFontsGetFamilies(fontsPath, fontsPath / style::fallbackFontFamily);
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Paginator.hpp"
+#include <lvgl.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace gui
+{
+    struct ReaderSettings
+    {
+        std::string fontFamily; // Directory in the fonts directory, empty for the built-in font
+        std::uint16_t fontSize; // Of the body text, headings are proportionally larger
+        lv_coord_t lineSpacing;
+        lv_coord_t marginHorizontal;
+        lv_coord_t marginVertical;
+        bool isOptimalLineBreaking; // Justified paragraphs are broken as a whole, not line by line, at some cost of time
+        std::uint16_t hibernateDelay; // Seconds without input before deep sleep, 0 never hibernates
+    };
+
+    /* Reads the settings saved in the library root, defaults if there are none, and loads the reading
+     * fonts they select. Has to be called before any view is created. */
+    auto settingsLoad(const std::filesystem::path &rootPath) -> void;
+
+    [[nodiscard]] auto settingsGet() -> const ReaderSettings &;
+
+    /* Saves the settings and applies them to the opened page at once - it is laid out again at the same
+     * text position, page counts of the rest of the book are recomputed in the background. Fonts are
+     * loaded again only if their family or size changed, the page is not laid out again if only the
+     * hibernation delay changed. Returns false if any value is out of range. */
+    auto settingsSet(const ReaderSettings &settings) -> bool;
+
+    /* Layout of the text inside the margins */
+    [[nodiscard]] auto settingsGetLayout() -> Paginator::Layout;
+
+    /* Families available in the fonts directory, without the built-in one */
+    [[nodiscard]] auto settingsGetFontFamilies() -> std::vector<std::string>;
+}
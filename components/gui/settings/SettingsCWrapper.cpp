@@ -0,0 +1,7 @@
+#include "SettingsCWrapper.h"
+#include "Settings.hpp"
+
+uint32_t settingsGetHibernateDelayMs(void)
+{
+    return gui::settingsGet().hibernateDelay * 1000U;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Time without input before deep sleep, 0 if the device never hibernates */
+uint32_t settingsGetHibernateDelayMs(void);
+
+#ifdef __cplusplus
+}
+#endif
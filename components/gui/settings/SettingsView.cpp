@@ -0,0 +1,251 @@
+#include "SettingsView.hpp"
+#include "Settings.hpp"
+#include "style/Style.hpp"
+#include "Fonts.h"
+#include <lvgl.h>
+#include <esp_log.h>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#define TAG __FILENAME__
+
+namespace gui
+{
+    namespace
+    {
+        enum class Setting
+        {
+            FontFamily,
+            FontSize,
+            LineSpacing,
+            MarginHorizontal,
+            MarginVertical,
+            LineBreaking,
+            HibernateDelay
+        };
+
+        struct Row
+        {
+            Setting setting;
+            const char *name;
+            lv_obj_t *valueLabel;
+        };
+
+        lv_obj_t *view;
+        std::array<Row, style::settings_panel::rowsCount> rows{{
+            {Setting::FontFamily, "Font", nullptr},
+            {Setting::FontSize, "Font size", nullptr},
+            {Setting::LineSpacing, "Line spacing", nullptr},
+            {Setting::MarginHorizontal, "Side margins", nullptr},
+            {Setting::MarginVertical, "Top margins", nullptr},
+            {Setting::LineBreaking, "Line breaking", nullptr},
+            {Setting::HibernateDelay, "Deep sleep", nullptr}
+        }};
+        std::vector<std::string> fontFamilies; // Built-in font first, with empty name
+
+        auto getValueText(Setting setting) -> std::string
+        {
+            const auto &settings = settingsGet();
+            switch (setting) {
+                case Setting::FontFamily:
+                    return settings.fontFamily.empty() ? "Built-in" : settings.fontFamily;
+                case Setting::FontSize:
+                    return std::to_string(settings.fontSize) + " px";
+                case Setting::LineSpacing:
+                    return std::to_string(settings.lineSpacing) + " px";
+                case Setting::MarginHorizontal:
+                    return std::to_string(settings.marginHorizontal) + " px";
+                case Setting::LineBreaking:
+                    return settings.isOptimalLineBreaking ? "Optimal" : "Greedy";
+                case Setting::HibernateDelay:
+                    if (settings.hibernateDelay == 0) {
+                        return "Never";
+                    }
+                    return (settings.hibernateDelay < 60) ? (std::to_string(settings.hibernateDelay) + " s") : (std::to_string(settings.hibernateDelay / 60) + " min");
+                case Setting::MarginVertical:
+                default:
+                    return std::to_string(settings.marginVertical) + " px";
+            }
+        }
+
+        auto updateValues() -> void
+        {
+            for (const auto &row : rows) {
+                lv_label_set_text(row.valueLabel, getValueText(row.setting).c_str());
+            }
+        }
+
+        auto changeSetting(Setting setting, int direction) -> void
+        {
+            auto settings = settingsGet();
+            switch (setting) {
+                case Setting::FontFamily: {
+                    /* Family missing on the card, e.g. removed since it was chosen, is followed by the first one */
+                    const auto it = std::find(fontFamilies.begin(), fontFamilies.end(), settings.fontFamily);
+                    const auto index = (it != fontFamilies.end()) ? static_cast<int>(std::distance(fontFamilies.begin(), it)) : 0;
+                    const auto count = static_cast<int>(fontFamilies.size());
+                    settings.fontFamily = fontFamilies[(index + direction + count) % count];
+                    break;
+                }
+                case Setting::FontSize:
+                    settings.fontSize = static_cast<std::uint16_t>(settings.fontSize + (direction * style::settings::font_size::step));
+                    break;
+                case Setting::LineSpacing:
+                    settings.lineSpacing = static_cast<lv_coord_t>(settings.lineSpacing + (direction * style::settings::line_spacing::step));
+                    break;
+                case Setting::MarginHorizontal:
+                    settings.marginHorizontal = static_cast<lv_coord_t>(settings.marginHorizontal + (direction * style::settings::margin::step));
+                    break;
+                case Setting::MarginVertical:
+                    settings.marginVertical = static_cast<lv_coord_t>(settings.marginVertical + (direction * style::settings::margin::step));
+                    break;
+                case Setting::LineBreaking:
+                    /* Only two modes, both buttons switch between them */
+                    settings.isOptimalLineBreaking = !settings.isOptimalLineBreaking;
+                    break;
+                case Setting::HibernateDelay: {
+                    /* Choices are ordered from the shortest delay to never, unknown value is followed by the default */
+                    const auto &choices = style::settings::hibernate_delay::choices;
+                    const auto it = std::find(choices.begin(), choices.end(), settings.hibernateDelay);
+                    const auto index = (it != choices.end()) ? static_cast<int>(std::distance(choices.begin(), it)) : 0;
+                    const auto next = std::clamp(index + direction, 0, static_cast<int>(choices.size()) - 1);
+                    if (next == index) {
+                        ESP_LOGI(TAG, "Setting already at its limit");
+                        return;
+                    }
+                    settings.hibernateDelay = choices[next];
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            /* Values out of range are refused, the button just does nothing at the limit */
+            if (!settingsSet(settings)) {
+                ESP_LOGI(TAG, "Setting already at its limit");
+                return;
+            }
+            updateValues();
+        }
+
+        auto decreaseClickCallback(lv_event_t *event) -> void
+        {
+            const auto row = static_cast<const Row *>(lv_event_get_user_data(event));
+            changeSetting(row->setting, -1);
+        }
+
+        auto increaseClickCallback(lv_event_t *event) -> void
+        {
+            const auto row = static_cast<const Row *>(lv_event_get_user_data(event));
+            changeSetting(row->setting, 1);
+        }
+
+        auto closeView() -> void
+        {
+            for (auto &row : rows) {
+                row.valueLabel = nullptr;
+            }
+            fontFamilies.clear();
+            lv_obj_del_async(view);
+            view = nullptr;
+        }
+
+        auto viewClickCallback(lv_event_t *event) -> void
+        {
+            /* Tap on the page above the panel */
+            if (lv_event_get_target(event) == view) {
+                closeView();
+            }
+        }
+
+        auto viewSwipeCallback(lv_event_t *event) -> void
+        {
+            /* Rest of the swipe must not reach the page once the view is deleted */
+            const auto indev = lv_indev_get_act();
+            if (lv_indev_get_gesture_dir(indev) == LV_DIR_BOTTOM) {
+                lv_indev_wait_release(indev);
+                closeView();
+            }
+        }
+
+        auto createButton(lv_obj_t *parent, const char *text, lv_event_cb_t callback, Row &row) -> lv_obj_t *
+        {
+            auto button = lv_btn_create(parent);
+            lv_obj_set_size(button, style::settings_panel::buttonWidth, style::settings_panel::buttonHeight);
+            lv_obj_add_event_cb(button, callback, LV_EVENT_CLICKED, &row);
+
+            auto label = lv_label_create(button);
+            lv_label_set_text(label, text);
+            lv_obj_center(label);
+            return button;
+        }
+
+        auto createRow(lv_obj_t *panel, Row &row, std::size_t rowIndex) -> void
+        {
+            auto rowObject = lv_obj_create(panel);
+            lv_obj_set_size(rowObject, LV_PCT(100), style::settings_panel::rowHeight);
+            lv_obj_align(rowObject, LV_ALIGN_TOP_MID, 0, static_cast<lv_coord_t>(rowIndex * style::settings_panel::rowHeight));
+            lv_obj_set_style_pad_all(rowObject, 0, LV_PART_MAIN);
+            lv_obj_set_style_border_side(rowObject, LV_BORDER_SIDE_NONE, LV_PART_MAIN);
+            lv_obj_clear_flag(rowObject, LV_OBJ_FLAG_SCROLLABLE);
+
+            auto nameLabel = lv_label_create(rowObject);
+            lv_label_set_text(nameLabel, row.name);
+            lv_obj_align(nameLabel, LV_ALIGN_LEFT_MID, 0, 0);
+
+            /* Value between the buttons changing it */
+            const auto isChoice = (row.setting == Setting::FontFamily) || (row.setting == Setting::LineBreaking) ||
+                                  (row.setting == Setting::HibernateDelay);
+            auto increaseButton = createButton(rowObject, isChoice ? LV_SYMBOL_RIGHT : LV_SYMBOL_PLUS, increaseClickCallback, row);
+            lv_obj_align(increaseButton, LV_ALIGN_RIGHT_MID, 0, 0);
+
+            row.valueLabel = lv_label_create(rowObject);
+            lv_obj_set_width(row.valueLabel, style::settings_panel::valueWidth);
+            lv_obj_set_style_text_align(row.valueLabel, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+            lv_label_set_long_mode(row.valueLabel, LV_LABEL_LONG_DOT);
+            lv_obj_align_to(row.valueLabel, increaseButton, LV_ALIGN_OUT_LEFT_MID, 0, 0);
+
+            auto decreaseButton = createButton(rowObject, isChoice ? LV_SYMBOL_LEFT : LV_SYMBOL_MINUS, decreaseClickCallback, row);
+            lv_obj_align_to(decreaseButton, row.valueLabel, LV_ALIGN_OUT_LEFT_MID, 0, 0);
+        }
+    }
+
+    auto settingsViewCreate() -> void
+    {
+        if (view != nullptr) {
+            return;
+        }
+
+        fontFamilies = settingsGetFontFamilies();
+        fontFamilies.insert(fontFamilies.begin(), "");
+
+        /* Transparent view over the page catches taps and swipes outside the panel */
+        view = lv_obj_create(lv_scr_act());
+        lv_obj_set_size(view, style::main_area::width, style::main_area::height);
+        lv_obj_align(view, LV_ALIGN_TOP_MID, 0, style::main_area::minY);
+        lv_obj_set_style_bg_opa(view, LV_OPA_TRANSP, LV_PART_MAIN);
+        lv_obj_set_style_border_side(view, LV_BORDER_SIDE_NONE, LV_PART_MAIN);
+        lv_obj_set_style_pad_all(view, 0, LV_PART_MAIN);
+        lv_obj_clear_flag(view, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_clear_flag(view, LV_OBJ_FLAG_GESTURE_BUBBLE);
+        lv_obj_add_event_cb(view, viewClickCallback, LV_EVENT_CLICKED, nullptr);
+        lv_obj_add_event_cb(view, viewSwipeCallback, LV_EVENT_GESTURE, nullptr);
+
+        /* Create panel at the bottom */
+        auto panel = lv_obj_create(view);
+        lv_obj_set_size(panel, style::settings_panel::width, style::settings_panel::height);
+        lv_obj_align(panel, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lv_obj_set_style_pad_all(panel, style::settings_panel::padding, LV_PART_MAIN);
+        lv_obj_set_style_border_side(panel, LV_BORDER_SIDE_TOP, LV_PART_MAIN);
+        lv_obj_set_style_border_width(panel, style::settings_panel::borderWidth, LV_PART_MAIN);
+        lv_obj_set_style_text_font(panel, &gui_montserrat_medium_28, LV_PART_MAIN);
+        lv_obj_clear_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+
+        for (std::size_t i = 0; i < rows.size(); ++i) {
+            createRow(panel, rows[i], i);
+        }
+        updateValues();
+    }
+}
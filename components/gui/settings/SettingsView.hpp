@@ -0,0 +1,7 @@
+#pragma once
+
+namespace gui
+{
+    /* Panel over the bottom of the opened page, each change is applied to the page at once */
+    auto settingsViewCreate() -> void;
+}
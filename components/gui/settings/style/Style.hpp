@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Dimensions.hpp"
+#include <array>
+#include <cstdint>
+
+namespace gui::style
+{
+    namespace settings
+    {
+        inline constexpr auto fileName = ".settings"; // In the library root
+
+        namespace defaults
+        {
+            inline constexpr auto fontFamily = "reading";
+            inline constexpr auto fontSize = 28;
+            inline constexpr auto lineSpacing = 5;
+            inline constexpr auto marginHorizontal = 0;
+            inline constexpr auto marginVertical = 0;
+            inline constexpr auto isOptimalLineBreaking = true;
+            inline constexpr auto hibernateDelay = 120;
+        }
+
+        namespace font_size
+        {
+            inline constexpr auto min = 20;
+            inline constexpr auto max = 44;
+            inline constexpr auto step = 2;
+        }
+
+        namespace line_spacing
+        {
+            inline constexpr auto min = 0;
+            inline constexpr auto max = 30;
+            inline constexpr auto step = 5;
+        }
+
+        namespace margin
+        {
+            inline constexpr auto min = 0;
+            inline constexpr auto maxHorizontal = main_area::width / 5;
+            inline constexpr auto maxVertical = main_area::height / 5;
+            inline constexpr auto step = 10;
+        }
+
+        namespace hibernate_delay
+        {
+            /* Pages are usually read in 20 to 90 seconds, shorter delays hibernate between most page turns. That
+             * saves energy only if resuming takes less than about 0.3 s, see lvgl_task/sim/status_update_sim.c */
+            inline constexpr std::array<std::uint16_t, 6> choices = {30, 60, 120, 300, 600, 0};
+        }
+    }
+
+    namespace settings_panel
+    {
+        inline constexpr auto width = main_area::width;
+        inline constexpr auto rowHeight = 70;
+        inline constexpr auto rowsCount = 7;
+        inline constexpr auto padding = 10;
+        inline constexpr auto height = (rowHeight * rowsCount) + (2 * padding);
+        inline constexpr auto borderWidth = 2;
+        inline constexpr auto buttonWidth = 60;
+        inline constexpr auto buttonHeight = 56;
+        inline constexpr auto valueWidth = 150;
+    }
+}
@@ -3,11 +3,12 @@
 #include "Colors.hpp"
 // #include "gui_set_time_popup.h"
 #include "Fonts.h"
-#include <real_time_clock.h>
 #include <battery.h>
 #include <esp_log.h>
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <ctime>
 
 #define TAG __FILENAME__
 
@@ -18,23 +19,32 @@ namespace gui
         lv_obj_t *clockLabel;
         lv_obj_t *batteryIcon;
         lv_obj_t *batteryLabel;
+        lv_obj_t *progressLabel;
+
+        /* Unchanged label is not invalidated, so that the panel doesn't refresh for nothing */
+        auto setLabelText(lv_obj_t *label, const char *text) -> void
+        {
+            if (std::string_view{text} != lv_label_get_text(label)) {
+                lv_label_set_text(label, text);
+            }
+        }
 
         auto setBatteryIcon(std::uint8_t batteryPercent) -> void
         {
             if (batteryPercent < 20) {
-                lv_label_set_text(batteryIcon, LV_SYMBOL_BATTERY_EMPTY);
+                setLabelText(batteryIcon, LV_SYMBOL_BATTERY_EMPTY);
             }
             else if ((batteryPercent >= 20) && (batteryPercent < 40)) {
-                lv_label_set_text(batteryIcon, LV_SYMBOL_BATTERY_1);
+                setLabelText(batteryIcon, LV_SYMBOL_BATTERY_1);
             }
             else if ((batteryPercent >= 40) && (batteryPercent < 60)) {
-                lv_label_set_text(batteryIcon, LV_SYMBOL_BATTERY_2);
+                setLabelText(batteryIcon, LV_SYMBOL_BATTERY_2);
             }
             else if ((batteryPercent >= 60) && (batteryPercent < 90)) {
-                lv_label_set_text(batteryIcon, LV_SYMBOL_BATTERY_3);
+                setLabelText(batteryIcon, LV_SYMBOL_BATTERY_3);
             }
             else {
-                lv_label_set_text(batteryIcon, LV_SYMBOL_BATTERY_FULL);
+                setLabelText(batteryIcon, LV_SYMBOL_BATTERY_FULL);
             }
             lv_obj_align_to(batteryIcon, batteryLabel, LV_ALIGN_OUT_LEFT_MID, style::icon::offsetX, style::icon::offsetY);
         }
@@ -74,25 +84,54 @@ namespace gui
         lv_obj_set_height(batteryIcon, style::status_bar::height);
         lv_obj_set_style_text_font(batteryIcon, &gui_montserrat_medium_28, LV_PART_MAIN);
 
+        /* Create reading progress label */
+        progressLabel = lv_label_create(statusBar);
+        lv_obj_set_height(progressLabel, style::status_bar::height);
+        lv_obj_set_style_text_font(progressLabel, &gui_montserrat_medium_20, LV_PART_MAIN);
+        lv_obj_align(progressLabel, LV_ALIGN_LEFT_MID, style::progress::offsetX, style::progress::offsetY);
+        lv_label_set_text(progressLabel, "");
+
         /* Refresh status bar */
         statusBarUpdate();
     }
 
     auto statusBarUpdate() -> void
     {
+        statusBarUpdateClock();
+        statusBarUpdateBattery();
+    }
+
+    auto statusBarUpdateClock() -> void
+    {
+        /* System time is kept in step with the RTC, reading it takes no I2C transfer */
+        const auto now = std::time(nullptr);
         struct tm time;
-        real_time_clock_get_time(&time);
+        localtime_r(&now, &time);
 
-        /* Refresh time */
         char buffer[16];
         snprintf(buffer, sizeof(buffer), "%d:%02d", time.tm_hour, time.tm_min);
-        lv_label_set_text(clockLabel, buffer);
+        setLabelText(clockLabel, buffer);
+    }
 
-        /* Refresh battery level */
+    auto statusBarClearClock() -> void
+    {
+        setLabelText(clockLabel, "");
+    }
+
+    auto statusBarUpdateBattery() -> void
+    {
         const auto batteryLevel = battery_get_percent();
         const auto batteryVoltage = battery_get_voltage_filtered();
+
+        char buffer[16];
         snprintf(buffer, sizeof(buffer), "%d%% (%01.2fV)", batteryLevel, batteryVoltage / 1000.0f);
-        lv_label_set_text(batteryLabel, buffer);
+        setLabelText(batteryLabel, buffer);
         setBatteryIcon(batteryLevel);
     }
+
+    auto statusBarSetProgress(const std::string &text) -> void
+    {
+        /* Avoid needless redraw of the status bar */
+        setLabelText(progressLabel, text.c_str());
+    }
 }
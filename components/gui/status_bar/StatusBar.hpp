@@ -1,7 +1,13 @@
 #pragma once
 
+#include <string>
+
 namespace gui
 {
     auto statusBarCreate() -> void;
     auto statusBarUpdate() -> void;
+    auto statusBarUpdateClock() -> void;
+    auto statusBarClearClock() -> void; // Time that would stop being updated is not shown
+    auto statusBarUpdateBattery() -> void;
+    auto statusBarSetProgress(const std::string &text) -> void;
 }
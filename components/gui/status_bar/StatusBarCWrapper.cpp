@@ -10,3 +10,18 @@ void statusBarUpdate()
 {
     gui::statusBarUpdate();
 }
+
+void statusBarUpdateClock()
+{
+    gui::statusBarUpdateClock();
+}
+
+void statusBarClearClock()
+{
+    gui::statusBarClearClock();
+}
+
+void statusBarUpdateBattery()
+{
+    gui::statusBarUpdateBattery();
+}
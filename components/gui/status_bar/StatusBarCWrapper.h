@@ -6,6 +6,9 @@ extern "C" {
 
 void statusBarCreate();
 void statusBarUpdate();
+void statusBarUpdateClock();
+void statusBarClearClock();
+void statusBarUpdateBattery();
 
 #ifdef __cplusplus
 }
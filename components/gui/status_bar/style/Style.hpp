@@ -15,6 +15,12 @@ namespace gui::style
         inline constexpr auto offsetY = 2;
     }
 
+    namespace progress
+    {
+        inline constexpr auto offsetX = 10;
+        inline constexpr auto offsetY = 2;
+    }
+
     namespace icon
     {
         inline constexpr auto offsetX = -10;
@@ -1,7 +1,12 @@
 #include "TocListView.hpp"
 #include "style/Style.hpp"
 #include "PageView.hpp"
+#include "BookIndexer.hpp"
+#include "Settings.hpp"
+#include "SearchView.hpp"
 #include "ErrorPopup.hpp"
+#include "FilesListView.hpp"
+#include "RecycledList.hpp"
 #include "Fonts.h"
 #include <Epub.hpp>
 #include <lvgl.h>
@@ -17,36 +22,109 @@ namespace gui
         lv_obj_t *tocLabel;
         lv_obj_t *backButton;
         lv_obj_t *backButtonIcon;
-        lv_obj_t *tocList;
+        lv_obj_t *searchButton;
+        lv_obj_t *searchButtonLabel;
+        std::unique_ptr<RecycledList> tocList;
 
         std::unique_ptr<Epub> currentEpub;
+        std::vector<bool> expandedEntries;
+        std::vector<std::uint32_t> visibleEntries;
 
-        auto tocItemClickCallback(lv_event_t *event) -> void
+        auto getEntryIcon(std::size_t tocIndex) -> const char *
         {
-            const auto entry = static_cast<const Epub::TocEntry *>(lv_event_get_user_data(event));
-            const auto spineIndex = currentEpub->getSpineEntryIndex(entry->contentPath);
-            ESP_LOGI(TAG, "Entry title: %s", entry->title.c_str());
-            ESP_LOGI(TAG, "Entry href: %s", entry->contentPath.c_str());
+            if (!currentEpub->hasTocChildren(tocIndex)) {
+                return GUI_SYMBOL_BOOK_OPEN;
+            }
+            return expandedEntries[tocIndex] ? LV_SYMBOL_DOWN : LV_SYMBOL_RIGHT;
+        }
+
+        auto getListItem(std::size_t visibleIndex) -> RecycledList::Item
+        {
+            const auto tocIndex = visibleEntries[visibleIndex];
+            const auto &entry = currentEpub->getTableOfContent()[tocIndex];
+            const auto indent = static_cast<lv_coord_t>(entry.depth * style::list::button::indent);
+            return {getEntryIcon(tocIndex), std::string{currentEpub->getTocTitle(entry)}, indent};
+        }
+
+        auto reloadVisibleEntries() -> void
+        {
+            /* Skip subtrees of collapsed entries, nothing is created for them */
+            const auto &toc = currentEpub->getTableOfContent();
+            visibleEntries.clear();
+            for (std::size_t tocIndex = 0; tocIndex < toc.size();) {
+                visibleEntries.push_back(tocIndex);
+                tocIndex = expandedEntries[tocIndex] ? (tocIndex + 1) : currentEpub->getTocSubtreeEnd(tocIndex);
+            }
+            tocList->setItemCount(visibleEntries.size());
+        }
+
+        auto toggleEntry(std::size_t tocIndex) -> void
+        {
+            if (!currentEpub->hasTocChildren(tocIndex)) {
+                return;
+            }
+
+            /* Collapsing hides descendants, but they keep their own expansion state */
+            expandedEntries[tocIndex] = !expandedEntries[tocIndex];
+            reloadVisibleEntries();
+        }
+
+        auto tocItemClickCallback(std::size_t visibleIndex) -> void
+        {
+            const auto tocIndex = visibleEntries[visibleIndex];
+            const auto &entry = currentEpub->getTableOfContent()[tocIndex];
+            const auto href = std::filesystem::path{currentEpub->getTocHref(entry)};
+            const auto title = std::string{currentEpub->getTocTitle(entry)};
+
+            /* Headings without target (possible in EPUB3 nav) just expand or collapse */
+            if (href.empty()) {
+                toggleEntry(tocIndex);
+                return;
+            }
+
+            const auto spineIndex = currentEpub->getSpineEntryIndex(href);
+            ESP_LOGI(TAG, "Entry title: %s", title.c_str());
+            ESP_LOGI(TAG, "Entry href: %s", href.c_str());
             ESP_LOGI(TAG, "Entry spine index: %zu", spineIndex);
 
-            if (currentEpub->getSection(entry->contentPath).getBlocks().empty()) {
+            if (currentEpub->getSection(href).getBlocks().empty()) {
                 ESP_LOGW(TAG, "Selected section is empty!");
-                createErrorPopup("Section '" + entry->title + "' is not renderable or empty!");
+                createErrorPopup("Section '" + title + "' is not renderable or empty!");
             }
             else {
-                pageViewCreate(currentEpub.get(), spineIndex);
+                pageViewCreate(currentEpub.get(), {spineIndex, 0, 0});
             }
         }
 
+        auto tocItemIconClickCallback(std::size_t visibleIndex) -> void
+        {
+            const auto tocIndex = visibleEntries[visibleIndex];
+            if (currentEpub->hasTocChildren(tocIndex)) {
+                toggleEntry(tocIndex);
+            }
+            else {
+                tocItemClickCallback(visibleIndex);
+            }
+        }
+
+        auto searchButtonClickCallback(lv_event_t *event) -> void
+        {
+            searchViewCreate(currentEpub.get());
+        }
+
         auto backButtonClickCallback(lv_event_t *event) -> void
         {
+            bookIndexerStop();
+            tocList.reset();
+            visibleEntries.clear();
+            expandedEntries.clear();
             currentEpub.reset();
             lv_obj_del_async(topBar);
-            lv_obj_del_async(tocList);
+            filesListViewSetCovered(false);
         }
     }
 
-    auto tocListViewCreate(const std::filesystem::path &epubPath) -> void // TODO add error handling
+    auto tocListViewCreate(const std::filesystem::path &epubPath) -> bool
     {
         /* Open epub */
         try {
@@ -54,8 +132,9 @@ namespace gui
         }
         catch (const std::runtime_error &e) {
             ESP_LOGE(TAG, "Failed to open epub file '%s', error: %s", epubPath.c_str(), e.what());
-            return;
+            return false;
         }
+        filesListViewSetCovered(true);
 
         /* Create top bar */
         topBar = lv_obj_create(lv_scr_act());
@@ -83,23 +162,42 @@ namespace gui
         lv_obj_set_style_text_font(backButtonIcon, &gui_montserrat_medium_44, LV_PART_MAIN);
         lv_obj_center(backButtonIcon);
 
+        /* Add search button */
+        searchButton = lv_btn_create(topBar);
+        lv_obj_set_style_border_side(searchButton, LV_BORDER_SIDE_NONE, LV_PART_MAIN);
+        lv_obj_set_height(searchButton, style::search_button::height);
+        lv_obj_align(searchButton, LV_ALIGN_RIGHT_MID, style::search_button::offsetX, 0);
+        lv_obj_add_event_cb(searchButton, searchButtonClickCallback, LV_EVENT_CLICKED, nullptr);
+
+        /* Add search button label */
+        searchButtonLabel = lv_label_create(searchButton);
+        lv_label_set_text(searchButtonLabel, "Search");
+        lv_obj_set_style_text_font(searchButtonLabel, &gui_montserrat_medium_24, LV_PART_MAIN);
+        lv_obj_center(searchButtonLabel);
+
         /* Create list */
-        tocList = lv_list_create(lv_scr_act());
-        lv_obj_set_size(tocList, style::list::width, style::list::height);
-        lv_obj_align_to(tocList, topBar, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
-        lv_obj_clear_flag(tocList, LV_OBJ_FLAG_SCROLL_ELASTIC);
-
-        /* Fill the list with TOC items */
-        const auto &toc = currentEpub->getTableOfContent();
-        for (const auto &entry : toc) {
-            auto listButton = lv_list_add_btn(tocList, GUI_SYMBOL_BOOK_OPEN" ", entry.title.c_str());
-            auto rawEntryPtr = static_cast<void *>(const_cast<Epub::TocEntry *>(&entry));
-            lv_obj_add_event_cb(listButton, tocItemClickCallback, LV_EVENT_CLICKED, rawEntryPtr);
-            lv_obj_set_style_text_font(listButton, &gui_montserrat_medium_36, LV_PART_MAIN);
-            lv_obj_set_style_pad_top(listButton, style::list::button::padTop, LV_PART_MAIN);
-            lv_obj_set_style_pad_bottom(listButton, style::list::button::padBottom, LV_PART_MAIN);
-            auto listButtonLabel = lv_obj_get_child(listButton, lv_obj_get_child_cnt(listButton) - 1); // Label is created as the last child
-            lv_label_set_long_mode(listButtonLabel, LV_LABEL_LONG_WRAP); // Disable scrolling, just wrap the text
+        tocList = std::make_unique<RecycledList>(lv_scr_act(), style::list::width, style::list::height, &gui_montserrat_medium_36);
+        lv_obj_align_to(tocList->getObject(), topBar, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
+        tocList->setItemGetter(getListItem);
+        tocList->setClickCallback(tocItemClickCallback);
+        tocList->setIconClickCallback(tocItemIconClickCallback);
+
+        /* Fill the list with top level TOC items, rows are created only for the visible part of the list */
+        expandedEntries.assign(currentEpub->getTableOfContent().size(), false);
+        reloadVisibleEntries();
+
+        /* Count pages of the whole book in the background */
+        bookIndexerStart(epubPath, settingsGetLayout());
+        return true;
+    }
+
+    auto tocListViewResume(const EpubPosition &position) -> void
+    {
+        if ((currentEpub == nullptr) || (position.spineIndex >= currentEpub->getSpineItemsCount())) {
+            ESP_LOGW(TAG, "Invalid position to resume at, spine index: %zu", position.spineIndex);
+            return;
         }
+
+        pageViewCreate(currentEpub.get(), position);
     }
 }
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <EpubPosition.hpp>
 #include <filesystem>
 
 namespace gui
 {
-    auto tocListViewCreate(const std::filesystem::path &epubPath) -> void;
+    auto tocListViewCreate(const std::filesystem::path &epubPath) -> bool;
+    auto tocListViewResume(const EpubPosition &position) -> void;
 }
@@ -18,6 +18,12 @@ namespace gui::style
         inline constexpr auto height = 50;
     }
 
+    namespace search_button
+    {
+        inline constexpr auto offsetX = -2;
+        inline constexpr auto height = 50;
+    }
+
     namespace list
     {
         inline constexpr auto width = main_area::width;
@@ -25,8 +31,7 @@ namespace gui::style
 
         namespace button
         {
-            inline constexpr auto padTop = 20;
-            inline constexpr auto padBottom = 20;
+            inline constexpr auto indent = 30;
         }
     }
 }
@@ -1,17 +1,21 @@
 #include "lvgl_task.h"
+#include "status_update.h"
 #include <StatusBarCWrapper.h>
+#include <SettingsCWrapper.h>
+#include <BookIndexerCWrapper.h>
+#include <ThumbnailCacheCWrapper.h>
 #include <lvgl.h>
 #include <utils.h>
-#include <sleep.h>
+#include <power_manager.h>
 #include <eink_worker.h>
 #include <touch_panel.h>
-#include <real_time_clock.h>
 #include <esp_log.h>
 #include <esp_timer.h>
 #include <esp_check.h>
 #include <esp_log.h>
 #include <driver/uart.h>
 #include <freertos/FreeRTOS.h>
+#include <sys/time.h>
 
 #define TAG __FILENAME__
 
@@ -23,6 +27,9 @@ typedef struct
 	lv_disp_drv_t disp_drv;
 	lv_indev_drv_t indev_drv;
     esp_timer_handle_t tick_timer;
+    int64_t last_input_us; // LVGL ticks stop in light sleep, this time doesn't
+    bool is_first_refresh_queued;
+    bool is_boot_time_reported;
 } lvgl_ctx_t;
 
 static lvgl_ctx_t ctx;
@@ -37,9 +44,17 @@ static eink_err_t lvgl_display_init(void);
 static touch_panel_err_t lvgl_touch_init(void);
 static esp_err_t lvgl_tick_timer_init(void);
 
+static bool lvgl_is_idle(void);
+static bool lvgl_is_background_idle(void);
+static bool lvgl_is_hibernate_due(void);
+static int64_t lvgl_get_hibernate_time_us(void);
+static void lvgl_report_boot_time(void);
+static void lvgl_report_touch_stats(void);
+static void lvgl_update_status_bar(bool is_input);
 static uint64_t lvgl_get_sleep_timer_value_us(void);
-static void lvgl_enter_sleep_mode(void);
-static void lvgl_leave_sleep_mode(void);
+static power_manager_wakeup_t lvgl_enter_sleep_mode(void);
+static void lvgl_leave_sleep_mode(power_manager_wakeup_t wakeup);
+static void lvgl_hibernate(void);
 
 static void lvgl_task(void *arg);
 static void lvgl_tick_timer_callback(void *arg);
@@ -51,10 +66,20 @@ void lvgl_task_init(void)
     lv_init();
 
     /* Initialize hardware */
+    const esp_err_t err = power_manager_init();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to init power manager, error %d", err);
+    }
     lvgl_display_init(); // TODO error handling
     lvgl_touch_init();
     lvgl_tick_timer_init();
 
+    const status_update_config_t status_update_config = {
+        .clock_interval_s = STATUS_UPDATE_CLOCK_INTERVAL_S,
+        .battery_interval_s = STATUS_UPDATE_BATTERY_INTERVAL_S
+    };
+    status_update_init(&status_update_config);
+
     /* Start e-ink worker */
     eink_worker_start(lvgl_on_worker_ready);
 }
@@ -76,6 +101,7 @@ static void lvgl_on_display_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area
 
     if (lv_disp_flush_is_last(disp_drv)) {
         eink_worker_refresh();
+        ctx.is_first_refresh_queued = true;
         const uint32_t current_refresh = lv_tick_get();
         ESP_LOGI(TAG, "Time between refreshes: %lums", current_refresh - last_refresh);
         last_refresh = current_refresh;
@@ -91,32 +117,27 @@ static void lvgl_coords_rounder(lv_disp_drv_t *disp_drv, lv_area_t *area)
 
 static void lvgl_on_input_read(lv_indev_drv_t *drv, lv_indev_data_t *data)
 {
+    /* Events are queued by the touch panel driver, LVGL reads again at once while there are more */
     touch_panel_coords_t coords;
-    const touch_panel_err_t err = touch_get_coords(&coords);
-    if (err != TOUCH_PANEL_OK) {
-        ESP_LOGE(TAG, "Failed to read touch panel, error: %d", err);
-        return;
-    }
+    data->continue_reading = touch_panel_get_event(&coords);
 
     data->point.x = coords.x;
     data->point.y = coords.y;
     data->state = coords.state;
+    if (coords.state == TOUCH_PANEL_PRESSED) {
+        ctx.last_input_us = esp_timer_get_time();
+    }
 }
 
 static void lvgl_on_worker_ready(void)
 {
     lv_disp_flush_ready(&ctx.disp_drv);
-
-    /* Workaround to prevent entering sleep mode when e.g. list is inertially 
-     * scrolling. lv_disp_get_inactive_time() returns time of input device 
-     * inactivity, not time since last redraw. */
-    lv_disp_trig_activity(NULL);
 }
 
 static eink_err_t lvgl_display_init(void)
 {
-    /* Initialize eink hardware */
-    const eink_err_t err = eink_init(EINK_ROTATION_90, EINK_COLOR_NORMAL);
+    /* Initialize eink hardware, page shown before hibernation stays on the panel */
+    const eink_err_t err = eink_init(EINK_ROTATION_90, EINK_COLOR_NORMAL, !power_manager_is_resumed());
     if (err) {
        return err;
     }
@@ -179,44 +200,100 @@ static esp_err_t lvgl_tick_timer_init(void)
     return ESP_OK;
 }
 
-static uint64_t lvgl_get_sleep_timer_value_us(void)
+static bool lvgl_is_idle(void)
 {
-    struct tm time;
-    const real_time_clock_err_t err = real_time_clock_get_time(&time);
-    if (err) {
-        ESP_LOGE(TAG, "Failed to get RTC time, error: %d", err);
-        return 0;
+    /* lv_disp_get_inactive_time() returns time of input device inactivity, not time
+     * since last redraw, so pending redraws and animations have to be checked too. 
+     * Lists are paged and nothing scrolls inertially, so there is no need to fake 
+     * activity after each flush anymore. */
+    const lv_disp_t *disp = lv_disp_get_default();
+    const bool redraw_pending = (disp->inv_p != 0);
+    const bool anim_running = (lv_anim_count_running() != 0);
+
+    return (lv_disp_get_inactive_time(NULL) >= LVGL_SLEEP_INACTIVITY_PERIOD_MS) && !redraw_pending && !anim_running;
+}
+
+static bool lvgl_is_background_idle(void)
+{
+    return bookIndexerIsIdle() && thumbnailCacheIsIdle();
+}
+
+static bool lvgl_is_hibernate_due(void)
+{
+    const int64_t hibernate_time_us = lvgl_get_hibernate_time_us();
+    return (hibernate_time_us >= 0) && (esp_timer_get_time() >= hibernate_time_us);
+}
+
+static int64_t lvgl_get_hibernate_time_us(void)
+{
+    /* Delay is a reader setting, -1 if the device never hibernates */
+    const uint32_t delay_ms = settingsGetHibernateDelayMs();
+    return (delay_ms != 0) ? (ctx.last_input_us + (delay_ms * 1000LL)) : -1;
+}
+
+static void lvgl_report_boot_time(void)
+{
+    /* Time counts from the start of the app, ROM and second stage bootloaders are not included */
+    if (!ctx.is_boot_time_reported && ctx.is_first_refresh_queued && eink_worker_idle()) {
+        ctx.is_boot_time_reported = true;
+        ESP_LOGI(TAG, "First screen shown %llums after %s", esp_timer_get_time() / 1000, 
+                 power_manager_is_resumed() ? "waking from hibernation" : "cold boot");
     }
+}
 
-    /* Time to full minute in microseconds */
-    return (60 - time.tm_sec) * 1000ULL * 1000ULL;
+static void lvgl_report_touch_stats(void)
+{
+    /* Polling took at least one transaction per input read, three when there was new data */
+    touch_panel_stats_t stats;
+    touch_panel_get_stats(&stats);
+    ESP_LOGI(TAG, "Touch: %lu I2C transactions on %lu interrupts and %lu timeouts, polling would take at least %lu; %lu events dropped",
+             stats.i2c_transactions, stats.interrupts, stats.timeouts, stats.input_reads, stats.events_dropped);
 }
 
-static void lvgl_enter_sleep_mode(void)
+static void lvgl_update_status_bar(bool is_input)
+{
+    const status_update_t due = status_update_get_due(time(NULL), is_input);
+    if (due & STATUS_UPDATE_CLOCK) {
+        statusBarUpdateClock();
+    }
+    if (due & STATUS_UPDATE_BATTERY) {
+        statusBarUpdateBattery();
+    }
+}
+
+static uint64_t lvgl_get_sleep_timer_value_us(void)
+{
+    /* System time keeps counting in sleep, RTC doesn't have to be read */
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    uint64_t sleep_time_us = status_update_get_sleep_time_us(&now);
+
+    /* Device wakes up to hibernate on time, not at the next status update. Zero would disable the timer. */
+    const int64_t hibernate_time_us = lvgl_get_hibernate_time_us();
+    if (hibernate_time_us >= 0) {
+        const int64_t time_to_hibernate_us = hibernate_time_us - esp_timer_get_time();
+        sleep_time_us = MIN(sleep_time_us, (uint64_t)MAX(time_to_hibernate_us, 1));
+    }
+    return sleep_time_us;
+}
+
+static power_manager_wakeup_t lvgl_enter_sleep_mode(void)
 {
     const eink_err_t eink_err = eink_sleep();
     if (eink_err != EINK_OK) {
         ESP_LOGE(TAG, "Failed to put eink to sleep, error %d", eink_err);
-        return;
-    }
-
-    esp_err_t esp_err = sleep_timer_init(lvgl_get_sleep_timer_value_us());
-    if (esp_err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to init sleep timer, error %d", esp_err);
+        return POWER_MANAGER_WAKEUP_OTHER;
     }
 
-    esp_err = esp_timer_stop(ctx.tick_timer);
+    const esp_err_t esp_err = esp_timer_stop(ctx.tick_timer);
     if (esp_err != ESP_OK) {
         ESP_LOGE(TAG, "Failed to stop tick timer, error %d", esp_err);
     }
 
-    esp_err = sleep_enter();
-    if (esp_err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to put ESP to light sleep, error %d", esp_err);
-    }
+    return power_manager_sleep(lvgl_get_sleep_timer_value_us());
 }
 
-static void lvgl_leave_sleep_mode(void)
+static void lvgl_leave_sleep_mode(power_manager_wakeup_t wakeup)
 {
     const esp_err_t timer_err = esp_timer_start_periodic(ctx.tick_timer, LVGL_TICK_TIMER_PERIOD_MS * 1000);
     if (timer_err != ESP_OK) {
@@ -230,27 +307,55 @@ static void lvgl_leave_sleep_mode(void)
         return;
     }
 
-    statusBarUpdate();
+    if (wakeup == POWER_MANAGER_WAKEUP_TOUCH) {
+        lvgl_report_touch_stats();
+    }
+
+    /* Only the changed parts of the status bar are redrawn, unchanged ones don't refresh the panel */
+    lvgl_update_status_bar(wakeup != POWER_MANAGER_WAKEUP_TIMER);
 
     lv_tick_inc(LV_DISP_DEF_REFR_PERIOD);
     lv_task_handler();
 }
 
-static void lvgl_task(void *arg)
+static void lvgl_hibernate(void)
 {
-    /* Init sleep mode handler */
-    sleep_gpio_init();
+    /* Clock would stop, so it's not left on the panel */
+    statusBarClearClock();
+    lv_refr_now(NULL);
+    while (!eink_worker_idle()) {
+        vTaskDelay(pdMS_TO_TICKS(LVGL_TASK_HANDLER_PERIOD_MS));
+    }
+
+    const eink_err_t eink_err = eink_sleep();
+    if (eink_err != EINK_OK) {
+        ESP_LOGE(TAG, "Failed to put eink to sleep, error %d", eink_err);
+    }
 
+    power_manager_hibernate();
+}
+
+static void lvgl_task(void *arg)
+{
     /* Main loop */
     while (1) {
-        if ((lv_disp_get_inactive_time(NULL) >= LVGL_SLEEP_INACTIVITY_PERIOD_MS) && eink_worker_idle()) {
-            lvgl_enter_sleep_mode();
+        lvgl_report_boot_time();
+
+        const bool ui_idle = lvgl_is_idle() && eink_worker_idle();
+        if (ui_idle && lvgl_is_background_idle() && lvgl_is_hibernate_due()) {
+            lvgl_hibernate();
+        }
+        else if (ui_idle && lvgl_is_background_idle()) { // Sleep would freeze background tasks too
+            const power_manager_wakeup_t wakeup = lvgl_enter_sleep_mode();
 
             // Here CPU is sleeping
 
-            lvgl_leave_sleep_mode();
+            lvgl_leave_sleep_mode(wakeup);
         }
         else {
+            /* Background work alone runs at lower CPU frequency */
+            power_manager_set_active(!ui_idle);
+            lvgl_update_status_bar(false);
             lv_task_handler();
         }
         vTaskDelay(pdMS_TO_TICKS(LVGL_TASK_HANDLER_PERIOD_MS));
@@ -0,0 +1,257 @@
+/* Host simulation of a reading session, compares status bar updates driven by the status update policy
+ * with the former wakeup at each full minute, then shows how often the reader hibernates after various
+ * delays without input. Not a part of the firmware, build and run on the host with:
+ *
+ *   cc -std=gnu17 -I.. -o status_update_sim status_update_sim.c ../status_update.c && ./status_update_sim
+ *
+ * The reader turns a page every 20 to 90 seconds, the device sleeps after a second without input. Battery
+ * voltage drops slowly and its filtered reading is a few millivolts noisy, as on the device. Hibernating pays
+ * off only if resuming from deep sleep costs less than the light sleep current saved until the next page turn,
+ * its break-even column is the active time at which both cost the same. */
+
+#include "status_update.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SIM_HOURS 8
+#define SIM_START_S (10 * 3600 + 17 * 60 + 23) // Not aligned to a minute
+#define SIM_PAGE_TIME_MIN_S 20
+#define SIM_PAGE_TIME_MAX_S 90
+#define SIM_INACTIVITY_US (1000 * 1000)
+#define SIM_FAST_PER_DEEP_REFRESHES 12
+#define SIM_SEED 12345
+
+/* ESP32 alone, from its datasheet. The rest of the board draws the same in light and deep sleep. */
+#define SIM_LIGHT_SLEEP_MA 0.8
+#define SIM_DEEP_SLEEP_MA 0.15 // RTC peripherals are powered for the wakeup pins
+#define SIM_ACTIVE_MA 50.0 // 240 MHz, radio off
+
+#define US_PER_S (1000LL * 1000LL)
+
+typedef struct
+{
+    uint32_t timer_wakeups;
+    uint32_t input_wakeups;
+    uint32_t page_refreshes;   // Whole page, DU or GC16
+    uint32_t status_refreshes; // Status bar area only
+    uint32_t deep_refreshes;
+    uint32_t rtc_reads;
+    uint32_t battery_reads;
+} sim_stats_t;
+
+typedef struct
+{
+    int shown_minute;
+    int shown_battery; // Text of the battery label, as millivolts rounded to tens
+} sim_status_bar_t;
+
+static uint32_t sim_random_state;
+
+static uint32_t sim_random(uint32_t min, uint32_t max)
+{
+    sim_random_state = (sim_random_state * 1103515245U) + 12345U;
+    return min + ((sim_random_state >> 16) % (max - min + 1));
+}
+
+static int sim_battery_label(int64_t now_us)
+{
+    /* 4.15V falling by 25mV an hour, +-10mV noise, label shows hundredths of a volt */
+    const int64_t elapsed_s = (now_us / US_PER_S) - SIM_START_S;
+    const uint32_t noise = ((uint32_t)elapsed_s * 2654435761U) >> 16; // Doesn't disturb page times
+    const int millivolts = 4150 - (int)((elapsed_s * 25) / 3600) + (int)(noise % 21) - 10;
+    return (millivolts + 5) / 10;
+}
+
+static void sim_count_page_refresh(sim_stats_t *stats, uint32_t *fast_count)
+{
+    stats->page_refreshes++;
+    if (*fast_count >= SIM_FAST_PER_DEEP_REFRESHES) {
+        stats->deep_refreshes++;
+        *fast_count = 0;
+    }
+    else {
+        (*fast_count)++;
+    }
+}
+
+/* Former behaviour: timer to the next full minute read from the RTC, clock and battery updated
+ * at each wakeup and any change refreshed the whole panel */
+static void sim_run_minute_timer(sim_stats_t *stats)
+{
+    sim_status_bar_t bar = {-1, -1};
+    uint32_t fast_count = 0;
+    int64_t now_us = SIM_START_S * US_PER_S;
+    const int64_t end_us = now_us + (SIM_HOURS * 3600 * US_PER_S);
+    int64_t next_page_us = now_us + (sim_random(SIM_PAGE_TIME_MIN_S, SIM_PAGE_TIME_MAX_S) * US_PER_S);
+
+    while (now_us < end_us) {
+        const int64_t sleep_us = now_us + SIM_INACTIVITY_US;
+        stats->rtc_reads++;
+        const int64_t timer_us = sleep_us + ((60 - ((sleep_us / US_PER_S) % 60)) * US_PER_S);
+        const bool is_input = next_page_us < timer_us;
+        now_us = is_input ? next_page_us : timer_us;
+
+        /* Status bar update */
+        stats->rtc_reads++;
+        stats->battery_reads++;
+        const int minute = (int)(now_us / (60 * US_PER_S));
+        const int battery = sim_battery_label(now_us);
+        const bool is_changed = (minute != bar.shown_minute) || (battery != bar.shown_battery);
+        bar.shown_minute = minute;
+        bar.shown_battery = battery;
+
+        if (is_input) {
+            stats->input_wakeups++;
+            next_page_us = now_us + (sim_random(SIM_PAGE_TIME_MIN_S, SIM_PAGE_TIME_MAX_S) * US_PER_S);
+            sim_count_page_refresh(stats, &fast_count);
+        }
+        else {
+            stats->timer_wakeups++;
+            if (is_changed) {
+                sim_count_page_refresh(stats, &fast_count);
+            }
+        }
+    }
+}
+
+/* Policy driven: timer to the next clock interval from the system time, only changed parts of the
+ * status bar updated and refreshed, together with the page if there was an input */
+static void sim_run_policy(sim_stats_t *stats, uint32_t clock_interval_s)
+{
+    const status_update_config_t config = {
+        .clock_interval_s = clock_interval_s,
+        .battery_interval_s = STATUS_UPDATE_BATTERY_INTERVAL_S
+    };
+    status_update_init(&config);
+
+    sim_status_bar_t bar = {-1, -1};
+    uint32_t fast_count = 0;
+    int64_t now_us = SIM_START_S * US_PER_S;
+    const int64_t end_us = now_us + (SIM_HOURS * 3600 * US_PER_S);
+    int64_t next_page_us = now_us + (sim_random(SIM_PAGE_TIME_MIN_S, SIM_PAGE_TIME_MAX_S) * US_PER_S);
+
+    status_update_get_due((time_t)(now_us / US_PER_S), false);
+    bar.shown_minute = (int)(now_us / (60 * US_PER_S));
+    bar.shown_battery = sim_battery_label(now_us);
+
+    while (now_us < end_us) {
+        const int64_t sleep_us = now_us + SIM_INACTIVITY_US;
+        const struct timeval sleep_time = {.tv_sec = sleep_us / US_PER_S, .tv_usec = sleep_us % US_PER_S};
+        const int64_t timer_us = sleep_us + (int64_t)status_update_get_sleep_time_us(&sleep_time);
+        const bool is_input = next_page_us < timer_us;
+        now_us = is_input ? next_page_us : timer_us;
+
+        bool is_changed = false;
+        const status_update_t due = status_update_get_due((time_t)(now_us / US_PER_S), is_input);
+        if (due & STATUS_UPDATE_CLOCK) {
+            const int minute = (int)(now_us / (60 * US_PER_S));
+            is_changed |= (minute != bar.shown_minute);
+            bar.shown_minute = minute;
+        }
+        if (due & STATUS_UPDATE_BATTERY) {
+            stats->battery_reads++;
+            const int battery = sim_battery_label(now_us);
+            is_changed |= (battery != bar.shown_battery);
+            bar.shown_battery = battery;
+        }
+
+        if (is_input) {
+            stats->input_wakeups++;
+            next_page_us = now_us + (sim_random(SIM_PAGE_TIME_MIN_S, SIM_PAGE_TIME_MAX_S) * US_PER_S);
+            sim_count_page_refresh(stats, &fast_count);
+        }
+        else {
+            stats->timer_wakeups++;
+            if (is_changed) {
+                stats->status_refreshes++;
+            }
+        }
+    }
+}
+
+/* Device hibernates the delay after the last input, the timer wakes it then, and the next page turn
+ * resumes it from deep sleep. Clock wakeups only happen in light sleep. */
+static void sim_run_hibernate(uint32_t delay_s)
+{
+    int64_t now_s = SIM_START_S;
+    const int64_t end_s = now_s + (SIM_HOURS * 3600);
+    uint32_t page_turns = 0;
+    uint32_t resumes = 0;
+    uint32_t timer_wakeups = 0;
+    int64_t deep_sleep_s = 0;
+
+    while (now_s < end_s) {
+        const int64_t page_time_s = sim_random(SIM_PAGE_TIME_MIN_S, SIM_PAGE_TIME_MAX_S);
+        const bool is_hibernated = (delay_s != 0) && (page_time_s > delay_s);
+        const int64_t light_sleep_s = is_hibernated ? delay_s : page_time_s;
+
+        timer_wakeups += (uint32_t)(((now_s + light_sleep_s) / 60) - (now_s / 60)) + (is_hibernated ? 1 : 0);
+        if (is_hibernated) {
+            resumes++;
+            deep_sleep_s += page_time_s - delay_s;
+        }
+        page_turns++;
+        now_s += page_time_s;
+    }
+
+    /* Resume pays off only if it costs less than the light sleep current saved meanwhile */
+    const double deep_per_resume_s = (resumes > 0) ? ((double)deep_sleep_s / resumes) : 0.0;
+    const double break_even_s = deep_per_resume_s * (SIM_LIGHT_SLEEP_MA - SIM_DEEP_SLEEP_MA) / SIM_ACTIVE_MA;
+
+    char name[32];
+    if (delay_s == 0) {
+        snprintf(name, sizeof(name), "never");
+    }
+    else {
+        snprintf(name, sizeof(name), "after %lus", (unsigned long)delay_s);
+    }
+    printf("%-22s %8.1f %8.0f%% %8.1f %8.1f %8.1f %8.2f\n", name, (double)resumes / SIM_HOURS,
+           (100.0 * resumes) / page_turns, (double)timer_wakeups / SIM_HOURS, (double)deep_sleep_s / 60 / SIM_HOURS,
+           deep_per_resume_s, break_even_s);
+}
+
+static void sim_print(const char *name, const sim_stats_t *stats)
+{
+    printf("%-22s %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f\n", name,
+           (double)stats->timer_wakeups / SIM_HOURS, (double)stats->input_wakeups / SIM_HOURS,
+           (double)stats->page_refreshes / SIM_HOURS, (double)stats->deep_refreshes / SIM_HOURS,
+           (double)stats->status_refreshes / SIM_HOURS, (double)stats->rtc_reads / SIM_HOURS,
+           (double)stats->battery_reads / SIM_HOURS);
+}
+
+int main(void)
+{
+    static const uint32_t clock_intervals_s[] = {60, 120, 300, 900};
+
+    printf("%d hour reading session, page every %d-%ds, per hour:\n\n", SIM_HOURS, SIM_PAGE_TIME_MIN_S, SIM_PAGE_TIME_MAX_S);
+    printf("%-22s %8s %8s %8s %8s %8s %8s %8s\n", "", "timer", "input", "page", "of them", "status", "RTC", "battery");
+    printf("%-22s %8s %8s %8s %8s %8s %8s %8s\n", "", "wakeups", "wakeups", "refresh", "GC16", "refresh", "reads", "reads");
+
+    sim_stats_t stats = {0};
+    sim_random_state = SIM_SEED;
+    sim_run_minute_timer(&stats);
+    sim_print("full minute timer", &stats);
+
+    for (size_t i = 0; i < (sizeof(clock_intervals_s) / sizeof(clock_intervals_s[0])); ++i) {
+        char name[32];
+        snprintf(name, sizeof(name), "policy, clock %lus", (unsigned long)clock_intervals_s[i]);
+
+        sim_stats_t policy_stats = {0};
+        sim_random_state = SIM_SEED;
+        sim_run_policy(&policy_stats, clock_intervals_s[i]);
+        sim_print(name, &policy_stats);
+    }
+
+    static const uint32_t hibernate_delays_s[] = {30, 60, 120, 300, 600, 0};
+
+    printf("\nHibernation, per hour:\n\n");
+    printf("%-22s %8s %9s %8s %8s %8s %8s\n", "", "resumes", "of page", "timer", "deep", "deep s", "break");
+    printf("%-22s %8s %9s %8s %8s %8s %8s\n", "", "", "turns", "wakeups", "sleep m", "/resume", "even s");
+    for (size_t i = 0; i < (sizeof(hibernate_delays_s) / sizeof(hibernate_delays_s[0])); ++i) {
+        sim_random_state = SIM_SEED;
+        sim_run_hibernate(hibernate_delays_s[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include "status_update.h"
+
+#define SECONDS_PER_MINUTE 60
+
+typedef struct
+{
+    status_update_config_t config;
+    bool is_shown;
+    time_t clock_shown;
+    time_t battery_shown;
+} status_update_ctx_t;
+
+static status_update_ctx_t ctx;
+
+/* Public functions */
+void status_update_init(const status_update_config_t *config)
+{
+    ctx.config = *config;
+    if (ctx.config.clock_interval_s < SECONDS_PER_MINUTE) {
+        ctx.config.clock_interval_s = SECONDS_PER_MINUTE;
+    }
+    ctx.is_shown = false;
+}
+
+status_update_t status_update_get_due(time_t now, bool is_input)
+{
+    if (!ctx.is_shown) {
+        ctx.is_shown = true;
+        ctx.clock_shown = now;
+        ctx.battery_shown = now;
+        return STATUS_UPDATE_CLOCK | STATUS_UPDATE_BATTERY;
+    }
+
+    status_update_t due = STATUS_UPDATE_NONE;
+
+    const bool is_interval_passed = (now / ctx.config.clock_interval_s) != (ctx.clock_shown / ctx.config.clock_interval_s);
+    const bool is_minute_changed = (now / SECONDS_PER_MINUTE) != (ctx.clock_shown / SECONDS_PER_MINUTE);
+    if (is_interval_passed || (is_input && is_minute_changed)) {
+        due |= STATUS_UPDATE_CLOCK;
+        ctx.clock_shown = now;
+    }
+
+    /* Battery is coalesced with refreshes that happen anyway */
+    const bool is_battery_stale = (now - ctx.battery_shown) >= (time_t)ctx.config.battery_interval_s;
+    if (is_battery_stale && ((due != STATUS_UPDATE_NONE) || is_input)) {
+        due |= STATUS_UPDATE_BATTERY;
+        ctx.battery_shown = now;
+    }
+
+    return due;
+}
+
+uint64_t status_update_get_sleep_time_us(const struct timeval *now)
+{
+    const time_t next_update = ((now->tv_sec / ctx.config.clock_interval_s) + 1) * ctx.config.clock_interval_s;
+    return ((uint64_t)(next_update - now->tv_sec) * 1000ULL * 1000ULL) - now->tv_usec + STATUS_UPDATE_WAKEUP_MARGIN_US;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/time.h>
+
+/* Clock shows minutes, so it's never due more often than once a minute. Battery level changes slowly
+ * and is only updated along with the clock or after an input, it never wakes the device on its own. */
+#define STATUS_UPDATE_CLOCK_INTERVAL_S 60
+#define STATUS_UPDATE_BATTERY_INTERVAL_S (15 * 60)
+#define STATUS_UPDATE_WAKEUP_MARGIN_US (50 * 1000) // Timer waking up a bit early must not miss the interval
+
+typedef enum
+{
+    STATUS_UPDATE_NONE = 0,
+    STATUS_UPDATE_CLOCK = (1 << 0),
+    STATUS_UPDATE_BATTERY = (1 << 1)
+} status_update_t;
+
+typedef struct
+{
+    uint32_t clock_interval_s; // Multiple of a minute
+    uint32_t battery_interval_s;
+} status_update_config_t;
+
+/* Both parts are due right after init */
+void status_update_init(const status_update_config_t *config);
+
+/* Parts of the status bar to update now, they are marked as updated. Clock is due at the start of each
+ * interval or after an input, if the minute changed, as the panel refreshes then anyway. */
+status_update_t status_update_get_due(time_t now, bool is_input);
+
+/* Time to the start of the next clock interval, for the sleep timer */
+uint64_t status_update_get_sleep_time_us(const struct timeval *now);
+
+#ifdef __cplusplus
+}
+#endif
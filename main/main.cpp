@@ -1,6 +1,7 @@
 #include <i2c.h>
 #include <spi.h>
 #include <fatfs_sd.h>
+#include <reading_state.h>
 #include <battery.h>
 #include <real_time_clock.h>
 #include <lvgl_task.h>
@@ -31,7 +32,9 @@ extern "C" void app_main()
     ESP_ERROR_CHECK(i2c_init());
     ESP_ERROR_CHECK(spi_init());
     ESP_ERROR_CHECK(real_time_clock_init());
+    real_time_clock_sync_system_time();
     ESP_ERROR_CHECK(fatfs_sd_init());
+    ESP_ERROR_CHECK(reading_state_init());
 
     battery_init();
 